@@ -0,0 +1,183 @@
+#ifndef GNURADIO_ALGORITHM_NCO_HPP
+#define GNURADIO_ALGORITHM_NCO_HPP
+
+#include <array>
+#include <cassert>
+#include <cmath>
+#include <complex>
+#include <concepts>
+#include <cstdint>
+#include <limits>
+#include <numbers>
+#include <span>
+#include <type_traits>
+
+#include <vir/simd.h>
+
+namespace gr::algorithm {
+
+/**
+ * @brief Numerically controlled oscillator (NCO) based on a 64-bit integer phase accumulator.
+ *
+ * The phase is an unsigned fixed-point fraction of a full turn that wraps naturally, i.e. arbitrarily long runs neither drift
+ * nor lose precision (unlike accumulating time or radians in floating-point). Samples are generated in bulk: the accumulator is
+ * advanced and folded into [-pi/2, pi/2] in integer arithmetic, followed by an odd polynomial evaluated in SIMD lanes
+ * (Taylor series, truncation error below 1 ulp for both float and double).
+ *
+ * Phase convention: the n-th generated sample corresponds to `phase() + n * phaseIncrement()`.
+ *
+ * Usage:
+ * @code
+ * gr::algorithm::NCO<float> nco;
+ * nco.setFrequency(1'000., 48'000.); // 1 kHz tone @ 48 kS/s
+ * nco.generateSin(output);           // real-valued output, continues phase-coherently on the next call
+ * nco.mix(input, output);            // complex frequency translation: output[i] = input[i] * exp(j * phase_i)
+ * @endcode
+ */
+template<std::floating_point T>
+class NCO {
+    using simd_type                    = vir::stdx::native_simd<T>;
+    static constexpr std::size_t kLane = simd_type::size();
+
+    static constexpr std::uint64_t kQuarterTurn = 1ULL << 62U;
+    static constexpr std::size_t   kChunkSize   = 256UZ; // scratch size for the complex outputs
+
+    // Taylor coefficients (-1)^k / (2k+1)! of sin(y) for |y| <= pi/2: the first omitted term is < 6e-8 (float) and < 2e-18 (double)
+    static constexpr std::size_t kNCoefficients = std::same_as<T, float> ? 6UZ : 11UZ;
+    static constexpr auto        kCoefficients  = [] {
+        std::array<T, kNCoefficients> coefficients{};
+        double                        value = 1.0;
+        for (std::size_t k = 0UZ; k < kNCoefficients; ++k) {
+            coefficients[k] = static_cast<T>(value);
+            value           = -value / static_cast<double>((2UZ * k + 2UZ) * (2UZ * k + 3UZ));
+        }
+        return coefficients;
+    }();
+
+    std::uint64_t _phase     = 0U;
+    std::uint64_t _increment = 0U;
+
+public:
+    /// converts a phase in turns (any real value, wrapped to [0, 1)) into the accumulator's fixed-point representation
+    [[nodiscard]] static std::uint64_t toPhaseWord(double turns) noexcept {
+        const double fraction = turns - std::floor(turns);
+        return fraction < 1.0 ? static_cast<std::uint64_t>(std::ldexp(fraction, 64)) : 0U; // N.B. tiny negative values round to 1.0
+    }
+
+    [[nodiscard]] static double toTurns(std::uint64_t phaseWord) noexcept { return std::ldexp(static_cast<double>(phaseWord), -64); }
+
+    void setPhaseIncrement(double radiansPerSample) noexcept { _increment = toPhaseWord(radiansPerSample / (2. * std::numbers::pi)); }
+    void setFrequency(double frequency, double sampleRate) noexcept { _increment = toPhaseWord(frequency / sampleRate); }
+    void setPhase(double radians) noexcept { _phase = toPhaseWord(radians / (2. * std::numbers::pi)); }
+    void adjustPhase(double radians) noexcept { _phase += toPhaseWord(radians / (2. * std::numbers::pi)); }
+    void advance(std::size_t nSamples) noexcept { _phase += _increment * nSamples; } // N.B. modulo 2^64 arithmetic == phase wrapping
+
+    [[nodiscard]] double        phase() const noexcept { return 2. * std::numbers::pi * toTurns(_phase); } // [0, 2 pi)
+    [[nodiscard]] double        phaseIncrement() const noexcept { return 2. * std::numbers::pi * toTurns(_increment); }
+    [[nodiscard]] std::uint64_t phaseWord() const noexcept { return _phase; }
+    [[nodiscard]] std::uint64_t phaseIncrementWord() const noexcept { return _increment; }
+
+    void generateSin(std::span<T> output) noexcept {
+        evaluateSin(0U, output);
+        advance(output.size());
+    }
+
+    void generateCos(std::span<T> output) noexcept {
+        evaluateSin(kQuarterTurn, output);
+        advance(output.size());
+    }
+
+    /// fractional phase in turns [0, 1), e.g. as basis for square, saw-tooth or triangle waveforms
+    void generateTurns(std::span<T> output) noexcept {
+        constexpr int shift = 64 - std::numeric_limits<T>::digits;
+        constexpr T   scale = T(1) / static_cast<T>(1ULL << std::numeric_limits<T>::digits);
+        std::uint64_t phase = _phase;
+        for (T& value : output) {
+            value = static_cast<T>(phase >> shift) * scale; // N.B. exact, i.e. never rounds up to 1.0
+            phase += _increment;
+        }
+        _phase = phase;
+    }
+
+    /// output[i] = exp(j * phase_i)
+    void generate(std::span<std::complex<T>> output) noexcept {
+        forEachChunk(output.size(), [&output](std::size_t offset, std::span<const T> sin, std::span<const T> cos) {
+            T* out = reinterpret_cast<T*>(output.data() + offset); // N.B. std::complex<T> is layout-compatible with T[2]
+            for (std::size_t i = 0UZ; i < sin.size(); ++i) {
+                out[2UZ * i]       = cos[i];
+                out[2UZ * i + 1UZ] = sin[i];
+            }
+        });
+    }
+
+    /// output[i] = input[i] * exp(j * phase_i), i.e. frequency translation by the NCO frequency
+    void mix(std::span<const std::complex<T>> input, std::span<std::complex<T>> output) noexcept {
+        assert(input.size() >= output.size());
+        forEachChunk(output.size(), [&input, &output](std::size_t offset, std::span<const T> sin, std::span<const T> cos) {
+            const T* in  = reinterpret_cast<const T*>(input.data() + offset); // N.B. std::complex<T> is layout-compatible with T[2]
+            T*       out = reinterpret_cast<T*>(output.data() + offset);
+            for (std::size_t i = 0UZ; i < sin.size(); ++i) {
+                const T re         = in[2UZ * i];
+                const T im         = in[2UZ * i + 1UZ];
+                out[2UZ * i]       = re * cos[i] - im * sin[i];
+                out[2UZ * i + 1UZ] = re * sin[i] + im * cos[i];
+            }
+        });
+    }
+
+private:
+    template<typename V>
+    [[nodiscard]] static V sinPolynomial(V y) noexcept {
+        const V y2     = y * y;
+        V       result = V(kCoefficients[kNCoefficients - 1UZ]);
+        for (std::size_t k = kNCoefficients - 1UZ; k-- > 0UZ;) {
+            result = result * y2 + V(kCoefficients[k]);
+        }
+        return result * y;
+    }
+
+    /// output[i] = sin(phase_i + phaseOffset) without advancing the accumulator
+    void evaluateSin(std::uint64_t phaseOffset, std::span<T> output) const noexcept {
+        // fold into [-pi/2, pi/2] via sin(x) == sin(pi - x), i.e. y = |x + pi/2| - pi/2 (mod 2 pi), in integer arithmetic to remain exact
+        // N.B. float only needs the upper 32 phase bits (resolution: 1.5e-9 rad), which keeps the integer ops vectorisable without AVX-512
+        using fold_type                       = std::conditional_t<std::same_as<T, float>, std::int32_t, std::int64_t>;
+        using ufold_type                      = std::make_unsigned_t<fold_type>;
+        constexpr int        kDiscardedBits   = 64 - std::numeric_limits<ufold_type>::digits;
+        constexpr ufold_type kFoldQuarterTurn = ufold_type(1) << (std::numeric_limits<ufold_type>::digits - 2);
+        constexpr T          kScale           = T(2 * std::numbers::pi) / (T(4) * static_cast<T>(kFoldQuarterTurn)); // [rad/LSB]
+
+        std::uint64_t phase = _phase + phaseOffset + kQuarterTurn;
+        for (T& value : output) {
+            const auto shifted   = static_cast<fold_type>(static_cast<ufold_type>(phase >> kDiscardedBits));
+            const auto sign      = static_cast<ufold_type>(shifted >> (std::numeric_limits<ufold_type>::digits - 1)); // 0 or ~0
+            const auto magnitude = static_cast<ufold_type>((static_cast<ufold_type>(shifted) ^ sign) - sign);
+            value                = static_cast<T>(static_cast<fold_type>(static_cast<ufold_type>(magnitude - kFoldQuarterTurn))) * kScale;
+            phase += _increment;
+        }
+
+        const std::size_t nVectorised = output.size() - output.size() % kLane;
+        for (std::size_t i = 0UZ; i < nVectorised; i += kLane) {
+            sinPolynomial(simd_type(output.data() + i, vir::stdx::element_aligned)).copy_to(output.data() + i, vir::stdx::element_aligned);
+        }
+        for (std::size_t i = nVectorised; i < output.size(); ++i) {
+            output[i] = sinPolynomial(output[i]);
+        }
+    }
+
+    template<typename Fnc>
+    void forEachChunk(std::size_t nSamples, Fnc&& fnc) noexcept {
+        std::array<T, kChunkSize> sin;
+        std::array<T, kChunkSize> cos;
+        for (std::size_t offset = 0UZ; offset < nSamples; offset += kChunkSize) {
+            const std::size_t n = std::min(kChunkSize, nSamples - offset);
+            evaluateSin(0U, std::span(sin).first(n));
+            evaluateSin(kQuarterTurn, std::span(cos).first(n));
+            fnc(offset, std::span<const T>(sin).first(n), std::span<const T>(cos).first(n));
+            advance(n);
+        }
+    }
+};
+
+} // namespace gr::algorithm
+
+#endif // GNURADIO_ALGORITHM_NCO_HPP
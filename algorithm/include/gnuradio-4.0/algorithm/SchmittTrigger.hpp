@@ -3,6 +3,8 @@
 
 #include <cmath>
 #include <cstddef>
+#include <limits>
+#include <span>
 
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
@@ -206,6 +208,77 @@ struct SchmittTrigger {
         return EdgeDetection::NONE;
     }
 
+    /**
+     * @brief fast-forwards over the leading `samples` that provably neither cause an edge nor start an interpolation window.
+     *
+     * The state is updated as if `processOne(..)` was called for each of these samples. Since edges are typically rare,
+     * the bulk of the samples is screened using SIMD compares against the active threshold, leaving the exact hysteresis
+     * state machine and interpolation in `processOne(..)` to run only at and after candidate crossings.
+     * @return number of samples that have been consumed (N.B. `samples[return value]` is the next candidate, if any)
+     */
+    std::size_t processQuiet(std::span<const T> samples) noexcept {
+        using enum InterpolationMethod;
+        const std::size_t nQuiet = findFirstCandidate(samples);
+        if (nQuiet == 0UZ) {
+            return 0UZ;
+        }
+
+        if constexpr (Method == NO_INTERPOLATION || Method == BASIC_LINEAR_INTERPOLATION) { // same as the per-sample update in processOne(..), saturated
+            constexpr std::int64_t kMinIdx = std::numeric_limits<std::int32_t>::min();
+            lastEdgeIdx                    = lastEdgeIdx > 0 ? 1 : static_cast<std::int32_t>(std::max(kMinIdx, static_cast<std::int64_t>(lastEdgeIdx) - 2 * static_cast<std::int64_t>(nQuiet)));
+        }
+        if constexpr (Method != NO_INTERPOLATION) {
+            _historyBuffer.push_back_bulk(samples.begin(), std::next(samples.begin(), static_cast<std::ptrdiff_t>(nQuiet)));
+        }
+        return nQuiet;
+    }
+
+    /**
+     * @brief index of the first sample that may change the trigger state (i.e. crosses the active threshold or enters the
+     * hysteresis band for LINEAR_INTERPOLATION), or `samples.size()` if there is none.
+     */
+    [[nodiscard]] std::size_t findFirstCandidate(std::span<const T> samples) const noexcept {
+        using enum InterpolationMethod;
+        if (samples.empty()) {
+            return 0UZ;
+        }
+
+        const auto isCandidate = [this]([[maybe_unused]] const auto& prev, const auto& curr) {
+            if constexpr (Method == LINEAR_INTERPOLATION) {
+                return _lastState ? (prev >= _upperThreshold && curr < _upperThreshold) : (prev <= _lowerThreshold && curr > _lowerThreshold);
+            } else {
+                return _lastState ? (curr <= _lowerThreshold) : (curr >= _upperThreshold);
+            }
+        };
+
+        if constexpr (Method == LINEAR_INTERPOLATION) {
+            if (accumulatedSamples > 0UZ || _historyBuffer.size() == 0UZ || isCandidate(_historyBuffer[0], samples[0])) {
+                return 0UZ; // within an interpolation window or at a candidate -> needs per-sample processing
+            }
+        } else if (isCandidate(samples[0], samples[0])) {
+            return 0UZ;
+        }
+
+        std::size_t i = 1UZ;
+        if constexpr (std::is_arithmetic_v<T>) {
+            using simd_type              = vir::stdx::native_simd<T>;
+            constexpr std::size_t kWidth = simd_type::size();
+            for (; i + kWidth <= samples.size(); i += kWidth) {
+                const simd_type curr(samples.data() + i, vir::stdx::element_aligned);
+                const simd_type prev(samples.data() + i - 1UZ, vir::stdx::element_aligned);
+                if (const auto candidates = isCandidate(prev, curr); vir::stdx::any_of(candidates)) {
+                    return i + static_cast<std::size_t>(vir::stdx::find_first_set(candidates));
+                }
+            }
+        }
+        for (; i < samples.size(); ++i) {
+            if (isCandidate(samples[i - 1UZ], samples[i])) {
+                return i;
+            }
+        }
+        return samples.size();
+    }
+
     std::optional<T> findCrossingIndexLinearRegression(const auto& samples, std::size_t nSamples, value_t offset) {
         if (nSamples < 2) { // not enough samples to perform linear regression
             return std::nullopt;
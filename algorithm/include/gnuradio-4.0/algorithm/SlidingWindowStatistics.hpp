@@ -0,0 +1,311 @@
+#ifndef GNURADIO_ALGORITHM_SLIDINGWINDOWSTATISTICS_HPP
+#define GNURADIO_ALGORITHM_SLIDINGWINDOWSTATISTICS_HPP
+
+#include <algorithm>
+#include <cmath>
+#include <concepts>
+#include <cstddef>
+#include <functional>
+#include <set>
+#include <span>
+#include <stdexcept>
+#include <vector>
+
+#include <vir/simd.h>
+
+#include <gnuradio-4.0/HistoryBuffer.hpp>
+
+namespace gr::algorithm {
+
+namespace detail {
+template<std::floating_point T>
+struct Moments {
+    std::size_t n    = 0UZ;
+    T           mean = T(0);
+    T           m2   = T(0); // sum of squared deviations from the mean
+};
+
+/// two-pass (numerically stable) mean and M2 of a contiguous range, both passes evaluated in SIMD lanes
+template<std::floating_point T>
+[[nodiscard]] Moments<T> moments(std::span<const T> data) noexcept {
+    using V = vir::stdx::native_simd<T>;
+    if (data.empty()) {
+        return {};
+    }
+
+    const std::size_t nSimd = data.size() - data.size() % V::size();
+    const auto        sum   = [&data, nSimd](auto&& fnc) {
+        V accumulator(T(0));
+        for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+            accumulator += fnc(V(&data[i], vir::stdx::element_aligned));
+        }
+        T result = vir::stdx::reduce(accumulator);
+        for (std::size_t i = nSimd; i < data.size(); ++i) {
+            result += fnc(data[i]);
+        }
+        return result;
+    };
+
+    const T mean = sum([](const auto& x) { return x; }) / static_cast<T>(data.size());
+    const T m2   = sum([mean](const auto& x) {
+        const auto delta = x - mean;
+        return delta * delta;
+    });
+    return {data.size(), mean, m2};
+}
+} // namespace detail
+
+/**
+ * @brief Mean, RMS, variance and standard deviation over a sliding window of the last 'windowSize' samples with O(1) updates.
+ *
+ * Single samples update the running mean and M2 (sum of squared deviations) via the sliding variant of Welford's algorithm.
+ * Blocks of samples (push_back_bulk) compute the moments of the incoming and of the expiring samples in SIMD lanes and combine
+ * them with the running moments using Chan et al.'s pairwise update, i.e. O(1) per sample with a small constant.
+ * The moments are re-computed exactly (two-pass) once every 'windowSize' samples, which bounds the round-off accumulated by the
+ * add/remove recurrences for arbitrarily long runs (amortised O(1) per sample).
+ *
+ * Usage:
+ * @code
+ * gr::algorithm::SlidingMoments<float> stats(1024UZ);
+ * stats.push_back(x);           // single sample
+ * stats.push_back_bulk(chunk);  // block of samples
+ * stats.mean(); stats.rms(); stats.variance(); stats.stddev();
+ * @endcode
+ */
+template<std::floating_point T>
+class SlidingMoments {
+    HistoryBuffer<T>   _history;
+    detail::Moments<T> _moments{};
+    std::size_t        _samplesSinceResync = 0UZ;
+
+    void add(const detail::Moments<T>& other) noexcept {
+        const std::size_t n     = _moments.n + other.n;
+        const T           delta = other.mean - _moments.mean;
+        _moments.m2 += other.m2 + delta * delta * static_cast<T>(_moments.n) * static_cast<T>(other.n) / static_cast<T>(n);
+        _moments.mean += delta * static_cast<T>(other.n) / static_cast<T>(n);
+        _moments.n = n;
+    }
+
+    void remove(const detail::Moments<T>& other) noexcept {
+        const std::size_t n = _moments.n - other.n;
+        if (n == 0UZ) {
+            _moments = {};
+            return;
+        }
+        const T mean  = _moments.mean + (_moments.mean - other.mean) * static_cast<T>(other.n) / static_cast<T>(n);
+        const T delta = other.mean - mean;
+        _moments.m2   = std::max(T(0), _moments.m2 - other.m2 - delta * delta * static_cast<T>(n) * static_cast<T>(other.n) / static_cast<T>(_moments.n));
+        _moments.mean = mean;
+        _moments.n    = n;
+    }
+
+    void resync() noexcept {
+        _moments            = detail::moments(_history.get_span(0UZ));
+        _samplesSinceResync = 0UZ;
+    }
+
+public:
+    explicit SlidingMoments(std::size_t windowSize = 1UZ) : _history(windowSize) {}
+
+    [[nodiscard]] std::size_t windowSize() const noexcept { return _history.capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return _history.size(); }
+
+    void reset() noexcept {
+        _history.reset();
+        _moments            = {};
+        _samplesSinceResync = 0UZ;
+    }
+
+    void push_back(T value) noexcept {
+        if (_history.size() == _history.capacity()) { // replace the oldest sample
+            const T oldest  = _history[_history.size() - 1UZ];
+            const T delta   = value - oldest;
+            const T oldMean = _moments.mean;
+            _moments.mean += delta / static_cast<T>(_moments.n);
+            _moments.m2 = std::max(T(0), _moments.m2 + delta * (value - _moments.mean + oldest - oldMean));
+        } else { // Welford
+            ++_moments.n;
+            const T delta = value - _moments.mean;
+            _moments.mean += delta / static_cast<T>(_moments.n);
+            _moments.m2 += delta * (value - _moments.mean);
+        }
+        _history.push_back(value);
+
+        if (++_samplesSinceResync >= _history.capacity()) {
+            resync();
+        }
+    }
+
+    void push_back_bulk(std::span<const T> values) noexcept {
+        if (values.size() >= _history.capacity()) { // window is completely replaced
+            _history.push_back_bulk(values.begin(), values.end());
+            resync();
+            return;
+        }
+
+        const std::size_t nExpired = std::max(_history.size() + values.size(), _history.capacity()) - _history.capacity();
+        if (nExpired > 0UZ) {
+            remove(detail::moments(_history.get_span(_history.size() - nExpired, nExpired)));
+        }
+        add(detail::moments(values));
+        _history.push_back_bulk(values.begin(), values.end());
+
+        _samplesSinceResync += values.size();
+        if (_samplesSinceResync >= _history.capacity()) {
+            resync();
+        }
+    }
+
+    [[nodiscard]] T mean() const noexcept { return _moments.mean; }
+    [[nodiscard]] T variance() const noexcept { return _moments.n == 0UZ ? T(0) : _moments.m2 / static_cast<T>(_moments.n); } // N.B. population variance
+    [[nodiscard]] T stddev() const noexcept { return std::sqrt(variance()); }
+    [[nodiscard]] T rms() const noexcept { return std::sqrt(_moments.mean * _moments.mean + variance()); }
+};
+
+/**
+ * @brief Minimum (Compare = std::less<>) or maximum (Compare = std::greater<>) over a sliding window with amortised O(1) updates.
+ *
+ * Keeps a monotonic deque of the candidates that may still become the extremum, i.e. each sample is inserted and removed at most
+ * once. The deque is a fixed-capacity ring (no allocations after construction).
+ */
+template<typename T, typename Compare = std::less<>>
+class SlidingExtremum {
+    struct Entry {
+        std::size_t index;
+        T           value;
+    };
+    std::vector<Entry> _ring;
+    std::size_t        _front = 0UZ; // ring position of the current extremum
+    std::size_t        _count = 0UZ; // number of candidates in the deque
+    std::size_t        _index = 0UZ; // running sample index
+    std::size_t        _size  = 0UZ; // number of samples in the window
+    [[no_unique_address]] Compare _compare{};
+
+    [[nodiscard]] std::size_t position(std::size_t offset) const noexcept { return (_front + offset) % _ring.size(); }
+
+public:
+    explicit SlidingExtremum(std::size_t windowSize = 1UZ) : _ring(windowSize) {
+        if (windowSize == 0UZ) {
+            throw std::out_of_range("window size is zero");
+        }
+    }
+
+    [[nodiscard]] std::size_t windowSize() const noexcept { return _ring.size(); }
+    [[nodiscard]] std::size_t size() const noexcept { return _size; }
+
+    void reset() noexcept {
+        _front = 0UZ;
+        _count = 0UZ;
+        _index = 0UZ;
+        _size  = 0UZ;
+    }
+
+    void push_back(T value) noexcept {
+        while (_count > 0UZ && !_compare(_ring[position(_count - 1UZ)].value, value)) { // drop candidates that can no longer win
+            --_count;
+        }
+        if (_count > 0UZ && _ring[_front].index + _ring.size() <= _index) { // expire the oldest candidate
+            _front = position(1UZ);
+            --_count;
+        }
+        _ring[position(_count)] = Entry{_index, value};
+        ++_count;
+        ++_index;
+        _size = std::min(_size + 1UZ, _ring.size());
+    }
+
+    void push_back_bulk(std::span<const T> values) noexcept {
+        if (values.size() >= _ring.size()) { // window is completely replaced, older samples cannot affect the result
+            reset();
+            values = values.last(_ring.size());
+        }
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    [[nodiscard]] T value() const noexcept { return _count == 0UZ ? T(0) : _ring[_front].value; }
+};
+
+template<typename T>
+using SlidingMinimum = SlidingExtremum<T, std::less<>>;
+template<typename T>
+using SlidingMaximum = SlidingExtremum<T, std::greater<>>;
+
+/**
+ * @brief Exact quantile (e.g. median for q = 0.5) over a sliding window with O(log(windowSize)) updates.
+ *
+ * The window is split into two ordered multi-sets ('two-heap' scheme with O(log N) removal of expired samples): 'lower' holds the
+ * floor(q * (N - 1)) + 1 smallest samples, 'upper' the remainder. The quantile is linearly interpolated between the largest 'lower'
+ * and the smallest 'upper' sample (i.e. the default definition of numpy/R type 7). N.B. NaN samples are not supported.
+ */
+template<std::floating_point T>
+class SlidingQuantile {
+    HistoryBuffer<T> _history;
+    std::multiset<T> _lower;
+    std::multiset<T> _upper;
+    T                _quantile;
+
+    [[nodiscard]] std::size_t lowerSize() const noexcept { return static_cast<std::size_t>(std::floor(_quantile * static_cast<T>(_history.size() - 1UZ))) + 1UZ; }
+
+    void rebalance() {
+        const std::size_t target = lowerSize();
+        while (_lower.size() > target) {
+            _upper.insert(_upper.begin(), _lower.extract(std::prev(_lower.end())));
+        }
+        while (_lower.size() < target && !_upper.empty()) {
+            _lower.insert(_lower.end(), _upper.extract(_upper.begin()));
+        }
+    }
+
+public:
+    explicit SlidingQuantile(std::size_t windowSize = 1UZ, T quantile = T(0.5)) : _history(windowSize), _quantile(std::clamp(quantile, T(0), T(1))) {}
+
+    [[nodiscard]] std::size_t windowSize() const noexcept { return _history.capacity(); }
+    [[nodiscard]] std::size_t size() const noexcept { return _history.size(); }
+    [[nodiscard]] T           quantile() const noexcept { return _quantile; }
+
+    void reset() noexcept {
+        _history.reset();
+        _lower.clear();
+        _upper.clear();
+    }
+
+    void push_back(T value) {
+        if (_history.size() == _history.capacity()) { // expire the oldest sample
+            const T oldest = _history[_history.size() - 1UZ];
+            if (auto it = _lower.find(oldest); it != _lower.end()) {
+                _lower.erase(it);
+            } else if (auto jt = _upper.find(oldest); jt != _upper.end()) {
+                _upper.erase(jt);
+            }
+        }
+        if (_lower.empty() ? (_upper.empty() || !(*_upper.begin() < value)) : !(*std::prev(_lower.end()) < value)) { // value <= max(lower) resp. min(upper)
+            _lower.insert(value);
+        } else {
+            _upper.insert(value);
+        }
+        _history.push_back(value);
+        rebalance();
+    }
+
+    void push_back_bulk(std::span<const T> values) {
+        for (const T& value : values) {
+            push_back(value);
+        }
+    }
+
+    [[nodiscard]] T value() const noexcept {
+        if (_lower.empty()) {
+            return T(0);
+        }
+        const T position = _quantile * static_cast<T>(_history.size() - 1UZ);
+        const T fraction = position - std::floor(position);
+        const T lower    = *std::prev(_lower.end());
+        return (fraction > T(0) && !_upper.empty()) ? lower + fraction * (*_upper.begin() - lower) : lower;
+    }
+};
+
+} // namespace gr::algorithm
+
+#endif // GNURADIO_ALGORITHM_SLIDINGWINDOWSTATISTICS_HPP
@@ -247,6 +247,67 @@ struct Filter<T, bufferSize, form, execPolicy> {
     }
 };
 
+/**
+ * @brief: IIR/FIR filter evaluating V::size() independent channels (SIMD lanes) that share the same filter coefficients as one recurrence,
+ * e.g. the same low-pass applied to many phases or signals.
+ *
+ * N.B. the sections are always evaluated in direct-form II transposed (i.e. one multiply-add per coefficient for all lanes), 'form' is ignored.
+ *
+ * usage example:
+ * Filter<vir::stdx::fixed_size_simd<float, 9>> myFilter(filterSections);
+ * auto outputSamples = myFilter.processOne(inputSamples); // filters all 9 lanes at once
+ */
+template<typename V, std::size_t bufferSize, Form form, auto execPolicy>
+requires(meta::any_simd<V>)
+struct Filter<V, bufferSize, form, execPolicy> {
+    using TBaseType = typename V::value_type;
+
+    struct LaneSection {
+        std::vector<TBaseType> b; // N.B. 'b' and 'a' are zero-padded to the same length, a[0] == 1
+        std::vector<TBaseType> a;
+        std::vector<V>         state;
+    };
+    std::vector<LaneSection> _sections;
+
+    constexpr Filter() noexcept : Filter(FilterCoefficients<TBaseType>{.b = {1}, .a = {1}}) {}
+
+    template<typename... TFilterCoefficients>
+    explicit Filter(TFilterCoefficients&&... filterSections) noexcept {
+        std::vector<FilterCoefficients<TBaseType>> filterSections_{std::forward<TFilterCoefficients>(filterSections)...};
+        _sections.reserve(filterSections_.size());
+        for (const auto& section : filterSections_) {
+            const std::size_t length = std::max(section.a.size(), section.b.size());
+            LaneSection       laneSection{.b = section.b, .a = section.a, .state = std::vector<V>(length - 1UZ, V(0))};
+            laneSection.b.resize(length, TBaseType(0));
+            laneSection.a.resize(length, TBaseType(0));
+            _sections.push_back(std::move(laneSection));
+        }
+    }
+
+    constexpr void reset(V defaultValue = V()) {
+        std::ranges::for_each(_sections, [&defaultValue](auto& section) { std::ranges::fill(section.state, defaultValue); });
+    }
+
+    [[nodiscard]] inline constexpr V processOne(V input) noexcept {
+        for (auto& [b, a, state] : _sections) {
+            // y[n]   = b[0]·x[n] + z_0[n-1]
+            // z_k[n] = b[k+1]·x[n] - a[k+1]·y[n] + z_{k+1}[n-1]
+            const std::size_t nState = state.size();
+            if (nState == 0UZ) {
+                input = b[0] * input;
+                continue;
+            }
+            const V output = b[0] * input + state[0];
+            for (std::size_t k = 0UZ; k + 1UZ < nState; ++k) {
+                state[k] = b[k + 1UZ] * input - a[k + 1UZ] * output + state[k + 1UZ];
+            }
+            state[nState - 1UZ] = b[nState] * input - a[nState] * output;
+            input               = output;
+        }
+        return input;
+    }
+};
+
 /**
  * @brief: Infinite-Impulse-Response (IIR) as well as Finite-Impulse-Response (FIR) filter based on a single or set of biquad filter coefficients.
  *
@@ -266,6 +327,7 @@ struct Filter<UncertainValue<T>, bufferSize, form, execPolicy> {
     using TBaseType = meta::fundamental_base_value_type_t<T>;
     alignas(64UZ) std::vector<detail::Section<TBaseType, bufferSize>> _sectionsMeanValue;
     alignas(64UZ) std::vector<detail::Section<TBaseType, bufferSize>> _sectionsSquareUncertaintyValue;
+    std::vector<TBaseType>                                            _weightedSigma; // a[j]·σ_y[j] scratch buffer, sized for the longest feedback path
 
     [[nodiscard]] inline constexpr TBaseType propagateError(const TBaseType& inputUncertainty, detail::Section<TBaseType, bufferSize>& section) noexcept {
         const auto& a                       = section.a;
@@ -285,13 +347,19 @@ struct Filter<UncertainValue<T>, bufferSize, form, execPolicy> {
         }
 
         // Feedback path (correlated uncertainties)
+        // N.B. σ_y[j] is evaluated once per sample (rather than per (j,k) pair) and the double sum uses the symmetry R_{yy}[|j-k|] = R_{yy}[|k-j|]
+        // w/o causality (i.e. causality j - k < 0 -> autoC = 0.0), this is a conservative estimate, to be checked
+        const std::size_t nFeedback = a.size() - 1UZ;
+        for (std::size_t j = 0UZ; j < nFeedback; ++j) {
+            _weightedSigma[j] = a[j + 1UZ] * std::sqrt(outputHistory[j]);
+        }
         TBaseType feedbackUncertainty = 0;
-        for (std::size_t j = 1; j < a.size(); ++j) {
-            for (std::size_t k = 1; k < a.size(); ++k) {
-                int       jk{std::abs(static_cast<int>(j) - static_cast<int>(k))};
-                TBaseType correlationFactor = autocorrelationFunction[static_cast<std::size_t>(jk)]; // w/o causality (i.e. causality j - k < 0 -> autoC = 0.0), this is a conservative estimate, to be checked
-                feedbackUncertainty += a[j] * a[k] * correlationFactor * std::sqrt(outputHistory[j - 1]) * std::sqrt(outputHistory[k - 1]);
+        for (std::size_t j = 0UZ; j < nFeedback; ++j) {
+            TBaseType crossTerms = 0;
+            for (std::size_t k = j + 1UZ; k < nFeedback; ++k) {
+                crossTerms += autocorrelationFunction[k - j] * _weightedSigma[k];
             }
+            feedbackUncertainty += _weightedSigma[j] * (autocorrelationFunction[0] * _weightedSigma[j] + TBaseType(2) * crossTerms);
         }
 
         TBaseType totalUncertainty = feedForwardUncertainty + feedbackUncertainty;
@@ -309,6 +377,7 @@ struct Filter<UncertainValue<T>, bufferSize, form, execPolicy> {
         for (const auto& section : filterSections_) {
             _sectionsMeanValue.emplace_back(section);
             _sectionsSquareUncertaintyValue.emplace_back(section);
+            _weightedSigma.resize(std::max(_weightedSigma.size(), section.a.size()));
         }
     }
 
@@ -11,6 +11,7 @@ template<typename TInput, typename TOutput = std::conditional<gr::meta::complex_
 requires((gr::meta::complex_like<TInput> || std::floating_point<TInput>) && (gr::meta::complex_like<TOutput>))
 struct FFT {
     using Precision = TOutput::value_type;
+    using simd_type = vir::stdx::native_simd<Precision>;
 
     std::vector<TOutput> twiddleFactors{};
     std::size_t          fftSize{0};
@@ -25,13 +26,20 @@ struct FFT {
 
     void initAll() { precomputeTwiddleFactors(); }
 
-    auto compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
+    /**
+     * @brief computes the FFT of `in` into the user-provided `out` range.
+     *
+     * If `out` is passed as an lvalue, the (resized if necessary) container is returned by reference and no further
+     * allocation takes place once its capacity matches the FFT size (i.e. zero-allocation steady-state use).
+     */
+    template<std::ranges::input_range TContainerIn, std::ranges::output_range<TOutput> TContainerOut>
+    TContainerOut compute(const TContainerIn& in, TContainerOut&& out) {
         if constexpr (requires(std::size_t n) { out.resize(n); }) {
             if (out.size() != in.size()) {
                 out.resize(in.size());
             }
-        } else {
-            static_assert(std::tuple_size_v<decltype(in)> == std::tuple_size_v<decltype(out)>, "Size mismatch for fixed-size container.");
+        } else if (std::ranges::size(out) < std::ranges::size(in)) { // fixed-size container or non-owning span
+            throw std::out_of_range(fmt::format("Output range size ({}) is not enough, at least {} needed.", std::ranges::size(out), std::ranges::size(in)));
         }
 
         if (!std::has_single_bit(in.size())) {
@@ -74,13 +82,113 @@ struct FFT {
             }
         }
 
+        return std::forward<TContainerOut>(out);
+    }
+
+    auto compute(const std::ranges::input_range auto& in) {
+        std::vector<TOutput> out(in.size());
+        compute(in, out);
         return out;
     }
 
-    auto compute(const std::ranges::input_range auto& in) { return compute(in, std::vector<TOutput>(in.size())); }
+    /**
+     * @brief computes `nTransforms` independent FFTs of size `in.size() / nTransforms` in one call.
+     *
+     * The input (and output) frames are stored back-to-back, i.e. frame `i` occupies `[i * fftSize, (i + 1) * fftSize)`.
+     * The transforms are vectorised across frames: up to `simd_type::size()` frames are transposed into a structure-of-array
+     * layout and share the same butterfly and twiddle-factor sequence, each SIMD lane holding a different frame.
+     */
+    template<std::ranges::random_access_range TContainerIn, std::ranges::random_access_range TContainerOut>
+    requires std::ranges::output_range<TContainerOut, TOutput>
+    TContainerOut computeBatch(const TContainerIn& in, TContainerOut&& out, std::size_t nTransforms) {
+        const std::size_t totalSize = std::ranges::size(in);
+        if (nTransforms == 0UZ || totalSize % nTransforms != 0UZ) {
+            throw std::invalid_argument(fmt::format("Input size {} is not a multiple of the number of transforms {}", totalSize, nTransforms));
+        }
+        if constexpr (requires(std::size_t n) { out.resize(n); }) {
+            if (out.size() != totalSize) {
+                out.resize(totalSize);
+            }
+        } else if (std::ranges::size(out) < totalSize) { // fixed-size container or non-owning span
+            throw std::out_of_range(fmt::format("Output range size ({}) is not enough, at least {} needed.", std::ranges::size(out), totalSize));
+        }
+
+        const std::size_t size = totalSize / nTransforms;
+        if (!std::has_single_bit(size)) {
+            throw std::invalid_argument(fmt::format("Input data must have 2^N samples per transform, transform size: {}", size));
+        }
+        if (fftSize != size) {
+            fftSize = size;
+            initAll();
+        }
+        _batchReal.resize(fftSize);
+        _batchImag.resize(fftSize);
+
+        constexpr std::size_t kWidth = simd_type::size();
+        for (std::size_t first = 0UZ; first < nTransforms; first += kWidth) {
+            const std::size_t nLanes = std::min(kWidth, nTransforms - first);
+
+            // transpose frames [first, first + nLanes) into SoA layout, unused lanes are zero-padded
+            for (std::size_t i = 0UZ; i < fftSize; i++) {
+                _batchReal[i] = simd_type([&](auto lane) { return lane < nLanes ? realPart(in[(first + lane) * fftSize + i]) : Precision(0); });
+                _batchImag[i] = simd_type([&](auto lane) { return lane < nLanes ? imagPart(in[(first + lane) * fftSize + i]) : Precision(0); });
+            }
+
+            bitReversalPermutation(_batchReal);
+            bitReversalPermutation(_batchImag);
+
+            std::size_t omega_kCounter = 0;
+            for (std::size_t s = 2; s <= fftSize; s *= 2) {
+                const auto half_s = s / 2;
+                for (std::size_t k = 0; k < fftSize; k += s) {
+                    for (std::size_t j = 0; j < half_s; j++) {
+                        const TOutput   w = twiddleFactors[omega_kCounter++];
+                        const simd_type tReal{w.real() * _batchReal[k + j + half_s] - w.imag() * _batchImag[k + j + half_s]};
+                        const simd_type tImag{w.real() * _batchImag[k + j + half_s] + w.imag() * _batchReal[k + j + half_s]};
+                        const simd_type uReal{_batchReal[k + j]};
+                        const simd_type uImag{_batchImag[k + j]};
+                        _batchReal[k + j]          = uReal + tReal;
+                        _batchImag[k + j]          = uImag + tImag;
+                        _batchReal[k + j + half_s] = uReal - tReal;
+                        _batchImag[k + j + half_s] = uImag - tImag;
+                    }
+                }
+            }
+
+            // transpose back into back-to-back frames
+            for (std::size_t lane = 0UZ; lane < nLanes; lane++) {
+                const std::size_t offset = (first + lane) * fftSize;
+                for (std::size_t i = 0UZ; i < fftSize; i++) {
+                    out[offset + i] = TOutput(_batchReal[i][lane], _batchImag[i][lane]);
+                }
+            }
+        }
+
+        return std::forward<TContainerOut>(out);
+    }
 
 private:
-    void bitReversalPermutation(std::vector<TOutput>& vec) const noexcept {
+    std::vector<simd_type> _batchReal{}; // SoA scratch buffers for the batched transform
+    std::vector<simd_type> _batchImag{};
+
+    [[nodiscard]] static constexpr Precision realPart(const auto& value) noexcept {
+        if constexpr (gr::meta::complex_like<TInput>) {
+            return static_cast<Precision>(value.real());
+        } else {
+            return static_cast<Precision>(value);
+        }
+    }
+
+    [[nodiscard]] static constexpr Precision imagPart(const auto& value) noexcept {
+        if constexpr (gr::meta::complex_like<TInput>) {
+            return static_cast<Precision>(value.imag());
+        } else {
+            return Precision(0);
+        }
+    }
+
+    template<std::ranges::random_access_range TContainer>
+    void bitReversalPermutation(TContainer& vec) const noexcept {
         for (std::size_t j = 0, rev = 0; j < fftSize; j++) {
             if (j < rev) {
                 std::swap(vec[j], vec[rev]);
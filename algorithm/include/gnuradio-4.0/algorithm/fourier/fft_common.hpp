@@ -18,19 +18,18 @@ struct ConfigMagnitude {
 
 template<std::ranges::input_range TContainerIn, std::ranges::output_range<typename TContainerIn::value_type::value_type> TContainerOut = std::vector<typename TContainerIn::value_type::value_type>, typename T = TContainerIn::value_type>
 requires(std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
-auto computeMagnitudeSpectrum(const TContainerIn& fftIn, TContainerOut&& magOut = {}, ConfigMagnitude config = {}) {
+TContainerOut computeMagnitudeSpectrum(const TContainerIn& fftIn, TContainerOut&& magOut = {}, ConfigMagnitude config = {}) {
     const std::size_t fftSize = fftIn.size();
     if (fftSize == 0) {
         throw std::invalid_argument("fftIn cannot be empty.");
     }
     const std::size_t magSize = config.computeHalfSpectrum ? (fftSize / 2UZ) : fftSize;
-    ;
     if constexpr (requires(std::size_t n) { magOut.resize(n); }) {
         if (magOut.size() != magSize) {
             magOut.resize(magSize);
         }
-    } else {
-        static_assert(std::tuple_size_v<TContainerIn> == std::tuple_size_v<TContainerOut>, "Size mismatch for fixed-size container.");
+    } else if (std::ranges::size(magOut) < magSize) { // fixed-size container or non-owning span
+        throw std::out_of_range(fmt::format("magOut size ({}) is not enough, at least {} needed.", std::ranges::size(magOut), magSize));
     }
 
     using PrecisionType = typename T::value_type;
@@ -44,7 +43,7 @@ auto computeMagnitudeSpectrum(const TContainerIn& fftIn, TContainerOut&& magOut
         return mag;
     });
 
-    return magOut;
+    return std::forward<TContainerOut>(magOut);
 }
 
 template<std::ranges::input_range TContainerIn, typename T = TContainerIn::value_type>
@@ -81,16 +80,16 @@ void unwrapPhase(TContainerInOut& phase) {
 
 template<std::ranges::input_range TContainerIn, std::ranges::output_range<typename TContainerIn::value_type::value_type> TContainerOut = std::vector<typename TContainerIn::value_type::value_type>, typename T = TContainerIn::value_type>
 requires(std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>)
-auto computePhaseSpectrum(const TContainerIn& fftIn, TContainerOut&& phaseOut = {}, ConfigPhase config = {}) {
+TContainerOut computePhaseSpectrum(const TContainerIn& fftIn, TContainerOut&& phaseOut = {}, ConfigPhase config = {}) {
     std::size_t phaseSize = config.computeHalfSpectrum ? (fftIn.size() / 2) : fftIn.size();
     if constexpr (requires(std::size_t n) { phaseOut.resize(n); }) {
         if (phaseOut.size() != phaseSize) {
             phaseOut.resize(phaseSize);
         }
-    } else {
-        static_assert(std::tuple_size_v<TContainerIn> == std::tuple_size_v<TContainerOut>, "Size mismatch for fixed-size container.");
+    } else if (std::ranges::size(phaseOut) < phaseSize) { // fixed-size container or non-owning span
+        throw std::out_of_range(fmt::format("phaseOut size ({}) is not enough, at least {} needed.", std::ranges::size(phaseOut), phaseSize));
     }
-    std::transform(fftIn.begin(), std::next(fftIn.begin(), static_cast<std::ptrdiff_t>(phaseOut.size())), phaseOut.begin(), [](const auto& c) { return std::atan2(c.imag(), c.real()); });
+    std::transform(fftIn.begin(), std::next(fftIn.begin(), static_cast<std::ptrdiff_t>(phaseSize)), phaseOut.begin(), [](const auto& c) { return std::atan2(c.imag(), c.real()); });
 
     if (config.unwrapPhase) {
         unwrapPhase(phaseOut);
@@ -100,7 +99,7 @@ auto computePhaseSpectrum(const TContainerIn& fftIn, TContainerOut&& phaseOut =
         std::ranges::transform(phaseOut, phaseOut.begin(), [](const auto& phase) { return phase * static_cast<typename T::value_type>(180.) * std::numbers::inv_pi_v<typename T::value_type>; });
     }
 
-    return phaseOut;
+    return std::forward<TContainerOut>(phaseOut);
 }
 
 template<std::ranges::input_range TContainerIn, typename T = TContainerIn::value_type>
@@ -93,6 +93,13 @@ public:
                 return fftwf_plan_dft_1d(p_n, p_in, p_out, p_sign, p_flags);
             }
         }
+        static PlanType planMany(int p_n, int p_howMany, InAlgoDataType *p_in, OutAlgoDataType *p_out, int p_sign, unsigned int p_flags) {
+            if constexpr (std::is_same_v<InAlgoDataType, float>) {
+                return fftwf_plan_many_dft_r2c(1, &p_n, p_howMany, p_in, nullptr, 1, p_n, p_out, nullptr, 1, p_n / 2 + 1, p_flags);
+            } else {
+                return fftwf_plan_many_dft(1, &p_n, p_howMany, p_in, nullptr, 1, p_n, p_out, nullptr, 1, p_n, p_sign, p_flags);
+            }
+        }
         static int importWisdomFromFilename(const std::string& path) {return fftwf_import_wisdom_from_filename(path.c_str());}
         static int exportWisdomToFilename(const std::string& path) {return fftwf_export_wisdom_to_filename(path.c_str());}
         static int importWisdomFromString(const std::string& str) {return fftwf_import_wisdom_from_string(str.c_str());}
@@ -127,6 +134,13 @@ public:
                 return fftw_plan_dft_1d(p_n, p_in, p_out, p_sign, p_flags);
             }
         }
+        static PlanType planMany(int p_n, int p_howMany, InAlgoDataType *p_in, OutAlgoDataType *p_out, int p_sign, unsigned int p_flags) {
+            if constexpr (std::is_same_v<InAlgoDataType, double>) {
+                return fftw_plan_many_dft_r2c(1, &p_n, p_howMany, p_in, nullptr, 1, p_n, p_out, nullptr, 1, p_n / 2 + 1, p_flags);
+            } else {
+                return fftw_plan_many_dft(1, &p_n, p_howMany, p_in, nullptr, 1, p_n, p_out, nullptr, 1, p_n, p_sign, p_flags);
+            }
+        }
         static int importWisdomFromFilename(const std::string& path) {return fftw_import_wisdom_from_filename(path.c_str());}
         static int exportWisdomToFilename(const std::string& path) {return fftw_export_wisdom_to_filename(path.c_str());}
         static int importWisdomFromString(const std::string& str) {return fftw_import_wisdom_from_string(str.c_str());}
@@ -156,6 +170,12 @@ public:
     InUniquePtr   fftwIn{};
     OutUniquePtr  fftwOut{};
     PlanUniquePtr fftwPlan{};
+    // batched transforms ('plan_many') use their own buffers and plan
+    std::size_t   batchFftSize{0};
+    std::size_t   batchCount{0};
+    InUniquePtr   fftwBatchIn{};
+    OutUniquePtr  fftwBatchOut{};
+    PlanUniquePtr fftwBatchPlan{};
 
     FFTw()                               = default;
     FFTw(const FFTw& rhs)                = delete;
@@ -165,13 +185,20 @@ public:
 
     ~FFTw() { clearFftw(); }
 
-    auto compute(const std::ranges::input_range auto& in, std::ranges::output_range<TOutput> auto&& out) {
+    /**
+     * @brief computes the FFT of `in` into the user-provided `out` range.
+     *
+     * If `out` is passed as an lvalue, the (resized if necessary) container is returned by reference and no further
+     * allocation takes place once its capacity matches the FFT size (i.e. zero-allocation steady-state use).
+     */
+    template<std::ranges::input_range TContainerIn, std::ranges::output_range<TOutput> TContainerOut>
+    TContainerOut compute(const TContainerIn& in, TContainerOut&& out) {
         if constexpr (requires(std::size_t n) { out.resize(n); }) {
             if (out.size() != in.size()) {
                 out.resize(in.size());
             }
-        } else {
-            static_assert(std::tuple_size_v<decltype(in)> == std::tuple_size_v<decltype(out)>, "Size mismatch for fixed-size container.");
+        } else if (std::ranges::size(out) < std::ranges::size(in)) { // fixed-size container or non-owning span
+            throw std::out_of_range(fmt::format("Output range size ({}) is not enough, at least {} needed.", std::ranges::size(out), std::ranges::size(in)));
         }
 
         if (!std::has_single_bit(in.size())) {
@@ -209,13 +236,78 @@ public:
         if (!gr::meta::complex_like<TInput>) {
             const auto halfIt = std::next(out.begin(), static_cast<std::ptrdiff_t>(fftSize / 2));
             std::ranges::transform(out.begin(), halfIt, halfIt, [](auto c) { return std::conj(c); });
-            std::reverse(halfIt, out.end());
+            std::reverse(halfIt, std::next(out.begin(), static_cast<std::ptrdiff_t>(fftSize)));
         }
 
+        return std::forward<TContainerOut>(out);
+    }
+
+    auto compute(const std::ranges::input_range auto& in) {
+        std::vector<TOutput> out(in.size());
+        compute(in, out);
         return out;
     }
 
-    auto compute(const std::ranges::input_range auto& in) { return compute(in, std::vector<TOutput>()); }
+    /**
+     * @brief computes `nTransforms` independent FFTs of size `in.size() / nTransforms` in one call using FFTW's 'plan_many' interface.
+     *
+     * The input (and output) frames are stored back-to-back, i.e. frame `i` occupies `[i * fftSize, (i + 1) * fftSize)`.
+     * The plan is only re-created if the transform size or number of transforms changes.
+     */
+    template<std::ranges::random_access_range TContainerIn, std::ranges::random_access_range TContainerOut>
+    requires std::ranges::output_range<TContainerOut, TOutput>
+    TContainerOut computeBatch(const TContainerIn& in, TContainerOut&& out, std::size_t nTransforms) {
+        const std::size_t totalSize = std::ranges::size(in);
+        if (nTransforms == 0UZ || totalSize % nTransforms != 0UZ) {
+            throw std::invalid_argument(fmt::format("Input size {} is not a multiple of the number of transforms {}", totalSize, nTransforms));
+        }
+        if constexpr (requires(std::size_t n) { out.resize(n); }) {
+            if (out.size() != totalSize) {
+                out.resize(totalSize);
+            }
+        } else if (std::ranges::size(out) < totalSize) { // fixed-size container or non-owning span
+            throw std::out_of_range(fmt::format("Output range size ({}) is not enough, at least {} needed.", std::ranges::size(out), totalSize));
+        }
+
+        const std::size_t size = totalSize / nTransforms;
+        if (!std::has_single_bit(size)) {
+            throw std::invalid_argument(fmt::format("Input data must have 2^N samples per transform, transform size: {}", size));
+        }
+        if (batchFftSize != size || batchCount != nTransforms) {
+            batchFftSize = size;
+            batchCount   = nTransforms;
+            initBatch();
+        }
+
+        // precision is defined by output type, if needed cast input
+        if constexpr (!std::is_same_v<TInput, AlgoDataType>) {
+            std::span<AlgoDataType> inSpan(reinterpret_cast<AlgoDataType*>(fftwBatchIn.get()), totalSize);
+            std::ranges::transform(in.begin(), in.end(), inSpan.begin(), [](const auto c) { return static_cast<AlgoDataType>(c); });
+        } else {
+            std::memcpy(fftwBatchIn.get(), &(*in.begin()), sizeof(InAlgoDataType) * totalSize);
+        }
+
+        FFTwImpl<AlgoDataType>::execute(fftwBatchPlan.get());
+
+        const std::size_t outSize = getOutputSize(batchFftSize);
+        for (std::size_t i = 0UZ; i < nTransforms; i++) {
+            const auto frameBegin = std::next(out.begin(), static_cast<std::ptrdiff_t>(i * batchFftSize));
+#pragma GCC diagnostic push
+#ifndef __clang__
+#pragma GCC diagnostic ignored "-Wclass-memaccess"
+#endif
+            std::memcpy(std::addressof(*frameBegin), fftwBatchOut.get() + i * outSize, sizeof(TOutput) * outSize);
+#pragma GCC diagnostic pop
+            // for the real input to complex a Hermitian output is produced by fftw, perform mirroring and conjugation fftw spectra to the second half
+            if (!gr::meta::complex_like<TInput>) {
+                const auto halfIt = std::next(frameBegin, static_cast<std::ptrdiff_t>(batchFftSize / 2));
+                std::ranges::transform(frameBegin, halfIt, halfIt, [](auto c) { return std::conj(c); });
+                std::reverse(halfIt, std::next(frameBegin, static_cast<std::ptrdiff_t>(batchFftSize)));
+            }
+        }
+
+        return std::forward<TContainerOut>(out);
+    }
 
     [[nodiscard]] inline int importWisdom() const {
         // lock file while importing wisdom?
@@ -234,16 +326,18 @@ public:
     inline void forgetWisdom() const { return FFTwImpl<AlgoDataType>::forgetWisdom(); }
 
 private:
-    [[nodiscard]] constexpr std::size_t getOutputSize() const {
+    [[nodiscard]] constexpr std::size_t getOutputSize() const { return getOutputSize(fftSize); }
+
+    [[nodiscard]] static constexpr std::size_t getOutputSize(std::size_t size) {
         if constexpr (gr::meta::complex_like<TInput>) {
-            return fftSize;
+            return size;
         } else {
-            return 1 + fftSize / 2;
+            return 1 + size / 2;
         }
     }
 
     void initAll() {
-        clearFftw();
+        clearFftwSingle();
         fftwIn  = InUniquePtr(static_cast<InAlgoDataType*>(FFTwImpl<AlgoDataType>::malloc(sizeof(InAlgoDataType) * fftSize)));
         fftwOut = OutUniquePtr(static_cast<OutAlgoDataType*>(FFTwImpl<AlgoDataType>::malloc(sizeof(OutAlgoDataType) * getOutputSize())));
 
@@ -256,7 +350,25 @@ private:
         }
     }
 
+    void initBatch() {
+        clearFftwBatch();
+        fftwBatchIn  = InUniquePtr(static_cast<InAlgoDataType*>(FFTwImpl<AlgoDataType>::malloc(sizeof(InAlgoDataType) * batchFftSize * batchCount)));
+        fftwBatchOut = OutUniquePtr(static_cast<OutAlgoDataType*>(FFTwImpl<AlgoDataType>::malloc(sizeof(OutAlgoDataType) * getOutputSize(batchFftSize) * batchCount)));
+
+        {
+            std::lock_guard lg{fftw_plan_mutex};
+            std::ignore   = importWisdom();
+            fftwBatchPlan = PlanUniquePtr(FFTwImpl<AlgoDataType>::planMany(static_cast<int>(batchFftSize), static_cast<int>(batchCount), fftwBatchIn.get(), fftwBatchOut.get(), sign, flags));
+            std::ignore   = exportWisdom();
+        }
+    }
+
     void clearFftw() {
+        clearFftwSingle();
+        clearFftwBatch();
+    }
+
+    void clearFftwSingle() {
         {
             std::lock_guard lg{fftw_plan_mutex};
             fftwPlan.reset();
@@ -264,6 +376,15 @@ private:
         fftwIn.reset();
         fftwOut.reset();
     }
+
+    void clearFftwBatch() {
+        {
+            std::lock_guard lg{fftw_plan_mutex};
+            fftwBatchPlan.reset();
+        }
+        fftwBatchIn.reset();
+        fftwBatchOut.reset();
+    }
 };
 
 } // namespace gr::algorithm
@@ -5,9 +5,13 @@
 #include <algorithm>
 #include <array>
 #include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <numbers>
 #include <ranges>
 #include <string_view>
+#include <tuple>
 #include <vector>
 
 #include <fmt/format.h>
@@ -205,6 +209,40 @@ requires std::is_floating_point_v<T>
 template void create<std::vector<float>>(std::vector<float>& container, Type windowFunction, float beta);
 template void create<std::vector<double>>(std::vector<double>& container, Type windowFunction, double beta);
 
+/**
+ * @brief Returns a shared, immutable window function from a process-wide and thread-safe cache.
+ *
+ * Windows are keyed by (type, size, beta, precision `T`) so that blocks with identical configurations (e.g. many FFT blocks
+ * with the same size and window type) share the same storage and do not need to recompute expensive windows (e.g. Kaiser)
+ * during reconfiguration. The cache only holds weak references, i.e. the storage is released once the last user drops it.
+ *
+ * @tparam T The floating-point type to use for the window function values.
+ * @param windowFunction The type of window function to create.
+ * @param n The size of the window function.
+ * @param beta Shape parameter (only used for Type::Kaiser).
+ * @return A std::shared_ptr to the immutable window function values.
+ */
+template<typename T = float>
+requires std::is_floating_point_v<T>
+[[nodiscard]] std::shared_ptr<const std::vector<T>> cached(Type windowFunction, const std::size_t n, const T beta = static_cast<T>(1.6)) {
+    using Key = std::tuple<Type, std::size_t, T>;
+    static std::mutex                                         cacheMutex;
+    static std::map<Key, std::weak_ptr<const std::vector<T>>> cache;
+
+    const Key       key{windowFunction, n, windowFunction == Type::Kaiser ? beta : T(0)}; // beta does not affect other window types
+    std::lock_guard lock(cacheMutex);
+    if (auto it = cache.find(key); it != cache.end()) {
+        if (auto window = it->second.lock()) {
+            return window;
+        }
+    }
+    std::erase_if(cache, [](const auto& entry) { return entry.second.expired(); });
+
+    auto window = std::make_shared<const std::vector<T>>(create<T>(windowFunction, n, beta));
+    cache.insert_or_assign(key, window);
+    return window;
+}
+
 } // namespace gr::algorithm::window
 
 #endif // GNURADIO_ALGORITHM_WINDOW_HPP
@@ -0,0 +1,94 @@
+#include <boost/ut.hpp>
+
+#include <cmath>
+#include <complex>
+#include <numbers>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/algorithm/NCO.hpp>
+
+const boost::ut::suite<"NCO"> ncoTests = [] {
+    using namespace boost::ut;
+    using gr::algorithm::NCO;
+
+    constexpr auto kFloatingPointTypes = std::tuple<float, double>{};
+
+    "sin/cos accuracy"_test = []<typename T>(const T&) {
+        const T tolerance = std::same_as<T, float> ? T(5e-7f) : T(1e-15);
+        for (const double increment : {0.0, 0.1, -0.7, 1.234, std::numbers::pi, 3.0}) {
+            NCO<T> nco;
+            nco.setPhaseIncrement(increment);
+            nco.setPhase(0.3);
+            NCO<T> cosNco  = nco;
+            NCO<T> complex = nco;
+
+            std::vector<T>               sin(1001UZ); // N.B. not a multiple of the SIMD width
+            std::vector<T>               cos(sin.size());
+            std::vector<std::complex<T>> exp(sin.size());
+            nco.generateSin(sin);
+            cosNco.generateCos(cos);
+            complex.generate(exp);
+
+            T maxError = 0;
+            for (std::size_t i = 0UZ; i < sin.size(); ++i) {
+                const long double phase = 0.3L + static_cast<long double>(i) * static_cast<long double>(increment);
+                maxError                = std::max({maxError, static_cast<T>(std::abs(std::sin(phase) - sin[i])), static_cast<T>(std::abs(std::cos(phase) - cos[i])), //
+                                   static_cast<T>(std::abs(std::sin(phase) - exp[i].imag())), static_cast<T>(std::abs(std::cos(phase) - exp[i].real()))});
+            }
+            expect(le(maxError, tolerance)) << fmt::format("increment {}", increment);
+        }
+    } | kFloatingPointTypes;
+
+    "phase continuity across calls"_test = []<typename T>(const T&) {
+        NCO<T> reference;
+        reference.setFrequency(1'234.5, 48'000.);
+        NCO<T> chunked = reference;
+
+        std::vector<std::complex<T>> input(4096UZ, std::complex<T>(T(0.5), T(-0.25)));
+        std::vector<std::complex<T>> expected(input.size());
+        reference.mix(input, expected);
+
+        std::vector<std::complex<T>> output(input.size());
+        std::size_t                  offset = 0UZ;
+        for (const std::size_t chunk : {1UZ, 3UZ, 7UZ, 100UZ, 255UZ, 256UZ, 257UZ, 1000UZ, 2217UZ}) {
+            chunked.mix(std::span(input).subspan(offset, chunk), std::span(output).subspan(offset, chunk));
+            offset += chunk;
+        }
+        expect(eq(offset, input.size()));
+        expect(std::ranges::equal(output, expected, [](const std::complex<T>& a, const std::complex<T>& b) { return std::abs(a - b) < T(1e-6f); })); // N.B. SIMD vs. scalar tail
+        expect(eq(chunked.phaseWord(), reference.phaseWord()));
+    } | kFloatingPointTypes;
+
+    "no long-run phase drift"_test = []<typename T>(const T&) {
+        constexpr std::size_t nSamples = 10'000'000'007UZ; // i.e. f * nSamples = 1'000'000'000.7 turns
+        NCO<T>                nco;
+        nco.setFrequency(1., 10.);
+        nco.advance(nSamples);
+        expect(approx(nco.phase(), 2. * std::numbers::pi * 0.7, 1e-6));
+
+        std::vector<T> sin(1UZ);
+        nco.generateSin(sin);
+        expect(approx(sin[0], static_cast<T>(std::sin(2. * std::numbers::pi * 0.7)), T(1e-6f)));
+
+        NCO<T> chunked; // advancing in steps is exact
+        chunked.setFrequency(1., 10.);
+        for (std::size_t i = 0UZ; i < 1'000UZ; ++i) {
+            chunked.advance(nSamples / 1'000UZ);
+        }
+        chunked.advance(nSamples % 1'000UZ);
+        expect(eq(chunked.phaseWord(), nco.phaseWord() - nco.phaseIncrementWord()));
+    } | kFloatingPointTypes;
+
+    "turns"_test = []<typename T>(const T&) {
+        NCO<T> nco;
+        nco.setFrequency(1., 8.);
+        nco.setPhase(-std::numbers::pi / 2.); // N.B. negative phases wrap to [0, 2 pi)
+        std::vector<T> turns(9UZ);
+        nco.generateTurns(turns);
+        expect(std::ranges::equal(turns, std::vector<T>{T(0.75), T(0.875), T(0), T(0.125), T(0.25), T(0.375), T(0.5), T(0.625), T(0.75)}));
+    } | kFloatingPointTypes;
+};
+
+int main() { /* not needed for UT */ }
@@ -1,5 +1,6 @@
 #include <boost/ut.hpp>
 
+#include <span>
 #include <vector>
 
 #include <fmt/format.h>
@@ -192,6 +193,42 @@ const suite<"SchmittTrigger"> SchmittTriggerTests = [] {
                 {{RISING, 0.5f}, {FALLING, 1.5f}, {RISING, 2.625f}});
         };
     } | std::tuple<uint8_t, int16_t>{};
+
+    "SchmittTrigger bulk processQuiet(..) vs. processOne(..)"_test = []<typename T>() {
+        using enum InterpolationMethod;
+        constexpr std::size_t kNSamples = 10'000UZ;
+
+        std::vector<T> signal(kNSamples); // slow noisy sine with sparse edges, incl. noise-induced re-entries into the hysteresis band
+        for (std::size_t i = 0UZ; i < kNSamples; i++) {
+            const double noise = 0.5 * std::sin(static_cast<double>(i * i) * 0.7);
+            signal[i]          = static_cast<T>(30.0 * std::sin(static_cast<double>(i) * 0.003) + noise);
+        }
+
+        auto detectEdges = []<InterpolationMethod Method>(const std::vector<T>& samples, bool useBulk) {
+            SchmittTrigger<T, Method>                                         trigger(T(1) /* threshold */, T(0) /* offset */);
+            std::vector<std::tuple<std::size_t, EdgeDetection, std::int32_t>> edges;
+            for (std::size_t i = 0UZ; i < samples.size(); ++i) {
+                if (useBulk) {
+                    i += trigger.processQuiet(std::span(samples).subspan(i));
+                    if (i == samples.size()) {
+                        break;
+                    }
+                }
+                if (trigger.processOne(samples[i]) != EdgeDetection::NONE) {
+                    edges.emplace_back(i, trigger.lastEdge, trigger.lastEdgeIdx);
+                }
+            }
+            return edges;
+        };
+
+        const auto edges = detectEdges.template operator()<NO_INTERPOLATION>(signal, false);
+        expect(ge(edges.size(), 5UZ));
+        expect(edges == detectEdges.template operator()<NO_INTERPOLATION>(signal, true));
+        expect(detectEdges.template operator()<BASIC_LINEAR_INTERPOLATION>(signal, false) == detectEdges.template operator()<BASIC_LINEAR_INTERPOLATION>(signal, true));
+        if constexpr (std::is_floating_point_v<T>) {
+            expect(detectEdges.template operator()<LINEAR_INTERPOLATION>(signal, false) == detectEdges.template operator()<LINEAR_INTERPOLATION>(signal, true));
+        }
+    } | std::tuple<float, double, int16_t>{};
 };
 
 int main() { /* not needed for UT */ }
@@ -0,0 +1,147 @@
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/algorithm/SlidingWindowStatistics.hpp>
+
+namespace {
+template<typename T>
+std::vector<T> randomSignal(std::size_t nSamples, T offset, T amplitude) {
+    std::mt19937                      rng(42); // fixed seed for reproducibility
+    std::uniform_real_distribution<T> dist(-amplitude, amplitude);
+    std::vector<T>                    signal(nSamples);
+    std::ranges::generate(signal, [&] { return offset + dist(rng); });
+    return signal;
+}
+
+// naive reference: recomputes the statistics over the last min(end, windowSize) samples ending at (excl.) 'end'
+template<typename T>
+std::span<const T> window(const std::vector<T>& signal, std::size_t end, std::size_t windowSize) {
+    const std::size_t begin = end > windowSize ? end - windowSize : 0UZ;
+    return std::span(signal).subspan(begin, end - begin);
+}
+
+template<typename T>
+std::pair<long double, long double> naiveMeanVariance(std::span<const T> data) {
+    long double sum = 0;
+    for (const T& x : data) {
+        sum += x;
+    }
+    const long double mean = sum / static_cast<long double>(data.size());
+    long double       m2   = 0;
+    for (const T& x : data) {
+        m2 += (x - mean) * (x - mean);
+    }
+    return {mean, m2 / static_cast<long double>(data.size())};
+}
+
+template<typename T>
+T naiveQuantile(std::span<const T> data, T q) {
+    std::vector<T> sorted(data.begin(), data.end());
+    std::ranges::sort(sorted);
+    const T           position = q * static_cast<T>(sorted.size() - 1UZ);
+    const std::size_t index    = static_cast<std::size_t>(std::floor(position));
+    const T           fraction = position - static_cast<T>(index);
+    return index + 1UZ < sorted.size() ? sorted[index] + fraction * (sorted[index + 1UZ] - sorted[index]) : sorted[index];
+}
+} // namespace
+
+const boost::ut::suite<"SlidingWindowStatistics"> slidingWindowStatisticsTests = [] {
+    using namespace boost::ut;
+    using namespace gr::algorithm;
+
+    constexpr auto kFloatingPointTypes = std::tuple<float, double>{};
+
+    "SlidingMoments vs. naive recomputation"_test = []<typename T>(const T&) {
+        constexpr std::size_t kWindow    = 100UZ;
+        const std::vector<T>  signal     = randomSignal<T>(2'000UZ, T(10), T(2)); // N.B. offset >> spread tests the cancellation
+        const T               tolerance  = std::same_as<T, float> ? T(5e-4f) : T(1e-10);
+        const auto            checkAfter = [&](const SlidingMoments<T>& stats, std::size_t end) {
+            const auto [mean, variance] = naiveMeanVariance(window(signal, end, kWindow));
+            expect(approx(stats.mean(), static_cast<T>(mean), tolerance)) << fmt::format("mean @{}", end);
+            expect(approx(stats.variance(), static_cast<T>(variance), tolerance)) << fmt::format("variance @{}", end);
+            expect(approx(stats.rms(), static_cast<T>(std::sqrt(mean * mean + variance)), tolerance)) << fmt::format("rms @{}", end);
+        };
+
+        SlidingMoments<T> single(kWindow);
+        for (std::size_t i = 0UZ; i < signal.size(); ++i) {
+            single.push_back(signal[i]);
+            checkAfter(single, i + 1UZ);
+        }
+
+        SlidingMoments<T> bulk(kWindow);
+        std::size_t       offset = 0UZ;
+        for (const std::size_t chunk : {1UZ, 7UZ, 33UZ, 99UZ, 100UZ, 101UZ, 250UZ, 13UZ, 64UZ, 1UZ, 1'000UZ, 331UZ}) {
+            bulk.push_back_bulk(std::span(signal).subspan(offset, chunk));
+            offset += chunk;
+            checkAfter(bulk, offset);
+        }
+        expect(eq(offset, signal.size()));
+        expect(eq(bulk.size(), kWindow));
+    } | kFloatingPointTypes;
+
+    "SlidingMoments long-run stability"_test = [] {
+        // N.B. the add/remove recurrences alone accumulate round-off, the periodic re-computation keeps the error bounded
+        constexpr std::size_t    kWindow = 64UZ;
+        const std::vector<float> signal  = randomSignal<float>(1'000'000UZ, 1000.f, 1.f);
+        SlidingMoments<float>    stats(kWindow);
+        for (const float x : signal) {
+            stats.push_back(x);
+        }
+        const auto [mean, variance] = naiveMeanVariance(window(signal, signal.size(), kWindow));
+        expect(approx(stats.mean(), static_cast<float>(mean), 1e-3f));
+        expect(approx(stats.variance(), static_cast<float>(variance), 2e-3f));
+    };
+
+    "SlidingMinimum/Maximum vs. naive recomputation"_test = []<typename T>(const T&) {
+        constexpr std::size_t kWindow = 37UZ;
+        const std::vector<T>  signal  = randomSignal<T>(1'000UZ, T(0), T(1));
+
+        SlidingMinimum<T> minimum(kWindow);
+        SlidingMaximum<T> maximum(kWindow);
+        for (std::size_t i = 0UZ; i < signal.size(); ++i) {
+            minimum.push_back(signal[i]);
+            maximum.push_back(signal[i]);
+            const auto data = window(signal, i + 1UZ, kWindow);
+            expect(eq(minimum.value(), std::ranges::min(data))) << fmt::format("min @{}", i);
+            expect(eq(maximum.value(), std::ranges::max(data))) << fmt::format("max @{}", i);
+        }
+
+        SlidingMaximum<T> bulk(kWindow);
+        std::size_t       offset = 0UZ;
+        for (const std::size_t chunk : {5UZ, 36UZ, 37UZ, 38UZ, 1UZ, 200UZ, 683UZ}) {
+            bulk.push_back_bulk(std::span(signal).subspan(offset, chunk));
+            offset += chunk;
+            expect(eq(bulk.value(), std::ranges::max(window(signal, offset, kWindow)))) << fmt::format("bulk max @{}", offset);
+        }
+        expect(eq(offset, signal.size()));
+
+        // monotonic input is the worst case for the deque (all samples remain candidates)
+        SlidingMinimum<T> ramp(kWindow);
+        for (std::size_t i = 0UZ; i < 200UZ; ++i) {
+            ramp.push_back(static_cast<T>(i));
+            expect(eq(ramp.value(), static_cast<T>(i >= kWindow ? i + 1UZ - kWindow : 0UZ)));
+        }
+    } | kFloatingPointTypes;
+
+    "SlidingQuantile vs. naive recomputation"_test = []<typename T>(const T&) {
+        constexpr std::size_t kWindow = 51UZ;
+        std::vector<T>        signal  = randomSignal<T>(500UZ, T(0), T(1));
+        std::ranges::transform(signal, signal.begin(), [](T x) { return std::round(x * T(8)) / T(8); }); // N.B. many duplicates
+
+        for (const T q : {T(0), T(0.1), T(0.25), T(0.5), T(0.9), T(1)}) {
+            SlidingQuantile<T> quantile(kWindow, q);
+            for (std::size_t i = 0UZ; i < signal.size(); ++i) {
+                quantile.push_back(signal[i]);
+                expect(approx(quantile.value(), naiveQuantile(window(signal, i + 1UZ, kWindow), q), T(1e-6f))) << fmt::format("q = {} @{}", q, i);
+            }
+        }
+    } | kFloatingPointTypes;
+};
+
+int main() { /* not needed for UT */ }
@@ -152,6 +152,37 @@ const boost::ut::suite<"FFT algorithms and window functions"> windowTests = [] {
         }
     } | ComplexTypesToTest{};
 
+    "FFT algo batch tests"_test = []<typename T>() {
+        using InType = T::InType;
+        typename T::AlgoType  batchAlgo{};
+        typename T::AlgoType  singleAlgo{};
+        constexpr gr::Size_t  N{16};
+        constexpr std::size_t nTransforms{5}; // N.B. deliberately not a multiple of the SIMD width
+
+        std::vector<InType> signal(N * nTransforms);
+        for (std::size_t i = 0; i < signal.size(); i++) {
+            const auto value = static_cast<double>((i * 7UZ) % 13UZ) - 6.;
+            if constexpr (gr::meta::complex_like<InType>) {
+                signal[i] = InType(static_cast<typename InType::value_type>(value), static_cast<typename InType::value_type>(0.5 * value));
+            } else {
+                signal[i] = static_cast<InType>(value);
+            }
+        }
+
+        std::vector<typename T::OutType> batchResult;
+        std::ignore = batchAlgo.computeBatch(signal, batchResult, nTransforms);
+        expect(eq(batchResult.size(), signal.size()));
+
+        for (std::size_t iT = 0; iT < nTransforms; iT++) {
+            const std::vector<InType> frame(std::next(signal.begin(), static_cast<std::ptrdiff_t>(iT * N)), std::next(signal.begin(), static_cast<std::ptrdiff_t>((iT + 1) * N)));
+            const auto                expected = singleAlgo.compute(frame);
+            const std::vector         result(std::next(batchResult.begin(), static_cast<std::ptrdiff_t>(iT * N)), std::next(batchResult.begin(), static_cast<std::ptrdiff_t>((iT + 1) * N)));
+            expect(equalVectors(result, expected, 1e-3)) << fmt::format("<{}> batch transform {} equals single transform", type_name<T>(), iT);
+        }
+
+        expect(throws([&] { std::ignore = batchAlgo.computeBatch(signal, batchResult, 3UZ); })) << "input size must be a multiple of the number of transforms";
+    } | AllTypesToTest{};
+
     "Unwrap Phase tests"_test = [] {
         std::vector<double> phase = {0.2, -1., 2.5, -3.1, 0.9, -0.5, 1.2, 0.8, 1.5, -1.2, -2.7, 0.9, -0.8, -1.4, 0.6, 1.1, -1.9, 0.4, 1.3, -0.7};
         // Output generated with python numpy.unwrap(phase)
@@ -244,6 +275,20 @@ const boost::ut::suite<"FFT algorithms and window functions"> windowTests = [] {
         expect(throws<std::invalid_argument>([] { std::ignore = create(gr::algorithm::window::Type::Kaiser, 1); })) << "invalid Kaiser window size";
         expect(throws<std::invalid_argument>([] { std::ignore = create(gr::algorithm::window::Type::Kaiser, 2, -1.f); })) << "invalid Kaiser window beta";
     } | std::tuple<float, double>();
+
+    "window cache tests"_test = []<typename T>() {
+        using gr::algorithm::window::cached;
+        using enum gr::algorithm::window::Type;
+
+        const auto kaiser1 = cached<T>(Kaiser, 1024U, T(2));
+        const auto kaiser2 = cached<T>(Kaiser, 1024U, T(2));
+        expect(eq(kaiser1.get(), kaiser2.get())) << fmt::format("<{}> identical windows share storage", type_name<T>());
+        expect(equalVectors(*kaiser1, create<T>(Kaiser, 1024U, T(2)))) << fmt::format("<{}> cached equals created window", type_name<T>());
+        expect(neq(kaiser1.get(), cached<T>(Kaiser, 1024U, T(3)).get())) << fmt::format("<{}> beta is part of the key", type_name<T>());
+        expect(neq(kaiser1.get(), cached<T>(Kaiser, 512U, T(2)).get())) << fmt::format("<{}> size is part of the key", type_name<T>());
+        expect(eq(cached<T>(Hann, 64U, T(1)).get(), cached<T>(Hann, 64U, T(2)).get())) << fmt::format("<{}> beta is ignored for non-Kaiser windows", type_name<T>());
+        expect(throws<std::invalid_argument>([] { std::ignore = cached<T>(Kaiser, 2, T(-1)); })) << "invalid Kaiser window beta";
+    } | std::tuple<float, double>();
 };
 
 int main() { /* not needed for UT */ }
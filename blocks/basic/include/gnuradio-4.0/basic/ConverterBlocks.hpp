@@ -1,15 +1,189 @@
 #ifndef CONVERTERBLOCKS_HPP
 #define CONVERTERBLOCKS_HPP
 
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <complex>
+#include <limits>
+#include <numbers>
+#include <span>
 #include <tuple>
+#include <utility>
 
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/meta/FixedPoint.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
 namespace gr::blocks::type::converter {
 
+namespace detail {
+template<typename T>
+using simd_type = vir::stdx::native_simd<T>;
+
+/// largest F <= std::numeric_limits<R>::max(), i.e. the conversion to R is defined (e.g. 2^31 - 128 for float -> int32)
+template<std::floating_point F, std::integral R>
+inline constexpr F kMaxConvertible = static_cast<F>(std::numeric_limits<R>::max() - (std::numeric_limits<R>::max() >> std::min(std::numeric_limits<R>::digits, std::numeric_limits<F>::digits)));
+
+/// out[i] = static_cast<R>(static_cast<F>(in[i]) * scale), vectorised over the floating-point type F (e.g. int16 IQ -> float)
+/// N.B. integral R saturate to [lowest, kMaxConvertible] (NaN -> 0) since out-of-range floating-point -> integer conversions are UB
+template<std::floating_point F, typename T, typename R>
+constexpr void scaledConvert(const T* in, R* out, std::size_t nSamples, F scale) noexcept {
+    using V                 = simd_type<F>;
+    const std::size_t nSimd = nSamples - nSamples % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        V value = vir::stdx::static_simd_cast<V>(vir::stdx::rebind_simd_t<T, V>(in + i, vir::stdx::element_aligned)) * scale;
+        if constexpr (std::is_integral_v<R>) {
+            vir::stdx::where(value != value, value) = V(0);
+            value                                   = vir::stdx::max(V(static_cast<F>(std::numeric_limits<R>::lowest())), vir::stdx::min(value, V(kMaxConvertible<F, R>)));
+        }
+        vir::stdx::static_simd_cast<vir::stdx::rebind_simd_t<R, V>>(value).copy_to(out + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < nSamples; ++i) {
+        const F value = static_cast<F>(in[i]) * scale;
+        if constexpr (std::is_integral_v<R>) {
+            out[i] = std::isnan(value) ? R(0) : static_cast<R>(std::clamp(value, static_cast<F>(std::numeric_limits<R>::lowest()), kMaxConvertible<F, R>));
+        } else {
+            out[i] = static_cast<R>(value);
+        }
+    }
+}
+
+/// loads V::size() interleaved (re, im) pairs as {re, im} registers
+template<typename V>
+[[nodiscard]] constexpr std::pair<V, V> loadDeinterleaved(const typename V::value_type* pairs) noexcept {
+    return {V([pairs](auto k) { return pairs[2UZ * k]; }), V([pairs](auto k) { return pairs[2UZ * k + 1UZ]; })};
+}
+
+/// re[i] = pairs[2i], im[i] = pairs[2i + 1]
+template<std::floating_point T>
+constexpr void deinterleave(const T* pairs, T* re, T* im, std::size_t nPairs) noexcept {
+    using V                 = simd_type<T>;
+    const std::size_t nSimd = nPairs - nPairs % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        const auto [vRe, vIm] = loadDeinterleaved<V>(pairs + 2UZ * i);
+        vRe.copy_to(re + i, vir::stdx::element_aligned);
+        vIm.copy_to(im + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < nPairs; ++i) {
+        re[i] = pairs[2UZ * i];
+        im[i] = pairs[2UZ * i + 1UZ];
+    }
+}
+
+/// pairs[2i] = re[i], pairs[2i + 1] = im[i]
+/// N.B. plain loop on purpose: the interleaving store is bandwidth-bound and lane-wise SIMD shuffles measured no faster (SSE2/AVX2)
+template<std::floating_point T>
+constexpr void interleave(const T* re, const T* im, T* pairs, std::size_t nPairs) noexcept {
+    for (std::size_t i = 0UZ; i < nPairs; ++i) {
+        pairs[2UZ * i]       = re[i];
+        pairs[2UZ * i + 1UZ] = im[i];
+    }
+}
+
+/// atan(a) for a in [0, 1] (Cephes range reduction and coefficients, error < 2 ulp)
+template<typename V>
+[[nodiscard]] constexpr V atanUnit(V a) noexcept {
+    using T = typename V::value_type;
+    if constexpr (std::same_as<T, float>) {
+        const auto reduce = a > V(0.4142135623730950f); // tan(pi/8)
+        vir::stdx::where(reduce, a) = (a - V(1.f)) / (a + V(1.f));
+        const V z      = a * a;
+        V       result = (((V(8.05374449538e-2f) * z - V(1.38776856032e-1f)) * z + V(1.99777106478e-1f)) * z - V(3.33329491539e-1f)) * z * a + a;
+        vir::stdx::where(reduce, result) += V(std::numbers::pi_v<float> / 4.f);
+        return result;
+    } else {
+        const auto reduce = a > V(0.66);
+        vir::stdx::where(reduce, a) = (a - V(1.)) / (a + V(1.));
+        const V z = a * a;
+        const V p = (((V(-8.750608600031904122785e-1) * z - V(1.615753718733365076637e1)) * z - V(7.500855792314704667340e1)) * z - V(1.228866684490136173410e2)) * z - V(6.485021904942025371773e1);
+        const V q = ((((z + V(2.485846490142306297962e1)) * z + V(1.650270098316988542046e2)) * z + V(4.328810604912902668951e2)) * z + V(4.853903996359136964868e2)) * z + V(1.945506571482613964425e2);
+        V       result = a * z * p / q + a;
+        vir::stdx::where(reduce, result) += V(std::numbers::pi / 4. + 0.5 * 6.123233995736765886130e-17); // pi/4 incl. its rounding error
+        return result;
+    }
+}
+
+/// {|z|, arg(z)} of z = re + j im, overflow-safe; N.B. signed zeros are not distinguished, i.e. arg(-1 - 0j) = +pi
+template<typename V>
+[[nodiscard]] constexpr std::pair<V, V> magnitudePhase(const V& re, const V& im) noexcept {
+    using T       = typename V::value_type;
+    const V absRe = vir::stdx::abs(re);
+    const V absIm = vir::stdx::abs(im);
+    const V large = vir::stdx::max(absRe, absIm);
+    V       ratio = vir::stdx::min(absRe, absIm) / large;
+    vir::stdx::where(large == V(0), ratio) = V(0);
+
+    const V magnitude = large * vir::stdx::sqrt(V(1) + ratio * ratio);
+    V       phase     = atanUnit(ratio);
+    vir::stdx::where(absIm > absRe, phase) = V(std::numbers::pi_v<T> / T(2)) - phase;
+    vir::stdx::where(re < V(0), phase)     = V(std::numbers::pi_v<T>) - phase;
+    vir::stdx::where(im < V(0), phase)     = -phase;
+    return {magnitude, phase};
+}
+
+template<std::floating_point T>
+inline constexpr T kMaxReducible = std::same_as<T, float> ? T(1e4f) : T(1e8); // sinCos(..) error < 1 ulp up to this |x|, beyond: use std::sin/cos
+
+/// {sin(x), cos(x)} via Cody-Waite reduction by pi/2 and Taylor polynomials on [-pi/4, pi/4], valid for |x| <= kMaxReducible
+template<typename V>
+[[nodiscard]] constexpr std::pair<V, V> sinCos(const V& x) noexcept {
+    using T                             = typename V::value_type;
+    constexpr std::size_t kNTerms       = std::same_as<T, float> ? 6UZ : 9UZ; // first omitted term < 1e-11 (float) and < 3e-18 (double)
+    static constexpr auto kCoefficients = [] { // {sin, cos}: (-1)^k / (2k+1)! and (-1)^k / (2k)!
+        std::array<std::array<T, kNTerms>, 2UZ> coefficients{};
+        double                                  sinValue = 1.0;
+        double                                  cosValue = 1.0;
+        for (std::size_t k = 0UZ; k < kNTerms; ++k) {
+            coefficients[0UZ][k] = static_cast<T>(sinValue);
+            coefficients[1UZ][k] = static_cast<T>(cosValue);
+            sinValue             = -sinValue / static_cast<double>((2UZ * k + 2UZ) * (2UZ * k + 3UZ));
+            cosValue             = -cosValue / static_cast<double>((2UZ * k + 1UZ) * (2UZ * k + 2UZ));
+        }
+        return coefficients;
+    }();
+    static constexpr T kRoundingMagic = T(1.5) * static_cast<T>(1ULL << (std::numeric_limits<T>::digits - 1)); // (x + magic) - magic == nearbyint(x)
+
+    const auto nearbyInt = [](const V& value) { return (value + V(kRoundingMagic)) - V(kRoundingMagic); };
+    const auto isOdd     = [&nearbyInt](const V& integral) { return nearbyInt(integral * V(T(0.5))) != integral * V(T(0.5)); };
+
+    const V quadrant = nearbyInt(x * V(T(2) / std::numbers::pi_v<T>));
+    V       r;
+    if constexpr (std::same_as<T, float>) { // pi/2 split into parts whose products with 'quadrant' are exact
+        r = ((x - quadrant * V(1.5703125f)) - quadrant * V(4.837512969970703125e-4f)) - quadrant * V(7.54978995489188216e-8f);
+    } else {
+        r = ((x - quadrant * V(1.57079625129699707031e+00)) - quadrant * V(7.54978941586159635336e-08)) - quadrant * V(5.39030285815811905290e-15);
+    }
+
+    const V r2   = r * r;
+    V       sinR = V(kCoefficients[0UZ][kNTerms - 1UZ]);
+    V       cosR = V(kCoefficients[1UZ][kNTerms - 1UZ]);
+    for (std::size_t k = kNTerms - 1UZ; k-- > 0UZ;) {
+        sinR = sinR * r2 + V(kCoefficients[0UZ][k]);
+        cosR = cosR * r2 + V(kCoefficients[1UZ][k]);
+    }
+    sinR *= r;
+
+    // q = quadrant mod 4: sin(x) = {sin r, cos r, -sin r, -cos r}[q] and cos(x) = {cos r, -sin r, -cos r, sin r}[q]
+    const auto odd     = isOdd(quadrant);
+    const V    half    = quadrant * V(T(0.5));
+    V          halfLow = half; // floor(q / 2): odd <=> sin(x) changes sign
+    V          halfUp  = half; // floor((q + 1) / 2): odd <=> cos(x) changes sign
+    vir::stdx::where(odd, halfLow) -= V(T(0.5));
+    vir::stdx::where(odd, halfUp) += V(T(0.5));
+
+    V sinX = sinR;
+    V cosX = cosR;
+    vir::stdx::where(odd, sinX)            = cosR;
+    vir::stdx::where(odd, cosX)            = sinR;
+    vir::stdx::where(isOdd(halfLow), sinX) = -sinX;
+    vir::stdx::where(isOdd(halfUp), cosX)  = -cosX;
+    return {sinX, cosX};
+}
+} // namespace detail
+
 template<typename T, typename R>
 requires std::is_arithmetic_v<T> && std::is_arithmetic_v<R>
 struct Convert : public gr::Block<Convert<T, R>> {
@@ -31,20 +205,26 @@ struct Convert : public gr::Block<Convert<T, R>> {
 };
 
 template<typename T, typename R>
-requires std::is_arithmetic_v<T> && std::is_arithmetic_v<R>
+requires(std::is_arithmetic_v<T> && std::is_arithmetic_v<R>) || (std::floating_point<T> && FixedPointLike<R>) || (FixedPointLike<T> && std::floating_point<R>)
 struct ScalingConvert : public gr::Block<ScalingConvert<T, R>> {
     using Description = Doc<R""(@brief basic block to perform a input to output data type conversion
 
-Performs scaling, i.e. 'R output = R(input * scale)'
+Performs scaling, i.e. 'R output = R(input * scale)'. Conversions to fixed-point types (e.g. gr::Q15) round and saturate according
+to the type's policies, e.g. 'ScalingConvert<float, gr::Q15>' to feed an int16 pipeline or 'ScalingConvert<gr::Q15, float>' with
+'scale = 32768' to recover the raw ADC counts.
 )"">;
+    using scale_type = std::conditional_t<FixedPointLike<T>, R, T>;
+
     PortIn<T>  in;
     PortOut<R> out;
-    T          scale = static_cast<T>(1);
+    scale_type scale = static_cast<scale_type>(1);
 
     GR_MAKE_REFLECTABLE(ScalingConvert, in, out, scale);
 
     template<gr::meta::t_or_simd<T> V>
-    [[nodiscard]] constexpr auto processOne(const V& input) const noexcept {
+    [[nodiscard]] constexpr auto processOne(const V& input) const noexcept
+    requires(not FixedPointLike<T> && not FixedPointLike<R>)
+    {
         if constexpr (gr::meta::any_simd<V>) { // simd case
             using RetType = vir::stdx::rebind_simd_t<R, V>;
             return vir::stdx::static_simd_cast<RetType>(input * scale);
@@ -52,6 +232,17 @@ Performs scaling, i.e. 'R output = R(input * scale)'
             return static_cast<R>(input * scale);
         }
     }
+
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<R> output) const noexcept
+    requires(FixedPointLike<T> || FixedPointLike<R>)
+    {
+        if constexpr (FixedPointLike<R>) {
+            fixed_point::fromFloating(input, output, scale);
+        } else {
+            fixed_point::toFloating(input, output, scale);
+        }
+        return work::Status::OK;
+    }
 };
 
 template<typename T>
@@ -154,8 +345,14 @@ struct ToRealImag : public gr::Block<ToRealImag<T>> {
 
     GR_MAKE_REFLECTABLE(ToRealImag, in, real, imag);
 
-    [[nodiscard]] constexpr std::tuple<R, R> processOne(T complexIn) const noexcept { // some SIMD-fication potential here
-        return {static_cast<R>(std::real(complexIn)), static_cast<R>(std::imag(complexIn))};
+    [[nodiscard]] work::Status processBulk(std::span<const T> complexIn, std::span<R> realOut, std::span<R> imagOut) const noexcept {
+        if constexpr (meta::complex_like<T>) { // N.B. std::complex<R> is layout-compatible with R[2]
+            detail::deinterleave(reinterpret_cast<const R*>(complexIn.data()), realOut.data(), imagOut.data(), complexIn.size());
+        } else {
+            std::ranges::transform(complexIn, realOut.begin(), [](T value) { return static_cast<R>(value); });
+            std::ranges::fill(imagOut, R(0));
+        }
+        return work::Status::OK;
     }
 };
 
@@ -169,8 +366,9 @@ struct RealImagToComplex : public gr::Block<RealImagToComplex<T>> {
 
     GR_MAKE_REFLECTABLE(RealImagToComplex, real, imag, out);
 
-    [[nodiscard]] constexpr R processOne(T re, T im) const noexcept { // some SIMD-fication potential here
-        return {re, im};
+    [[nodiscard]] work::Status processBulk(std::span<const T> realIn, std::span<const T> imagIn, std::span<R> complexOut) const noexcept {
+        detail::interleave(realIn.data(), imagIn.data(), reinterpret_cast<T*>(complexOut.data()), complexOut.size());
+        return work::Status::OK;
     }
 };
 
@@ -185,8 +383,35 @@ struct ToMagPhase : public gr::Block<ToMagPhase<T>> {
 
     GR_MAKE_REFLECTABLE(ToMagPhase, in, mag, phase);
 
-    [[nodiscard]] constexpr std::tuple<R, R> processOne(T complexIn) const noexcept { // some SIMD-fication potential here
-        return {static_cast<R>(std::abs(complexIn)), static_cast<R>(std::arg(complexIn))};
+    [[nodiscard]] work::Status processBulk(std::span<const T> complexIn, std::span<R> magOut, std::span<R> phaseOut) const noexcept {
+        if constexpr (meta::complex_like<T>) {
+            using V          = detail::simd_type<R>;
+            const auto apply = [](const R* pairs, R* magnitudes, R* phases) { // N.B. processes exactly V::size() samples
+                const auto [re, im]     = detail::loadDeinterleaved<V>(pairs);
+                const auto [vMag, vArg] = detail::magnitudePhase(re, im);
+                vMag.copy_to(magnitudes, vir::stdx::element_aligned);
+                vArg.copy_to(phases, vir::stdx::element_aligned);
+            };
+
+            const R*          pairs = reinterpret_cast<const R*>(complexIn.data()); // N.B. std::complex<R> is layout-compatible with R[2]
+            const std::size_t nSimd = complexIn.size() - complexIn.size() % V::size();
+            for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+                apply(pairs + 2UZ * i, magOut.data() + i, phaseOut.data() + i);
+            }
+            if (const std::size_t nTail = complexIn.size() - nSimd; nTail > 0UZ) { // zero-padded remainder
+                std::array<R, 2UZ * V::size()> tailIn{};
+                std::array<R, V::size()>       tailMag;
+                std::array<R, V::size()>       tailPhase;
+                std::copy_n(pairs + 2UZ * nSimd, 2UZ * nTail, tailIn.begin());
+                apply(tailIn.data(), tailMag.data(), tailPhase.data());
+                std::copy_n(tailMag.begin(), nTail, magOut.begin() + static_cast<std::ptrdiff_t>(nSimd));
+                std::copy_n(tailPhase.begin(), nTail, phaseOut.begin() + static_cast<std::ptrdiff_t>(nSimd));
+            }
+        } else {
+            std::ranges::transform(complexIn, magOut.begin(), [](T value) { return static_cast<R>(std::abs(value)); });
+            std::ranges::transform(complexIn, phaseOut.begin(), [](T value) { return static_cast<R>(std::arg(value)); });
+        }
+        return work::Status::OK;
     }
 };
 
@@ -201,8 +426,47 @@ struct MagPhaseToComplex : public gr::Block<MagPhaseToComplex<T>> {
 
     GR_MAKE_REFLECTABLE(MagPhaseToComplex, mag, phase, out);
 
-    [[nodiscard]] constexpr std::complex<T> processOne(T r, T theta) const noexcept { // some SIMD-fication potential here
-        return std::polar(r, theta);
+    [[nodiscard]] work::Status processBulk(std::span<const T> magIn, std::span<const T> phaseIn, std::span<R> complexOut) const noexcept {
+        if constexpr (std::floating_point<T>) {
+            using V          = detail::simd_type<T>;
+            const auto apply = [](const T* magnitudes, const T* phases, T* pairs) { // N.B. processes exactly V::size() samples
+                const V theta(phases, vir::stdx::element_aligned);
+                if (vir::stdx::any_of(vir::stdx::abs(theta) > V(detail::kMaxReducible<T>))) [[unlikely]] {
+                    for (std::size_t k = 0UZ; k < V::size(); ++k) {
+                        const std::complex<T> value = std::polar(magnitudes[k], phases[k]);
+                        pairs[2UZ * k]              = value.real();
+                        pairs[2UZ * k + 1UZ]        = value.imag();
+                    }
+                    return;
+                }
+                const V r(magnitudes, vir::stdx::element_aligned);
+                const auto [sinX, cosX] = detail::sinCos(theta);
+
+                std::array<T, V::size()> re;
+                std::array<T, V::size()> im;
+                (r * cosX).copy_to(re.data(), vir::stdx::element_aligned);
+                (r * sinX).copy_to(im.data(), vir::stdx::element_aligned);
+                detail::interleave(re.data(), im.data(), pairs, V::size());
+            };
+
+            T*                pairs = reinterpret_cast<T*>(complexOut.data()); // N.B. std::complex<T> is layout-compatible with T[2]
+            const std::size_t nSimd = complexOut.size() - complexOut.size() % V::size();
+            for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+                apply(magIn.data() + i, phaseIn.data() + i, pairs + 2UZ * i);
+            }
+            if (const std::size_t nTail = complexOut.size() - nSimd; nTail > 0UZ) { // zero-padded remainder
+                std::array<T, V::size()>       tailMag{};
+                std::array<T, V::size()>       tailPhase{};
+                std::array<T, 2UZ * V::size()> tailOut;
+                std::copy_n(magIn.begin() + static_cast<std::ptrdiff_t>(nSimd), nTail, tailMag.begin());
+                std::copy_n(phaseIn.begin() + static_cast<std::ptrdiff_t>(nSimd), nTail, tailPhase.begin());
+                apply(tailMag.data(), tailPhase.data(), tailOut.data());
+                std::copy_n(tailOut.begin(), 2UZ * nTail, pairs + 2UZ * nSimd);
+            }
+        } else {
+            std::ranges::transform(magIn, phaseIn, complexOut.begin(), [](T r, T theta) { return std::polar(r, theta); });
+        }
+        return work::Status::OK;
     }
 };
 
@@ -212,17 +476,19 @@ struct ComplexToInterleaved : public gr::Block<ComplexToInterleaved<T, R>, Resam
     using Description = Doc<R""(@brief convert stream of complex to a stream of interleaved specified type.
 
 The output stream contains twice as many output items as input items.
-For every complex input item, we produce two output items that alternate between the real and imaginary component of the complex value.)"">;
+For every complex input item, we produce two output items that alternate between the real and imaginary component of the complex value.
+Performs scaling, i.e. 'R output = R(input * scale)', e.g. 'scale = 32767' for a full-range int16 IQ stream.)"">;
+    using value_type = typename T::value_type;
+
     PortIn<T>  in;
     PortOut<R> interleaved;
+    value_type scale = static_cast<value_type>(1);
 
-    GR_MAKE_REFLECTABLE(ComplexToInterleaved, in, interleaved);
+    GR_MAKE_REFLECTABLE(ComplexToInterleaved, in, interleaved, scale);
 
-    [[nodiscard]] constexpr work::Status processBulk(std::span<const T> complexInput, std::span<R> interleavedOut) const noexcept { // some SIMD-fication potential here (needs permute)
-        for (std::size_t i = 0; i < complexInput.size(); ++i) {
-            interleavedOut[2 * i]     = static_cast<R>(complexInput[i].real());
-            interleavedOut[2 * i + 1] = static_cast<R>(complexInput[i].imag());
-        }
+    [[nodiscard]] work::Status processBulk(std::span<const T> complexInput, std::span<R> interleavedOut) const noexcept {
+        // N.B. std::complex<value_type> is layout-compatible with value_type[2], i.e. the (re, im) order is already the interleaved one
+        detail::scaledConvert(reinterpret_cast<const value_type*>(complexInput.data()), interleavedOut.data(), 2UZ * complexInput.size(), scale);
         return work::Status::OK;
     }
 };
@@ -234,16 +500,19 @@ struct InterleavedToComplex : public gr::Block<InterleavedToComplex<T, R>, gr::R
 
 The input stream contains twice as many input items as output items.
 For every pair of interleaved input items (real, imag), we produce one complex output item.
+Performs scaling, i.e. 'R output = R(input) * scale', e.g. 'scale = 1/32768' to normalise a raw int16 IQ stream to [-1, 1).
 )"">;
+    using value_type = typename R::value_type;
+
     gr::PortIn<T>  interleaved;
     gr::PortOut<R> out;
+    value_type     scale = static_cast<value_type>(1);
 
-    GR_MAKE_REFLECTABLE(InterleavedToComplex, interleaved, out);
+    GR_MAKE_REFLECTABLE(InterleavedToComplex, interleaved, out, scale);
 
-    [[nodiscard]] constexpr work::Status processBulk(std::span<const T> interleavedInput, std::span<R> complexOut) const noexcept { // some SIMD-fication potential here (needs permute)
-        for (std::size_t i = 0; i < complexOut.size(); ++i) {
-            complexOut[i] = R{static_cast<typename R::value_type>(interleavedInput[2 * i]), static_cast<typename R::value_type>(interleavedInput[2 * i + 1])};
-        }
+    [[nodiscard]] work::Status processBulk(std::span<const T> interleavedInput, std::span<R> complexOut) const noexcept {
+        // N.B. std::complex<value_type> is layout-compatible with value_type[2], i.e. the (re, im) order is already the interleaved one
+        detail::scaledConvert(interleavedInput.data(), reinterpret_cast<value_type*>(complexOut.data()), 2UZ * complexOut.size(), scale);
         return work::Status::OK;
     }
 };
@@ -254,14 +523,18 @@ For every pair of interleaved input items (real, imag), we produce one complex o
  TODO: temporarily disabled due to excessive compile-times on CI
 
 namespace gr::blocks::type::converter {
-using TSupportedTypes    = std::tuple<uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double>; // N.B. 10 base types
-using TComplexTypes      = std::tuple<std::complex<float>, std::complex<double>>;                                               // N.B. 2 (valid) complex types
-using TCommonRawSDRTypes = std::tuple<int8_t, int16_t, float, double>;
+using TSupportedTypes     = std::tuple<uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double>; // N.B. 10 base types
+using TComplexTypes       = std::tuple<std::complex<float>, std::complex<double>>;                                               // N.B. 2 (valid) complex types
+using TCommonRawSDRTypes  = std::tuple<int8_t, int16_t, float, double>;
+using TFloatingPointTypes = std::tuple<float, double>;
+using TFixedPointTypes    = std::tuple<gr::Q15, gr::Q31>;
 
 // clang-format off
 const inline auto registerConverterBlocks =
     gr::registerBlockTT<Convert, TSupportedTypes, TSupportedTypes>(gr::globalBlockRegistry()) // N.B. source of long compile-times: 10 x 10 type instantiations
   | gr::registerBlockTT<ScalingConvert, TSupportedTypes, TSupportedTypes>(gr::globalBlockRegistry()) // N.B. source of long compile-times: 10 x 10 type instantiations
+  | gr::registerBlockTT<ScalingConvert, TFloatingPointTypes, TFixedPointTypes>(gr::globalBlockRegistry())
+  | gr::registerBlockTT<ScalingConvert, TFixedPointTypes, TFloatingPointTypes>(gr::globalBlockRegistry())
   | gr::registerBlock<Abs, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry())
   | gr::registerBlock<Imag, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry())
   | gr::registerBlock<Real, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry())
@@ -13,6 +13,7 @@
 #include <chrono>
 #include <deque>
 #include <limits>
+#include <mutex>
 
 namespace gr::basic {
 
@@ -41,6 +42,9 @@ concept DataSetMatcher = std::invocable<T, gr::DataSet<V>> && std::is_same_v<std
 namespace detail {
 constexpr std::size_t data_sink_buffer_size          = 65536;
 constexpr std::size_t data_sink_data_set_buffer_size = 1024;
+
+template<typename T>
+using DataSinkInputPort = PortIn<T, RequiredSamples<std::dynamic_extent, data_sink_buffer_size>>;
 } // namespace detail
 
 template<typename T>
@@ -84,6 +88,236 @@ struct StreamingPoller {
     }
 };
 
+/**
+ * @brief zero-copy poller that reads directly from the DataSink's input port buffer through an additional buffer reader.
+ *
+ * Unlike StreamingPoller, samples are not copied into an intermediate buffer: `process(..)` hands out spans into the graph's
+ * ring buffer. Since the reader gates the upstream writer like any other reader of the buffer:
+ *  - Blocking: a client that does not keep up back-pressures the flow-graph;
+ *  - NonBlocking: the sink drops the oldest samples on behalf of the client (instead of blocking) once it lags more than half
+ *    the buffer size behind. N.B. the drop only `try_lock`s the poller's mutex and is skipped while the client is inside
+ *    `process(..)`: a client holding on to the spans for longer than it takes to fill the remaining buffer still gates the
+ *    upstream writer, i.e. this mode bounds rather than removes the back-pressure of a lagging client.
+ */
+template<typename T>
+struct ZeroCopyPoller {
+    using PortType = detail::DataSinkInputPort<T>;
+
+    typename PortType::ReaderType    reader;
+    typename PortType::TagReaderType tag_reader;
+    std::mutex                       mutex; // serialises the client's `process(..)` with the drops issued by the sink
+    bool                             blocking     = true;
+    std::atomic<bool>                finished     = false;
+    std::atomic<std::size_t>         drop_count   = 0;
+    std::vector<Tag>                 relevantTags = {}; // reader thread
+
+    ZeroCopyPoller(typename PortType::ReaderType reader_, typename PortType::TagReaderType tagReader_, bool doBlock) : reader(std::move(reader_)), tag_reader(std::move(tagReader_)), blocking(doBlock) {}
+
+    template<typename Handler>
+    [[nodiscard]] bool process(Handler fnc, std::size_t requested = std::numeric_limits<std::size_t>::max()) {
+        std::lock_guard lg(mutex);
+        const auto      nProcess = std::min(reader.available(), requested);
+        if (nProcess == 0) {
+            return false;
+        }
+
+        const std::size_t position = reader.position();
+        auto              readData = reader.get(nProcess); // N.B. view into the graph's buffer
+        auto              tags     = tag_reader.get();
+        const auto        first    = std::ranges::find_if(tags, [position](const Tag& tag) { return tag.index >= position; });
+        const auto        last     = std::ranges::find_if(first, tags.end(), [until = position + nProcess](const Tag& tag) { return tag.index >= until; });
+        if constexpr (requires { fnc(std::span<const T>(), std::span<const Tag>()); }) {
+            relevantTags.clear();
+            std::ranges::transform(first, last, std::back_inserter(relevantTags), [position](const Tag& tag) { return Tag{tag.index - position, tag.map}; });
+            fnc(std::span<const T>(readData), std::span<const Tag>(relevantTags));
+        } else {
+            fnc(std::span<const T>(readData));
+        }
+        std::ignore = tags.consume(static_cast<std::size_t>(std::distance(tags.begin(), last)));
+        std::ignore = readData.consume(nProcess);
+        return true;
+    }
+
+    /**
+     * @brief called by the sink (flow-graph thread): drops the oldest samples if the client lags more than `maxLag` samples behind.
+     * Best effort: skipped (and retried on the next call) if the client currently holds the mutex.
+     */
+    void dropIfLagging(std::size_t maxLag) {
+        if (blocking) {
+            return;
+        }
+        std::unique_lock lock(mutex, std::try_to_lock);
+        if (!lock.owns_lock() || reader.available() <= maxLag) {
+            return; // N.B. client is currently processing or keeps up
+        }
+
+        const std::size_t nDrop = reader.available() - maxLag;
+        {
+            auto dropped = reader.get(nDrop);
+            std::ignore  = dropped.consume(nDrop);
+        }
+        auto       tags  = tag_reader.get();
+        const auto first = std::ranges::find_if(tags, [position = reader.position()](const Tag& tag) { return tag.index >= position; }); // N.B. position already advanced
+        std::ignore      = tags.consume(static_cast<std::size_t>(std::distance(tags.begin(), first)));
+        drop_count += nDrop;
+    }
+};
+
+/**
+ * @brief min/max/mean summary of `count` consecutive samples starting at the absolute sample index `index`.
+ */
+template<typename T>
+struct Envelope {
+    using sum_type = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+    std::size_t index = 0UZ; // absolute index of the first sample
+    std::size_t count = 0UZ;
+    T           min   = std::numeric_limits<T>::max();
+    T           max   = std::numeric_limits<T>::lowest();
+    sum_type    sum   = sum_type(0);
+
+    [[nodiscard]] constexpr T mean() const noexcept { return count == 0UZ ? T(0) : static_cast<T>(sum / static_cast<sum_type>(count)); }
+
+    constexpr void merge(const Envelope& other) noexcept {
+        if (count == 0UZ) {
+            index = other.index;
+        }
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+        sum += other.sum;
+        count += other.count;
+    }
+};
+
+namespace detail {
+constexpr std::size_t data_sink_envelope_bucket_size = 16UZ;
+constexpr std::size_t data_sink_envelope_levels      = 8UZ;
+constexpr std::size_t data_sink_envelope_capacity    = 2048UZ;
+
+template<typename T>
+[[nodiscard]] Envelope<T> computeEnvelope(std::span<const T> samples, std::size_t firstIndex) noexcept {
+    Envelope<T> envelope{.index = firstIndex, .count = samples.size()};
+    std::size_t i = 0UZ;
+    if constexpr (std::is_floating_point_v<T>) { // lane-wise min/max/sum, reduced horizontally once per call
+        using simd_type              = vir::stdx::native_simd<T>;
+        constexpr std::size_t kWidth = simd_type::size();
+        if (samples.size() >= kWidth) {
+            simd_type vMin(samples.data(), vir::stdx::element_aligned);
+            simd_type vMax = vMin;
+            simd_type vSum = vMin;
+            for (i = kWidth; i + kWidth <= samples.size(); i += kWidth) {
+                const simd_type v(samples.data() + i, vir::stdx::element_aligned);
+                vMin = vir::stdx::min(vMin, v);
+                vMax = vir::stdx::max(vMax, v);
+                vSum += v;
+            }
+            envelope.min = vir::stdx::hmin(vMin);
+            envelope.max = vir::stdx::hmax(vMax);
+            envelope.sum = vir::stdx::reduce(vSum);
+        }
+    }
+    for (; i < samples.size(); ++i) {
+        envelope.min = std::min(envelope.min, samples[i]);
+        envelope.max = std::max(envelope.max, samples[i]);
+        envelope.sum += static_cast<typename Envelope<T>::sum_type>(samples[i]);
+    }
+    return envelope;
+}
+} // namespace detail
+
+/**
+ * @brief poller providing min/max/mean envelopes of the stream, e.g. for UI clients displaying O(1000) points per trace.
+ *
+ * The sink reduces the incoming samples into buckets of `bucketSize(0)` samples and aggregates these into a pyramid of zoom
+ * levels, each `kLevelFactor` times coarser than the previous one. Every level retains its latest `capacity` buckets, i.e.
+ * coarser levels reach further back in time. `get(..)` picks the level matching the requested range and resolution, so
+ * that clients do not need to fetch (and decimate) the full-rate stream.
+ */
+template<typename T>
+struct EnvelopePoller {
+    static constexpr std::size_t kLevelFactor = 4UZ;
+
+    mutable std::mutex                          mutex;   // serialises the sink's `push(..)` with the client's `get(..)`
+    std::vector<gr::HistoryBuffer<Envelope<T>>> levels;  // per level: completed buckets, newest first
+    std::vector<Envelope<T>>                    pending; // per level: bucket being accumulated
+    std::size_t                                 base_bucket_size  = detail::data_sink_envelope_bucket_size;
+    std::atomic<std::size_t>                    samples_processed = 0;
+    std::atomic<bool>                           finished          = false;
+
+    EnvelopePoller(std::size_t baseBucketSize, std::size_t nLevels, std::size_t capacity) : pending(std::max(nLevels, 1UZ)), base_bucket_size(std::max(baseBucketSize, 1UZ)) {
+        levels.reserve(pending.size());
+        for (std::size_t level = 0UZ; level < pending.size(); ++level) {
+            levels.emplace_back(std::max(capacity, 1UZ));
+        }
+    }
+
+    [[nodiscard]] std::size_t nLevels() const noexcept { return levels.size(); }
+
+    [[nodiscard]] std::size_t bucketSize(std::size_t level) const noexcept {
+        std::size_t size = base_bucket_size;
+        for (std::size_t l = 0UZ; l < level; ++l) {
+            size *= kLevelFactor;
+        }
+        return size;
+    }
+
+    /**
+     * @brief called by the sink (flow-graph thread): reduces `samples` into the level-0 buckets and propagates completed buckets up the pyramid.
+     */
+    void push(std::span<const T> samples) {
+        std::lock_guard lg(mutex);
+        std::size_t     index = samples_processed;
+        while (!samples.empty()) {
+            const std::size_t n = std::min(samples.size(), base_bucket_size - pending[0].count);
+            pending[0].merge(detail::computeEnvelope(samples.first(n), index));
+            samples = samples.subspan(n);
+            index += n;
+            if (pending[0].count == base_bucket_size) {
+                completeBucket(0UZ);
+            }
+        }
+        samples_processed = index;
+    }
+
+    /**
+     * @brief returns the completed buckets (oldest first) overlapping the sample range [fromIndex, toIndex).
+     *
+     * Selects the coarsest level providing at least `nPoints` buckets for the range, or a coarser one if the former does not
+     * reach back to `fromIndex` anymore.
+     */
+    [[nodiscard]] std::vector<Envelope<T>> get(std::size_t fromIndex, std::size_t toIndex, std::size_t nPoints) const {
+        std::lock_guard   lg(mutex);
+        const std::size_t range = toIndex > fromIndex ? toIndex - fromIndex : 0UZ;
+        std::size_t       level = 0UZ;
+        while (level + 1UZ < levels.size() && range / bucketSize(level + 1UZ) >= nPoints) {
+            ++level;
+        }
+        while (level + 1UZ < levels.size() && !levels[level].empty() && levels[level][levels[level].size() - 1UZ].index > fromIndex && !levels[level + 1UZ].empty()) {
+            ++level;
+        }
+
+        std::vector<Envelope<T>> result;
+        for (auto it = levels[level].rbegin(); it != levels[level].rend(); ++it) {
+            if (it->index + it->count > fromIndex && it->index < toIndex) {
+                result.push_back(*it);
+            }
+        }
+        return result;
+    }
+
+private:
+    void completeBucket(std::size_t level) {
+        levels[level].push_back(pending[level]);
+        if (level + 1UZ < pending.size()) {
+            pending[level + 1UZ].merge(pending[level]);
+            if (pending[level + 1UZ].count == bucketSize(level + 1UZ)) {
+                completeBucket(level + 1UZ);
+            }
+        }
+        pending[level] = Envelope<T>{};
+    }
+};
+
 template<typename T>
 struct DataSetPoller {
     gr::CircularBuffer<DataSet<T>> buffer = gr::CircularBuffer<DataSet<T>>(detail::data_sink_data_set_buffer_size);
@@ -197,6 +431,21 @@ public:
         return sink ? sink->getStreamingPoller(block) : nullptr;
     }
 
+    template<typename T>
+    std::shared_ptr<ZeroCopyPoller<T>> getZeroCopyPoller(const DataSinkQuery& query, BlockingMode block = BlockingMode::Blocking) {
+        std::lock_guard lg{_mutex};
+        auto            sink = find<DataSink<T>>(query);
+        return sink ? sink->getZeroCopyPoller(block) : nullptr;
+    }
+
+    template<typename T>
+    requires std::is_arithmetic_v<T>
+    std::shared_ptr<EnvelopePoller<T>> getEnvelopePoller(const DataSinkQuery& query, std::size_t baseBucketSize = detail::data_sink_envelope_bucket_size, std::size_t nLevels = detail::data_sink_envelope_levels, std::size_t capacity = detail::data_sink_envelope_capacity) {
+        std::lock_guard lg{_mutex};
+        auto            sink = find<DataSink<T>>(query);
+        return sink ? sink->getEnvelopePoller(baseBucketSize, nLevels, capacity) : nullptr;
+    }
+
     template<typename T, trigger::Matcher M>
     std::shared_ptr<DataSetPoller<T>> getTriggerPoller(const DataSinkQuery& query, M&& matcher, std::size_t preSamples, std::size_t postSamples, BlockingMode block = BlockingMode::Blocking) {
         std::lock_guard lg{_mutex};
@@ -418,6 +667,8 @@ template<typename T>
  * Pollers can be configured to be blocking, i.e. blocks the flow-graph
  * if data is not being retrieved in time, or non-blocking, i.e. data being dropped when
  * the user-defined buffer size is full.
+ * Zero-copy pollers (@see getZeroCopyPoller) hand out views directly into the sink's input buffer instead of a copy.
+ * Envelope pollers (@see getEnvelopePoller) provide min/max/mean envelopes at multiple zoom levels for display purposes.
  * N.B. due to the nature of the GR scheduler, signals from the same sink are notified
  * synchronously (/asynchronously) if handled by the same (/different) sink block.
  *
@@ -456,6 +707,8 @@ or register a callback that is invoked by the sink if the user-conditions are me
 Pollers can be configured to be blocking, i.e. blocks the flow-graph
 if data is not being retrieved in time, or non-blocking, i.e. data being dropped when
 the user-defined buffer size is full.
+Zero-copy pollers (@see getZeroCopyPoller) hand out views directly into the sink's input buffer instead of a copy.
+Envelope pollers (@see getEnvelopePoller) provide min/max/mean envelopes at multiple zoom levels for display purposes.
 N.B. due to the nature of the GR scheduler, signals from the same sink are notified
 synchronously (/asynchronously) if handled by the same (/different) sink block.
 
@@ -466,14 +719,16 @@ This block type is mean for non-data set input streams. For input streams of typ
 )"">;
     struct AbstractListener;
 
-    std::deque<std::unique_ptr<AbstractListener>> _listeners;
-    bool                                          _listeners_finished = false;
-    std::mutex                                    _listener_mutex;
-    std::optional<gr::HistoryBuffer<T>>           _history;
-    bool                                          _registered = false;
+    trigger::BasicTriggerNameCtxMatcher::Dispatcher _triggerDispatcher; // N.B. declared before (i.e. outlives) the listeners' subscriptions
+    std::deque<std::unique_ptr<AbstractListener>>   _listeners;
+    std::vector<std::weak_ptr<ZeroCopyPoller<T>>>   _zeroCopyPollers;
+    bool                                            _listeners_finished = false;
+    std::mutex                                      _listener_mutex;
+    std::optional<gr::HistoryBuffer<T>>             _history;
+    bool                                            _registered = false;
 
 public:
-    PortIn<T, RequiredSamples<std::dynamic_extent, detail::data_sink_buffer_size>> in;
+    detail::DataSinkInputPort<T> in;
 
     Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate = 1.f;
     Annotated<std::string, "signal name", Visible>                                   signal_name = "unknown signal";
@@ -505,13 +760,42 @@ public:
         return handler;
     }
 
+    /**
+     * @brief returns a poller that reads directly from this sink's input buffer (zero-copy), @see ZeroCopyPoller.
+     * N.B. requires a connected input port, i.e. should be requested once the flow-graph is running.
+     */
+    std::shared_ptr<ZeroCopyPoller<T>> getZeroCopyPoller(BlockingMode blockMode = BlockingMode::Blocking) {
+        std::lock_guard lg(_listener_mutex);
+        if (!in.isConnected()) {
+            return nullptr;
+        }
+        auto [streamBuffer, tagBuffer] = in.buffer();
+        auto handler                   = std::make_shared<ZeroCopyPoller<T>>(streamBuffer.new_reader(), tagBuffer.new_reader(), blockMode == BlockingMode::Blocking);
+        handler->finished              = _listeners_finished;
+        _zeroCopyPollers.push_back(handler);
+        return handler;
+    }
+
+    /**
+     * @brief returns a poller providing min/max/mean envelopes of the stream at multiple zoom levels, @see EnvelopePoller.
+     */
+    std::shared_ptr<EnvelopePoller<T>> getEnvelopePoller(std::size_t baseBucketSize = detail::data_sink_envelope_bucket_size, std::size_t nLevels = detail::data_sink_envelope_levels, std::size_t capacity = detail::data_sink_envelope_capacity)
+    requires std::is_arithmetic_v<T>
+    {
+        auto            handler = std::make_shared<EnvelopePoller<T>>(baseBucketSize, nLevels, capacity);
+        std::lock_guard lg(_listener_mutex);
+        handler->finished = _listeners_finished;
+        addListener(std::make_unique<EnvelopeListener>(handler), false);
+        return handler;
+    }
+
     template<trigger::Matcher M>
     std::shared_ptr<DataSetPoller<T>> getTriggerPoller(M&& matcher, std::size_t preSamples, std::size_t postSamples, BlockingMode blockMode = BlockingMode::Blocking) {
         const auto      block   = blockMode == BlockingMode::Blocking;
         auto            handler = std::make_shared<DataSetPoller<T>>();
         std::lock_guard lg(_listener_mutex);
         handler->finished = _listeners_finished;
-        addListener(std::make_unique<TriggerListener<gr::meta::null_type, M>>(std::forward<M>(matcher), handler, preSamples, postSamples, block), block);
+        addListener(std::make_unique<TriggerListener<gr::meta::null_type, BoundMatcher<M>>>(bindMatcher(std::forward<M>(matcher)), handler, preSamples, postSamples, block), block);
         ensureHistorySize(preSamples);
         return handler;
     }
@@ -521,7 +805,7 @@ public:
         std::lock_guard lg(_listener_mutex);
         const auto      block   = blockMode == BlockingMode::Blocking;
         auto            handler = std::make_shared<DataSetPoller<T>>();
-        addListener(std::make_unique<MultiplexedListener<gr::meta::null_type, M>>(std::forward<M>(matcher), maximumWindowSize, handler, block), block);
+        addListener(std::make_unique<MultiplexedListener<gr::meta::null_type, BoundMatcher<M>>>(bindMatcher(std::forward<M>(matcher)), maximumWindowSize, handler, block), block);
         return handler;
     }
 
@@ -530,7 +814,7 @@ public:
         const auto      block   = blockMode == BlockingMode::Blocking;
         auto            handler = std::make_shared<DataSetPoller<T>>();
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<SnapshotListener<gr::meta::null_type, M>>(std::forward<M>(matcher), delay, handler, block), block);
+        addListener(std::make_unique<SnapshotListener<gr::meta::null_type, BoundMatcher<M>>>(bindMatcher(std::forward<M>(matcher)), delay, handler, block), block);
         return handler;
     }
 
@@ -543,20 +827,20 @@ public:
     template<trigger::Matcher M, DataSetCallback<T> Callback>
     void registerTriggerCallback(M&& matcher, std::size_t preSamples, std::size_t postSamples, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<TriggerListener<Callback, M>>(std::forward<M>(matcher), preSamples, postSamples, std::forward<Callback>(callback)), false);
+        addListener(std::make_unique<TriggerListener<Callback, BoundMatcher<M>>>(bindMatcher(std::forward<M>(matcher)), preSamples, postSamples, std::forward<Callback>(callback)), false);
         ensureHistorySize(preSamples);
     }
 
     template<trigger::Matcher M, DataSetCallback<T> Callback>
     void registerMultiplexedCallback(M&& matcher, std::size_t maximumWindowSize, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<MultiplexedListener<Callback, M>>(std::forward<M>(matcher), maximumWindowSize, std::forward<Callback>(callback)), false);
+        addListener(std::make_unique<MultiplexedListener<Callback, BoundMatcher<M>>>(bindMatcher(std::forward<M>(matcher)), maximumWindowSize, std::forward<Callback>(callback)), false);
     }
 
     template<trigger::Matcher M, DataSetCallback<T> Callback>
     void registerSnapshotCallback(M&& matcher, std::chrono::nanoseconds delay, Callback&& callback) {
         std::lock_guard lg(_listener_mutex);
-        addListener(std::make_unique<SnapshotListener<Callback, M>>(std::forward<M>(matcher), delay, std::forward<Callback>(callback)), false);
+        addListener(std::make_unique<SnapshotListener<Callback, BoundMatcher<M>>>(bindMatcher(std::forward<M>(matcher)), delay, std::forward<Callback>(callback)), false);
     }
 
     void start() noexcept {
@@ -571,6 +855,11 @@ public:
         for (auto& listener : _listeners) {
             listener->stop();
         }
+        for (auto& weakPoller : _zeroCopyPollers) {
+            if (auto poller = weakPoller.lock()) {
+                poller->finished = true;
+            }
+        }
         _listeners_finished = true;
     }
 
@@ -587,17 +876,45 @@ public:
             std::lock_guard lg(_listener_mutex); // TODO review/profile if a lock-free data structure should be used here
             const auto      historyView = _history ? _history->get_span(0) : std::span<const T>();
             std::erase_if(_listeners, [](const auto& l) { return l->expired; });
+            if (tagData && _triggerDispatcher.size() > 0UZ) {
+                _triggerDispatcher.dispatch(Tag{0, *tagData}); // evaluates the compiled matchers of all listeners at once
+            }
             for (auto& listener : _listeners) {
                 listener->process(historyView, inData, tagData);
             }
             if (_history) {
                 _history->push_back_bulk(inData.begin(), inData.end());
             }
+
+            std::erase_if(_zeroCopyPollers, [](const auto& weakPoller) { return weakPoller.expired(); });
+            for (auto& weakPoller : _zeroCopyPollers) {
+                if (auto poller = weakPoller.lock()) {
+                    poller->dropIfLagging(in.bufferSize() / 2UZ);
+                }
+            }
         }
         return work::Status::OK;
     }
 
 private:
+    template<typename M>
+    static constexpr bool isDispatchedMatcher = std::is_same_v<std::remove_cvref_t<M>, trigger::BasicTriggerNameCtxMatcher::Compiled>;
+
+    template<typename M>
+    using BoundMatcher = std::conditional_t<isDispatchedMatcher<M>, trigger::BasicTriggerNameCtxMatcher::Subscription, M>;
+
+    /**
+     * @brief compiled filter matchers are registered with the sink's dispatch table instead of being evaluated per listener.
+     */
+    template<trigger::Matcher M>
+    BoundMatcher<M> bindMatcher(M&& matcher) {
+        if constexpr (isDispatchedMatcher<M>) {
+            return trigger::BasicTriggerNameCtxMatcher::Subscription(_triggerDispatcher, matcher.definition);
+        } else {
+            return std::forward<M>(matcher);
+        }
+    }
+
     void ensureHistorySize(std::size_t new_size) {
         const auto old_size = _history ? _history->capacity() : std::size_t{0};
         if (new_size <= old_size) {
@@ -641,12 +958,22 @@ private:
         bool                            isBlocking = false;
         std::weak_ptr<DataSetPoller<T>> poller;
         Callback                        callback;
+        DataSetPool<T>                  dataSetPool; // storage recycled from the poller's buffer slots and dropped DataSets
 
         template<typename CallbackFW>
         explicit DataSetBaseListener(CallbackFW&& callback_) : callback(std::forward<CallbackFW>(callback_)) {}
 
         explicit DataSetBaseListener(std::shared_ptr<DataSetPoller<T>> poller_, bool isBlocking_) : isBlocking(isBlocking_), poller(std::move(poller_)) {}
 
+        /**
+         * @brief returns a copy of `dataSetTemplate` that re-uses the storage of a previously published DataSet if available.
+         */
+        [[nodiscard]] DataSet<T> acquireDataSet(const DataSet<T>& dataSetTemplate) {
+            DataSet<T> dataSet = dataSetPool.acquire();
+            dataSet            = dataSetTemplate; // N.B. copy-assignment re-uses the existing capacities
+            return dataSet;
+        }
+
         inline void publishDataSet(DataSet<T>&& data) {
             if constexpr (!std::is_same_v<Callback, gr::meta::null_type>) {
                 callback(std::move(data));
@@ -659,10 +986,11 @@ private:
 
                 if (isBlocking || pollerPtr->writer.available() > 0) {
                     auto writeData = pollerPtr->writer.reserve(1);
-                    writeData[0]   = std::move(data);
+                    dataSetPool.publish(writeData[0], std::move(data)); // moves into the slot, recycles the slot's consumed DataSet
                     writeData.publish(1);
                 } else {
                     pollerPtr->drop_count++;
+                    dataSetPool.recycle(std::move(data));
                 }
             }
         }
@@ -796,6 +1124,29 @@ private:
         }
     };
 
+    struct EnvelopeListener : public AbstractListener {
+        std::weak_ptr<EnvelopePoller<T>> poller;
+
+        explicit EnvelopeListener(std::shared_ptr<EnvelopePoller<T>> poller_) : poller(std::move(poller_)) {}
+
+        void setMetadata(detail::Metadata) override {}
+
+        void process(std::span<const T>, std::span<const T> data, std::optional<property_map>) override {
+            auto pollerPtr = poller.lock();
+            if (!pollerPtr) {
+                this->setExpired();
+                return;
+            }
+            pollerPtr->push(data);
+        }
+
+        void stop() override {
+            if (auto p = poller.lock()) {
+                p->finished = true;
+            }
+        }
+    };
+
     struct PendingWindow {
         DataSet<T>  dataset;
         std::size_t pending_post_samples = 0;
@@ -821,7 +1172,7 @@ private:
 
         void process(std::span<const T> history, std::span<const T> inData, std::optional<property_map> tagData0) override {
             if (tagData0 && trigger_matcher("", Tag{0, *tagData0}, trigger_matcher_state) == trigger::MatchResult::Matching) {
-                DataSet<T> dataset = dataset_template;
+                DataSet<T> dataset = this->acquireDataSet(dataset_template);
                 dataset.signal_values.reserve(preSamples + postSamples); // TODO maybe make the circ. buffer smaller but preallocate these
 
                 const auto preSampleView = history.subspan(0UZ, std::min(preSamples, history.size()));
@@ -888,7 +1239,7 @@ private:
                     }
                 }
                 if (obsr == trigger::MatchResult::Matching) {
-                    pending_dataset = dataset_template;
+                    pending_dataset = this->acquireDataSet(dataset_template);
                     pending_dataset->signal_values.reserve(maximumWindowSize); // TODO might be too much?
                     pending_dataset->timing_events = {{{0, *tagData0}}};
                 }
@@ -957,9 +1308,9 @@ private:
                     break;
                 }
 
-                DataSet<T> dataset    = dataset_template;
+                DataSet<T> dataset    = this->acquireDataSet(dataset_template);
                 dataset.timing_events = {{{-static_cast<std::ptrdiff_t>(it->delay), std::move(it->tag_data)}}};
-                dataset.signal_values = {inData[it->pending_samples]};
+                dataset.signal_values.assign(1UZ, inData[it->pending_samples]);
                 this->publishDataSet(std::move(dataset));
                 it = pending.erase(it);
             }
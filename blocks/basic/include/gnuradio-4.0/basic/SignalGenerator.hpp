@@ -3,8 +3,11 @@
 
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/algorithm/NCO.hpp>
 
-#include <numbers>
+#include <algorithm>
+#include <cmath>
+#include <span>
 
 namespace gr::basic {
 
@@ -37,6 +40,9 @@ The following signal shapes are supported (A = amplitude, f = frequency, P = pha
 
 For the Square, Saw and Triangle t corresponds to phase adjusted time t = t + P / (pi2 * f)
 
+The phase is tracked by a 64-bit integer phase accumulator (see gr::algorithm::NCO), i.e. the signal does not drift over long
+runs and remains phase-continuous when 'frequency' or 'phase' are changed.
+
 * Sine
 This waveform represents a smooth periodic oscillation.
 formula: s(t) = A * sin(2 * pi * f * t + P) + O
@@ -73,45 +79,44 @@ s(t) = A * (4 * abs(t * f - floor(t * f + 0.75) + 0.25) - 1) + O
 
     GR_MAKE_REFLECTABLE(SignalGenerator, in, out, sample_rate, signal_type, frequency, amplitude, offset, phase);
 
-    T _currentTime = T(0.);
-
-    signal_generator::Type _signalType = signal_generator::parse(signal_type);
-    T                      _timeTick   = T(1.) / T(sample_rate);
+    signal_generator::Type _signalType   = signal_generator::parse(signal_type);
+    gr::algorithm::NCO<T>  _nco;
+    T                      _appliedPhase = T(0.);
 
     void settingsChanged(const property_map& /*old_settings*/, const property_map& /*new_settings*/) {
         _signalType = signal_generator::parse(signal_type);
-        _timeTick   = T(1.) / T(sample_rate);
+        _nco.setFrequency(static_cast<double>(frequency), static_cast<double>(sample_rate));
+        _nco.adjustPhase(static_cast<double>(phase - _appliedPhase));
+        _appliedPhase = phase;
     }
 
-    [[nodiscard]] constexpr T processOne(T /*input*/) noexcept {
+    [[nodiscard]] work::Status processBulk(std::span<const std::uint8_t> /*input*/, std::span<T> output) noexcept {
         using enum signal_generator::Type;
 
-        constexpr T pi2 = T(2.) * std::numbers::pi_v<T>;
-        T           value{};
-        T           phaseAdjustedTime = _currentTime + phase / (pi2 * frequency);
-
         switch (_signalType) {
-        case Sin: value = amplitude * std::sin(pi2 * frequency * phaseAdjustedTime) + offset; break;
-        case Cos: value = amplitude * std::cos(pi2 * frequency * phaseAdjustedTime) + offset; break;
-        case Const: value = amplitude + offset; break;
-        case Square: {
-            T halfPeriod       = T(0.5) / frequency;
-            T timeWithinPeriod = std::fmod(phaseAdjustedTime, T(2.) * halfPeriod);
-            value              = (timeWithinPeriod < halfPeriod) ? amplitude + offset : -amplitude + offset;
+        case Const:
+            std::ranges::fill(output, amplitude + offset);
+            _nco.advance(output.size());
+            return work::Status::OK;
+        case Sin: _nco.generateSin(output); break;
+        case Cos: _nco.generateCos(output); break;
+        case Square:
+            _nco.generateTurns(output);
+            std::ranges::transform(output, output.begin(), [](T x) { return x < T(0.5) ? T(1.) : T(-1.); });
             break;
-        }
-        case Saw: value = amplitude * (T(2.) * (phaseAdjustedTime * frequency - std::floor(phaseAdjustedTime * frequency + T(0.5)))) + offset; break;
-        case Triangle: {
-            T tmp = phaseAdjustedTime * frequency;
-            value = amplitude * (T(4.0) * std::abs(tmp - std::floor(tmp + T(0.75)) + T(0.25)) - T(1.0)) + offset;
+        case Saw:
+            _nco.generateTurns(output);
+            std::ranges::transform(output, output.begin(), [](T x) { return T(2.) * (x - std::floor(x + T(0.5))); });
             break;
+        case Triangle:
+            _nco.generateTurns(output);
+            std::ranges::transform(output, output.begin(), [](T x) { return T(4.) * std::abs(x - std::floor(x + T(0.75)) + T(0.25)) - T(1.); });
+            break;
+        default: std::ranges::fill(output, T(0.)); return work::Status::OK;
         }
-        default: value = T(0.);
-        }
-
-        _currentTime += _timeTick;
 
-        return value;
+        std::ranges::transform(output, output.begin(), [a = static_cast<T>(amplitude), o = static_cast<T>(offset)](T y) { return a * y + o; });
+        return work::Status::OK;
     }
 };
 
@@ -24,7 +24,9 @@ but configurations like Start-Start-Stop-Stop result in undefined behavior.
 If data accumulation is active, the second 'start' is ignored, and the output may vary depending on subsequent tags.
 * Tags for pre-samples are not stored and are not included in the output.
 * It is expected that 'start' and 'stop' Tags will come from different iterations.
-If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataSet is created. This may lead to incorrect or unexpected output.)">;
+If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataSet is created. This may lead to incorrect or unexpected output.
+* In stream-to-dataset mode with 'pre_allocate' enabled, the DataSet storage is reserved up-front (single trigger: n_pre + n_post,
+start/stop: n_max if set) and the storage of already consumed DataSets is recycled from the output buffer.)">;
 
     constexpr static std::size_t MIN_BUFFER_SIZE = 1024U;
     template<typename U, gr::meta::fixed_string description = "", typename... Arguments> // optional annotation shortening
@@ -37,9 +39,10 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
 
     // settings
     A<std::string, "filter", Visible, Doc<"syntax: '[<start trigger name>/<ctx1>, <stop trigger name>/<ctx2>]'">> filter;
-    A<gr::Size_t, "n samples pre", Visible, Doc<"number of pre-trigger samples">>                                 n_pre  = 0U; // Note: It is assumed that n_pre <= output port CircularBuffer size, and we wait until all n_pre samples can be written to the output in a single iteration.
-    A<gr::Size_t, "n samples post", Visible, Doc<"number of post-trigger samples">>                               n_post = 0U;
-    A<gr::Size_t, "n samples max", Doc<"maximum number of samples (0: infinite)">>                                n_max  = 0U;
+    A<gr::Size_t, "n samples pre", Visible, Doc<"number of pre-trigger samples">>                                 n_pre        = 0U; // Note: It is assumed that n_pre <= output port CircularBuffer size, and we wait until all n_pre samples can be written to the output in a single iteration.
+    A<gr::Size_t, "n samples post", Visible, Doc<"number of post-trigger samples">>                               n_post       = 0U;
+    A<gr::Size_t, "n samples max", Doc<"maximum number of samples (0: infinite)">>                                n_max        = 0U;
+    A<bool, "pre-allocate", Doc<"true: reserve exact DataSet capacity and recycle DataSet storage">>              pre_allocate = true;
 
     // meta information (will be usually set by incoming tags/upstream sources
     A<float, "sample_rate", Doc<"signal sample rate">>                                                       sample_rate = 1.f;
@@ -49,11 +52,15 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     A<float, "signal_min", Doc<"signal physical max. (e.g. DAQ) limit">>                                     signal_min = 0.f;
     A<float, "signal_max", Doc<"signal physical max. (e.g. DAQ) limit">>                                     signal_max = 1.f;
 
-    GR_MAKE_REFLECTABLE(StreamFilterImpl, filter, in, out, filter, n_pre, n_post, n_max, sample_rate, signal_name, signal_quantity, signal_unit, signal_min, signal_max);
+    GR_MAKE_REFLECTABLE(StreamFilterImpl, filter, in, out, filter, n_pre, n_post, n_max, pre_allocate, sample_rate, signal_name, signal_quantity, signal_unit, signal_min, signal_max);
 
     // internal trigger state
-    HistoryBuffer<T> _history{MIN_BUFFER_SIZE + n_pre};
-    TMatcher         _matcher{};
+    static constexpr bool kCompiledFilter = std::is_same_v<TMatcher, trigger::BasicTriggerNameCtxMatcher::Filter>; // default matcher: 'filter' is parsed once rather than per tag
+    using FilterState                     = std::conditional_t<kCompiledFilter, trigger::BasicTriggerNameCtxMatcher::CompiledState, property_map>;
+
+    HistoryBuffer<T>                                    _history{MIN_BUFFER_SIZE + n_pre};
+    TMatcher                                            _matcher{};
+    trigger::BasicTriggerNameCtxMatcher::CompiledFilter _compiledFilter;
 
     struct AccumulationState {
         bool        isActive           = false;
@@ -104,14 +111,16 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
 
     std::conditional_t<streamOut, AccumulationState, std::deque<AccumulationState>> _accState{};
     std::deque<DataSet<T>>                                                          _tempDataSets;
-    std::conditional_t<streamOut, property_map, std::deque<property_map>>           _filterState;
+    DataSetPool<T>                                                                  _dataSetPool; // recycled (cleared) DataSets
+    std::conditional_t<streamOut, FilterState, std::deque<FilterState>>             _filterState;
 
     void reset() {
-        _filterState.clear();
+        _filterState = {};
         if constexpr (streamOut) {
             _accState.reset();
         } else {
             _tempDataSets.clear();
+            _dataSetPool.clear();
             _accState.clear();
         }
     }
@@ -199,11 +208,10 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     gr::work::Status processBulkDataSet(InputSpanLike auto& inSamples, OutputSpanLike auto& outSamples) {
         //    This is a workaround to support cases of overlapping datasets, for example, Start1-Start2-Stop1-Stop2 case.
         //    always add new DataSet when Start trigger is present
-        property_map tmpFilterState;
+        FilterState tmpFilterState{};
         const auto [startTrigger, endTrigger, isSingleTrigger] = detectTrigger(tmpFilterState);
         if (startTrigger) {
-            _tempDataSets.emplace_back();
-            initNewDataSet(_tempDataSets.back());
+            _tempDataSets.push_back(acquireDataSet(isSingleTrigger));
 
             _accState.emplace_back();
             _accState.back().update(startTrigger, endTrigger, isSingleTrigger, n_pre, n_post);
@@ -286,7 +294,12 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
                 if (!ds.signal_values.empty()) { // TODO: do we need to publish empty  DataSet at all, empty DataSet can occur when n_max is set.
                     gr::dataset::updateMinMax(ds);
                 }
-                outSamples[publishedCounter] = std::move(ds);
+                if (pre_allocate) {
+                    // N.B. the output slot holds an already consumed DataSet whose storage can be reused
+                    _dataSetPool.publish(outSamples[publishedCounter], std::move(ds));
+                } else {
+                    outSamples[publishedCounter] = std::move(ds);
+                }
                 _tempDataSets.pop_front();
                 _accState.pop_front();
                 _filterState.pop_front();
@@ -301,19 +314,38 @@ If multiple 'start' or 'stop' Tags arrive in a single merged tag, only one DataS
     }
 
 private:
-    auto detectTrigger(property_map& filterState) {
+    auto detectTrigger(FilterState& filterState) {
         struct {
             bool startTrigger    = false;
             bool endTrigger      = false;
             bool isSingleTrigger = false;
         } result;
 
-        const trigger::MatchResult matchResult = _matcher(filter.value, this->mergedInputTag(), filterState);
+        trigger::MatchResult matchResult;
+        if constexpr (kCompiledFilter) {
+            using namespace trigger::BasicTriggerNameCtxMatcher;
+            if (_compiledFilter.definition != filter.value) { // N.B. a changed filter resets all trigger states (same as `verifyFilterState(..)`)
+                _compiledFilter = CompiledFilter::compile(filter.value);
+                if constexpr (streamOut) {
+                    _filterState = {};
+                } else {
+                    std::ranges::fill(_filterState, CompiledState{});
+                }
+                filterState = {};
+            }
+            matchResult = match(_compiledFilter, TriggerInfo::fromTag(this->mergedInputTag()), filterState);
+        } else {
+            matchResult = _matcher(filter.value, this->mergedInputTag(), filterState);
+        }
         if (matchResult != trigger::MatchResult::Ignore) {
-            assert(filterState.contains("isSingleTrigger"));
-            result.startTrigger    = matchResult == trigger::MatchResult::Matching;
-            result.endTrigger      = matchResult == trigger::MatchResult::NotMatching;
-            result.isSingleTrigger = std::get<bool>(filterState.at("isSingleTrigger"));
+            result.startTrigger = matchResult == trigger::MatchResult::Matching;
+            result.endTrigger   = matchResult == trigger::MatchResult::NotMatching;
+            if constexpr (kCompiledFilter) {
+                result.isSingleTrigger = _compiledFilter.isSingleTrigger;
+            } else {
+                assert(filterState.contains("isSingleTrigger"));
+                result.isSingleTrigger = std::get<bool>(filterState.at("isSingleTrigger"));
+            }
         }
         return result;
     }
@@ -326,10 +358,32 @@ private:
     }
 
     void fillAxisValues(DataSet<T>& ds, int start, std::size_t nSamples) {
-        ds.axis_values[0].reserve(ds.axis_values[0].size() + nSamples);
-        for (int j = 0; j < static_cast<int>(nSamples); j++) {
-            ds.axis_values[0].emplace_back(static_cast<float>(start + j) / sample_rate);
+        auto&             axis   = ds.axis_values[0];
+        const std::size_t offset = axis.size();
+        axis.resize(offset + nSamples); // N.B. geometric growth unless pre-allocated, 'reserve(size + n)' would re-allocate for every chunk
+        for (std::size_t j = 0UZ; j < nSamples; j++) {
+            axis[offset + j] = static_cast<T>(static_cast<float>(start + static_cast<int>(j)) / sample_rate);
+        }
+    }
+
+    [[nodiscard]] std::size_t expectedDataSetSize(bool isSingleTrigger) const noexcept {
+        const std::size_t nMax = static_cast<std::size_t>(n_max.value);
+        if (isSingleTrigger) {
+            const std::size_t nTotal = static_cast<std::size_t>(n_pre.value) + static_cast<std::size_t>(n_post.value);
+            return nMax != 0UZ ? std::min(nTotal, nMax) : nTotal;
+        }
+        return nMax; // start/stop: unknown length, bounded by n_max (0: infinite -> no pre-allocation)
+    }
+
+    [[nodiscard]] DataSet<T> acquireDataSet(bool isSingleTrigger) {
+        DataSet<T> dataSet = pre_allocate ? _dataSetPool.acquire() : DataSet<T>{};
+        initNewDataSet(dataSet);
+        if (pre_allocate) {
+            const std::size_t nSamples = expectedDataSetSize(isSingleTrigger);
+            dataSet.signal_values.reserve(nSamples);
+            dataSet.axis_values[0].reserve(nSamples);
         }
+        return dataSet;
     }
 
     void initNewDataSet(DataSet<T>& dataSet) const {
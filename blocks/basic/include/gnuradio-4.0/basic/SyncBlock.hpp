@@ -142,6 +142,26 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
         std::size_t nPost; // number of post samples, sample with sync index is not included
     };
 
+    struct SyncTag {
+        std::size_t   index; // absolute stream index
+        std::uint64_t time;
+    };
+
+    /**
+     * @brief per-port index of the not yet consumed sync tags, maintained incrementally across `processBulk` calls so that
+     * the tag maps of each tag are inspected only once.
+     */
+    struct SyncTagIndex {
+        std::vector<SyncTag>       tags;            // ordered by stream index
+        std::vector<std::uint64_t> times;           // the same trigger times, sorted ascending (N.B. need not be monotonic in stream index)
+        std::size_t                nextIndex = 0UZ; // tags before this absolute stream index have already been indexed
+    };
+
+    std::vector<SyncTagIndex>  _syncTagIndex{};
+    std::vector<SyncData>      _syncData{};     // re-used across calls
+    std::vector<std::uint64_t> _allSyncTimes{}; // merge-join candidates, re-used across calls
+    std::vector<std::size_t>   _cursors{};      // merge-join per-port cursors, re-used across calls
+
     void settingsChanged(const property_map& oldSettings, const property_map& newSettings) {
         if (newSettings.contains("n_ports") && oldSettings.at("n_ports") != newSettings.at("n_ports")) {
             // if one of the port is already connected and n_ports was changed then throw
@@ -156,6 +176,10 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
             _nDroppedSamples.resize(n_ports, 0UZ);
         }
 
+        if (newSettings.contains("filter")) {
+            _syncTagIndex.clear(); // sync tag classification depends on the filter -> re-index
+        }
+
         if (newSettings.contains("max_history_size")) {
             // should be less than actual buffer size (better < 80%)
             // The logic has to be implemented when the new Port API is available
@@ -166,8 +190,9 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
     gr::work::Status processBulk(const std::span<TInput>& ins, std::span<TOutput>& outs) {
         std::size_t nPorts = ins.size();
 
-        const std::vector<SyncData> syncData = synchronize(ins);
-        const bool                  canSync  = !syncData.empty();
+        updateSyncTagIndex(ins);
+        const bool  canSync  = synchronize(ins);
+        const auto& syncData = _syncData;
 
         if (canSync) {
             const std::size_t minPre            = std::ranges::min(syncData | std::views::transform([](const SyncData& data) { return data.nPre; }));
@@ -192,9 +217,12 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
             }
             _isStreamSynchronized = true;
         } else {
-            const std::size_t minSamplesBeforeSyncTag = std::ranges::min(ins | std::views::transform([&](const auto& in) { return getNSamplesBeforeSyncTag(in); }));
-            const std::size_t minSamplesOut           = std::ranges::min(outs | std::views::transform([&](const auto& out) { return out.size(); }));
-            const std::size_t nSamplesToCopy          = std::min(minSamplesBeforeSyncTag, minSamplesOut);
+            std::size_t minSamplesBeforeSyncTag = std::numeric_limits<std::size_t>::max();
+            for (std::size_t i = 0; i < nPorts; i++) {
+                minSamplesBeforeSyncTag = std::min(minSamplesBeforeSyncTag, getNSamplesBeforeSyncTag(ins[i], _syncTagIndex[i]));
+            }
+            const std::size_t minSamplesOut  = std::ranges::min(outs | std::views::transform([&](const auto& out) { return out.size(); }));
+            const std::size_t nSamplesToCopy = std::min(minSamplesBeforeSyncTag, minSamplesOut);
             if (_isStreamSynchronized && nSamplesToCopy > 0UZ) { // all streams are in sync -> write sample before first Sync tag
                 for (std::size_t i = 0; i < nPorts; i++) {
                     std::ranges::copy_n(ins[i].begin(), static_cast<std::ptrdiff_t>(nSamplesToCopy), outs[i].begin());
@@ -248,88 +276,119 @@ struct SyncBlock : public gr::Block<SyncBlock<T>, NoDefaultTagForwarding, SyncBl
     }
 
     template<InputSpanLike TInput>
-    [[nodiscard]] constexpr std::vector<SyncData> synchronize(const std::span<TInput>& ins) {
-        const std::uint64_t syncTime = findSyncTime(ins);
-        if (syncTime == std::numeric_limits<std::uint64_t>::max()) {
-            return {};
+    void updateSyncTagIndex(const std::span<TInput>& ins) {
+        if (_syncTagIndex.size() != ins.size()) {
+            _syncTagIndex.assign(ins.size(), SyncTagIndex{});
         }
+        for (std::size_t i = 0UZ; i < ins.size(); i++) {
+            const auto& in    = ins[i];
+            auto&       index = _syncTagIndex[i];
+
+            // remove consumed sync tags
+            const auto firstValid = std::ranges::find_if(index.tags, [&in](const SyncTag& tag) { return tag.index >= in.streamIndex; });
+            for (auto it = index.tags.begin(); it != firstValid; ++it) {
+                index.times.erase(std::ranges::lower_bound(index.times, it->time));
+            }
+            index.tags.erase(index.tags.begin(), firstValid);
 
-        std::vector<SyncData> syncData;
-        syncData.reserve(ins.size());
-        for (const auto& inSpan : ins) {
-            for (const auto& tag : inSpan.rawTags) {
-                const std::size_t relativeTagIndex = getRelativeTagIndex(inSpan, tag);
-                if (isTimeDifferenceWithinTolerance(getTime(tag), syncTime) && relativeTagIndex != std::numeric_limits<std::size_t>::max()) {
-                    const std::size_t nPre  = getAvailablePreSamples(inSpan, relativeTagIndex);
-                    const std::size_t nPost = getAvailablePostSamples(inSpan, relativeTagIndex);
-                    syncData.push_back({relativeTagIndex, nPre, nPost});
-                    break;
+            // remove sync tags beyond the current span (i.e. if fewer samples are available than before), re-indexed once visible again
+            const std::size_t endIndex = in.streamIndex + in.size();
+            while (!index.tags.empty() && index.tags.back().index >= endIndex) {
+                index.times.erase(std::ranges::lower_bound(index.times, index.tags.back().time));
+                index.tags.pop_back();
+            }
+            index.nextIndex = std::min(index.nextIndex, endIndex);
+
+            // add sync tags of newly arrived samples
+            for (const auto& tag : in.rawTags) {
+                if (tag.index >= endIndex) {
+                    break; // tags are ordered
+                }
+                if (tag.index < std::max(index.nextIndex, in.streamIndex) || !isSyncTag(tag)) {
+                    continue;
                 }
+                const std::uint64_t time = getTime(tag);
+                index.tags.push_back({tag.index, time});
+                index.times.insert(std::ranges::upper_bound(index.times, time), time); // N.B. appends for monotonic trigger times
             }
+            index.nextIndex = endIndex;
         }
-
-        assert(ins.size() == syncData.size());
-
-        return syncData;
     }
 
     template<InputSpanLike TInput>
-    [[nodiscard]] constexpr std::uint64_t findSyncTime(const std::span<TInput>& ins) {
-        std::vector<std::vector<std::uint64_t>> syncTimesPerInSpan; // Collect sync times for each input span
-        syncTimesPerInSpan.reserve(ins.size());
-        std::set<std::uint64_t> allSyncTimes; // Collect all unique sync times, ordered
-        for (const auto& inSpan : ins) {
-            std::vector<std::uint64_t> syncTimes;
-            for (const auto& tag : inSpan.rawTags) {
-                const std::size_t relativeTagIndex = getRelativeTagIndex(inSpan, tag);
-                if (isSyncTag(tag) && relativeTagIndex < inSpan.size() && relativeTagIndex != std::numeric_limits<std::size_t>::max()) {
-                    const std::uint64_t time = getTime(tag);
-                    syncTimes.push_back(time);
-                    allSyncTimes.insert(time);
-                }
-            }
-            syncTimesPerInSpan.push_back(std::move(syncTimes));
+    [[nodiscard]] constexpr bool synchronize(const std::span<TInput>& ins) {
+        _syncData.clear();
+        const std::uint64_t syncTime = findSyncTime();
+        if (syncTime == std::numeric_limits<std::uint64_t>::max()) {
+            return false;
         }
 
-        // Find the earliest sync time present in all input spans within tolerance
-        auto findInAllIt = std::ranges::find_if(allSyncTimes, [&](const auto& curTime) { //
-            return std::ranges::all_of(syncTimesPerInSpan, [&](const auto& syncTimes) {  //
-                return std::ranges::any_of(syncTimes, [&](const auto& t) { return isTimeDifferenceWithinTolerance(curTime, t); });
-            });
-        });
-
-        return findInAllIt != allSyncTimes.end() ? *findInAllIt : std::numeric_limits<std::uint64_t>::max();
+        for (std::size_t i = 0UZ; i < ins.size(); i++) {
+            const auto& in   = ins[i];
+            const auto& tags = _syncTagIndex[i].tags;
+            const auto  sync = std::ranges::find_if(tags, [&](const SyncTag& tag) { return isTimeDifferenceWithinTolerance(tag.time, syncTime); });
+            assert(sync != tags.end() && sync->index < in.streamIndex + in.size()); // N.B. the index only holds tags within the current span
+
+            // available samples are bounded by earlier sync tags that cannot be synchronised and by the next sync tag
+            const std::size_t syncIndex = sync->index - in.streamIndex;
+            const std::size_t nPre      = sync != tags.begin() ? syncIndex - (tags.front().index - in.streamIndex) - 1UZ : syncIndex;
+            const auto        next      = std::ranges::find_if(std::next(sync), tags.end(), [&](const SyncTag& tag) { return tag.index > sync->index; });
+            const std::size_t nPost     = next != tags.end() ? next->index - sync->index - 1UZ : in.size() - syncIndex - 1UZ;
+            _syncData.push_back({syncIndex, nPre, nPost});
+        }
+        return true;
     }
 
-    [[nodiscard]] constexpr std::size_t getAvailablePreSamples(const InputSpanLike auto& in, std::size_t syncIndex) {
-        // Check if there’s an earlier sync tag that cannot be synchronized; if so, calculate available samples only up to that tag.
-        const auto foundTag = std::ranges::find_if(in.rawTags, [&](const auto& tag) { return getRelativeTagIndex(in, tag) < syncIndex && isSyncTag(tag); });
-        if (foundTag != in.rawTags.end()) {
-            return syncIndex - getRelativeTagIndex(in, *foundTag) - 1;
+    /**
+     * @brief merge-join of the per-port sorted trigger times: returns the earliest trigger time that is matched within
+     * `tolerance` on all ports, or `std::numeric_limits<std::uint64_t>::max()` if there is none.
+     */
+    [[nodiscard]] constexpr std::uint64_t findSyncTime() {
+        constexpr std::uint64_t kNoSync = std::numeric_limits<std::uint64_t>::max();
+        if (_syncTagIndex.empty() || std::ranges::any_of(_syncTagIndex, [](const SyncTagIndex& index) { return index.times.empty(); })) {
+            return kNoSync;
         }
-        return syncIndex;
-    }
 
-    [[nodiscard]] constexpr std::size_t getAvailablePostSamples(const InputSpanLike auto& in, std::size_t syncIndex) {
-        // Check if there’s a later sync tag; if so, calculate available samples only up to that tag.
-        auto foundTag = std::ranges::find_if(in.rawTags, [&](const auto& tag) {
-            const std::size_t relativeTagIndex = getRelativeTagIndex(in, tag);
-            return relativeTagIndex > syncIndex && relativeTagIndex < in.size() && isSyncTag(tag);
-        });
-        if (foundTag != in.rawTags.end()) {
-            return getRelativeTagIndex(in, *foundTag) - syncIndex - 1;
+        _allSyncTimes.clear();
+        for (const auto& index : _syncTagIndex) {
+            const auto mid = _allSyncTimes.insert(_allSyncTimes.end(), index.times.begin(), index.times.end());
+            std::ranges::inplace_merge(_allSyncTimes, mid);
         }
-        return in.size() - syncIndex - 1;
+        _cursors.assign(_syncTagIndex.size(), 0UZ);
+
+        auto candidate = _allSyncTimes.begin();
+        while (candidate != _allSyncTimes.end()) {
+            const std::uint64_t time     = *candidate;
+            bool                allMatch = true;
+            for (std::size_t i = 0UZ; i < _syncTagIndex.size(); i++) {
+                const auto&  times  = _syncTagIndex[i].times;
+                std::size_t& cursor = _cursors[i];
+                while (cursor < times.size() && times[cursor] < time && !isTimeDifferenceWithinTolerance(times[cursor], time)) {
+                    cursor++; // candidates are ascending -> times too far below the candidate can never match again
+                }
+                if (cursor == times.size()) {
+                    return kNoSync;
+                }
+                if (!isTimeDifferenceWithinTolerance(times[cursor], time)) {
+                    // skip all candidates that are still too far below this port's next trigger time
+                    const std::uint64_t minCandidate = times[cursor] >= tolerance ? times[cursor] - tolerance + 1ULL : 0ULL;
+                    candidate                        = std::lower_bound(std::next(candidate), _allSyncTimes.end(), minCandidate);
+                    allMatch                         = false;
+                    break;
+                }
+            }
+            if (allMatch) {
+                return time;
+            }
+        }
+        return kNoSync;
     }
 
-    [[nodiscard]] std::size_t getNSamplesBeforeSyncTag(const InputSpanLike auto& in) const {
-        for (const auto& tag : in.rawTags) {
-            const std::size_t relativeTagIndex = getRelativeTagIndex(in, tag);
-            if (isSyncTag(tag) && relativeTagIndex != std::numeric_limits<std::size_t>::max()) {
-                return std::min(relativeTagIndex, in.size()); // tags are ordered, return distance to the first sync tag
-            }
+    [[nodiscard]] std::size_t getNSamplesBeforeSyncTag(const InputSpanLike auto& in, const SyncTagIndex& index) const {
+        if (index.tags.empty()) {
+            return in.size();
         }
-        return in.size();
+        return std::min(index.tags.front().index - in.streamIndex, in.size()); // tags are ordered, return distance to the first sync tag
     }
 
     [[nodiscard]] constexpr bool isTimeDifferenceWithinTolerance(std::uint64_t t1, std::uint64_t t2) { return ((t1 > t2) ? t1 - t2 : t2 - t1) < tolerance; }
@@ -129,7 +129,15 @@ The information is stored (info only) in `trigger_name`, `trigger_time`, `trigge
             return gr::work::Status::OK;
         };
 
+        const std::span<const T> samples = inputSpan.first(nProcess);
         for (std::size_t i = 0; i < nProcess; ++i) {
+            const std::size_t nQuiet = _trigger.processQuiet(samples.subspan(i)); // bulk-skip samples that cannot cause an edge
+            _now += nQuiet * _period;
+            i += nQuiet;
+            if (i == nProcess) {
+                break;
+            }
+
             const T sample = inputSpan[i];
             _now += _period;
 
@@ -112,6 +112,27 @@ const boost::ut::suite<"basic Conversion tests"> basicConversion = [] {
             }
         } | TArithmeticTypes();
     } | std::tuple<ConvertBlock, ScalingConvertBlock>();
+
+    "floating-point <-> fixed-point"_test = []<typename TFixed>(TFixed /*noop*/) {
+        static_assert(HasRequiredProcessFunction<ScalingConvert<float, TFixed>> && HasProcessBulkFunction<ScalingConvert<float, TFixed>>);
+        static_assert(HasRequiredProcessFunction<ScalingConvert<TFixed, double>> && HasProcessBulkFunction<ScalingConvert<TFixed, double>>);
+
+        const std::vector<float> input{0.5f, -0.25f, 3.f, -3.f, 0.125f, 0.f, -0.75f, 1.5f, -0.5f, 0.25f, -0.125f, 0.0625f, 0.375f, -1.f, 0.875f, -0.875f, 0.1875f}; // N.B. odd length covers the non-SIMD remainder
+        ScalingConvert<float, TFixed> toFixed;
+        toFixed.scale = 0.5f;
+        std::vector<TFixed> fixed(input.size());
+        expect(toFixed.processBulk(input, fixed) == gr::work::Status::OK);
+        expect(fixed[2UZ] == TFixed::max()) << "saturates";
+        expect(fixed[3UZ] == TFixed::lowest()) << "saturates";
+
+        ScalingConvert<TFixed, double> toFloating;
+        toFloating.scale = 2.0;
+        std::vector<double> roundTrip(input.size());
+        expect(toFloating.processBulk(fixed, roundTrip) == gr::work::Status::OK);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            expect(eq(roundTrip[i], std::clamp(static_cast<double>(input[i]), -2.0, 2.0 * static_cast<double>(TFixed::max())))) << fmt::format("sample {}: {}", i, input[i]);
+        }
+    } | std::tuple<gr::Q15, gr::Q31>();
 };
 
 const boost::ut::suite<"complex To/From conversion tests"> complexConversion = [] {
@@ -206,37 +227,77 @@ const boost::ut::suite<"complex To/From conversion tests"> complexConversion = [
         };
 
         "complex <-> {real, imag}"_test = [] {
-            static_assert(HasConstProcessOneFunction<ToRealImag<std::complex<T>>>);
-            static_assert(HasConstProcessOneFunction<RealImagToComplex<T>>);
-            expect(HasConstProcessOneFunction<ToRealImag<std::complex<T>>>);
-            expect(HasConstProcessOneFunction<RealImagToComplex<T>>);
-
-            ToRealImag<std::complex<T>> complexConverter;
-            expect(eq(complexConverter.processOne(std::complex<T>{1, 0}), std::tuple<T, T>{1, 0}));
-            expect(eq(complexConverter.processOne(std::complex<T>{0, 1}), std::tuple<T, T>{0, 1}));
-            expect(eq(complexConverter.processOne(std::complex<T>{1, 1}), std::tuple<T, T>{1, 1}));
-
-            RealImagToComplex<T> realImagConverter;
-            expect(eq(realImagConverter.processOne(T(1), T(0)), std::complex<T>{1, 0}));
-            expect(eq(realImagConverter.processOne(T(0), T(1)), std::complex<T>{0, 1}));
-            expect(eq(realImagConverter.processOne(T(1), T(1)), std::complex<T>{1, 1}));
+            static_assert(HasNoexceptProcessBulkFunction<ToRealImag<std::complex<T>>>);
+            static_assert(HasNoexceptProcessBulkFunction<RealImagToComplex<T>>);
+            expect(HasNoexceptProcessBulkFunction<ToRealImag<std::complex<T>>>);
+            expect(HasNoexceptProcessBulkFunction<RealImagToComplex<T>>);
+
+            const std::vector<std::complex<T>> complexData{{1, 0}, {0, 1}, {1, 1}};
+            std::vector<T>                     realData(complexData.size());
+            std::vector<T>                     imagData(complexData.size());
+            ToRealImag<std::complex<T>>        complexConverter;
+            expect(complexConverter.processBulk(complexData, realData, imagData) == gr::work::Status::OK);
+            expect(eq(std::tuple<T, T>{realData[0], imagData[0]}, std::tuple<T, T>{1, 0}));
+            expect(eq(std::tuple<T, T>{realData[1], imagData[1]}, std::tuple<T, T>{0, 1}));
+            expect(eq(std::tuple<T, T>{realData[2], imagData[2]}, std::tuple<T, T>{1, 1}));
+
+            std::vector<std::complex<T>> outputData(complexData.size());
+            RealImagToComplex<T>         realImagConverter;
+            expect(realImagConverter.processBulk(realData, imagData, outputData) == gr::work::Status::OK);
+            expect(eq(outputData[0], std::complex<T>{1, 0}));
+            expect(eq(outputData[1], std::complex<T>{0, 1}));
+            expect(eq(outputData[2], std::complex<T>{1, 1}));
         };
 
         "complex <-> {magnitude, phase}"_test = [] {
-            static_assert(HasConstProcessOneFunction<ToMagPhase<std::complex<T>>>);
-            static_assert(HasConstProcessOneFunction<MagPhaseToComplex<T>>);
-            expect(HasConstProcessOneFunction<ToMagPhase<std::complex<T>>>);
-            expect(HasConstProcessOneFunction<MagPhaseToComplex<T>>);
-
-            ToMagPhase<std::complex<T>> magPhaseConverter;
-            expect(eq(magPhaseConverter.processOne(std::complex<T>{1, 0}), std::tuple<T, T>{1, 0}));
-            expect(eq(magPhaseConverter.processOne(std::complex<T>{0, 1}), std::tuple<T, T>{1, std::numbers::pi_v<T> / 2}));
-            expect(eq(magPhaseConverter.processOne(std::complex<T>{1, 1}), std::tuple<T, T>{std::sqrt(2), std::numbers::pi_v<T> / 4}));
-
-            MagPhaseToComplex<T> magPhaseToComplexConverter;
-            expect(unittest::abs_diff(magPhaseToComplexConverter.processOne(T(1), T(0)), std::complex<T>{1, 0}) < T(1e-3));
-            expect(unittest::abs_diff(magPhaseToComplexConverter.processOne(T(1), T(std::numbers::pi_v<T> / 2)), std::complex<T>{0, 1}) < T(1e-3));
-            expect(unittest::abs_diff(magPhaseToComplexConverter.processOne(T(std::sqrt(2)), T(std::numbers::pi_v<T> / 4)), std::complex<T>{1, 1}) < T(1e-3));
+            static_assert(HasNoexceptProcessBulkFunction<ToMagPhase<std::complex<T>>>);
+            static_assert(HasNoexceptProcessBulkFunction<MagPhaseToComplex<T>>);
+            expect(HasNoexceptProcessBulkFunction<ToMagPhase<std::complex<T>>>);
+            expect(HasNoexceptProcessBulkFunction<MagPhaseToComplex<T>>);
+
+            const std::vector<std::complex<T>> complexData{{1, 0}, {0, 1}, {1, 1}};
+            std::vector<T>                     magData(complexData.size());
+            std::vector<T>                     phaseData(complexData.size());
+            ToMagPhase<std::complex<T>>        magPhaseConverter;
+            expect(magPhaseConverter.processBulk(complexData, magData, phaseData) == gr::work::Status::OK);
+            expect(eq(std::tuple<T, T>{magData[0], phaseData[0]}, std::tuple<T, T>{1, 0}));
+            expect(eq(std::tuple<T, T>{magData[1], phaseData[1]}, std::tuple<T, T>{1, std::numbers::pi_v<T> / 2}));
+            expect(eq(std::tuple<T, T>{magData[2], phaseData[2]}, std::tuple<T, T>{std::sqrt(2), std::numbers::pi_v<T> / 4}));
+
+            std::vector<std::complex<T>> outputData(complexData.size());
+            MagPhaseToComplex<T>         magPhaseToComplexConverter;
+            expect(magPhaseToComplexConverter.processBulk(std::vector<T>{T(1), T(1), T(std::sqrt(2))}, std::vector<T>{T(0), T(std::numbers::pi_v<T> / 2), T(std::numbers::pi_v<T> / 4)}, outputData) == gr::work::Status::OK);
+            expect(unittest::abs_diff(outputData[0], std::complex<T>{1, 0}) < T(1e-3));
+            expect(unittest::abs_diff(outputData[1], std::complex<T>{0, 1}) < T(1e-3));
+            expect(unittest::abs_diff(outputData[2], std::complex<T>{1, 1}) < T(1e-3));
+        };
+
+        "vectorised vs. std:: reference"_test = [] {
+            constexpr T kTolerance = T(8) * std::numeric_limits<T>::epsilon();
+            for (const std::size_t nSamples : {1UZ, 7UZ, 16UZ, 1001UZ}) { // N.B. covers partial and full SIMD widths
+                std::vector<std::complex<T>> complexData(nSamples);
+                for (std::size_t i = 0UZ; i < nSamples; ++i) { // all four quadrants, axes and magnitudes from 1e-3 to 1e3
+                    const T angle  = T(0.1) * static_cast<T>(i) - T(50);
+                    complexData[i] = std::polar(std::pow(T(10), T(3) * std::sin(angle)), angle);
+                }
+                complexData[0UZ] = {T(0), T(0)};
+
+                std::vector<T> magData(nSamples);
+                std::vector<T> phaseData(nSamples);
+                expect(ToMagPhase<std::complex<T>>().processBulk(complexData, magData, phaseData) == gr::work::Status::OK);
+                std::vector<std::complex<T>> outputData(nSamples);
+                expect(MagPhaseToComplex<T>().processBulk(magData, phaseData, outputData) == gr::work::Status::OK);
+                for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                    const T magnitude = std::abs(complexData[i]);
+                    expect(le(std::abs(magData[i] - magnitude), kTolerance * magnitude)) << fmt::format("|z| mismatch at {}: {} vs {}", i, magData[i], magnitude);
+                    expect(le(std::abs(phaseData[i] - std::arg(complexData[i])), kTolerance)) << fmt::format("arg(z) mismatch at {}: {} vs {}", i, phaseData[i], std::arg(complexData[i]));
+                    expect(le(std::abs(outputData[i] - std::polar(magData[i], phaseData[i])), kTolerance * magnitude)) << fmt::format("polar mismatch at {}", i);
+                }
+
+                std::vector<T> phases(nSamples, T(1e9)); // beyond the vectorised argument reduction -> std::polar fallback
+                expect(MagPhaseToComplex<T>().processBulk(magData, phases, outputData) == gr::work::Status::OK);
+                expect(le(std::abs(outputData.back() - std::polar(magData.back(), T(1e9))), kTolerance * std::abs(complexData.back())));
+            }
         };
 
         "complex <-> interleaved"_test = []<typename R> {
@@ -266,6 +327,44 @@ const boost::ut::suite<"complex To/From conversion tests"> complexConversion = [
             expect(eq(outputComplexData[1], std::complex<T>{T(3.0f), T(4.0f)}));
             expect(eq(outputComplexData[2], std::complex<T>{T(5.0f), T(6.0f)}));
         } | std::tuple<float, double, std::int8_t, std::int16_t>();
+
+        "scaled int16 IQ <-> complex"_test = [] {
+            std::vector<std::int16_t> iqData(2UZ * 37UZ); // N.B. odd length covers the non-SIMD remainder
+            for (std::size_t i = 0UZ; i < iqData.size(); ++i) {
+                iqData[i] = static_cast<std::int16_t>(static_cast<int>(i * 1777UZ % 65536UZ) - 32768);
+            }
+
+            InterleavedToComplex<std::int16_t, std::complex<T>> interleavedToComplex;
+            interleavedToComplex.scale = T(1) / T(32768);
+            std::vector<std::complex<T>> complexData(iqData.size() / 2UZ);
+            expect(interleavedToComplex.processBulk(iqData, complexData) == gr::work::Status::OK);
+            for (std::size_t i = 0UZ; i < complexData.size(); ++i) {
+                expect(eq(complexData[i], std::complex<T>{T(iqData[2UZ * i]) / T(32768), T(iqData[2UZ * i + 1UZ]) / T(32768)})) << fmt::format("sample {}", i);
+            }
+
+            ComplexToInterleaved<std::complex<T>, std::int16_t> complexToInterleaved;
+            complexToInterleaved.scale = T(32768);
+            std::vector<std::int16_t> roundTrip(iqData.size());
+            expect(complexToInterleaved.processBulk(complexData, roundTrip) == gr::work::Status::OK);
+            expect(std::ranges::equal(roundTrip, iqData));
+        };
+
+        "complex -> interleaved integer saturation"_test = []<typename R> {
+            std::vector<std::complex<T>> complexData(17UZ); // N.B. odd length covers the non-SIMD remainder
+            for (std::size_t i = 0UZ; i < complexData.size(); ++i) {
+                complexData[i] = i % 3UZ == 0UZ ? std::complex<T>{T(2), T(-2)} : (i % 3UZ == 1UZ ? std::complex<T>{T(-1e30f), T(1e30f)} : std::complex<T>{std::numeric_limits<T>::quiet_NaN(), T(0.5)});
+            }
+            ComplexToInterleaved<std::complex<T>, R> complexToInterleaved;
+            complexToInterleaved.scale = T(std::numeric_limits<R>::max());
+            std::vector<R> interleavedData(2UZ * complexData.size());
+            expect(complexToInterleaved.processBulk(complexData, interleavedData) == gr::work::Status::OK);
+            for (std::size_t i = 0UZ; i < complexData.size(); ++i) {
+                const R re = i % 3UZ == 0UZ ? std::numeric_limits<R>::max() : (i % 3UZ == 1UZ ? std::numeric_limits<R>::lowest() : R(0));
+                const R im = i % 3UZ == 0UZ ? std::numeric_limits<R>::lowest() : (i % 3UZ == 1UZ ? std::numeric_limits<R>::max() : static_cast<R>(T(0.5) * T(std::numeric_limits<R>::max())));
+                expect(eq(interleavedData[2UZ * i], re)) << fmt::format("sample {} (re)", i);
+                expect(eq(interleavedData[2UZ * i + 1UZ], im)) << fmt::format("sample {} (im)", i);
+            }
+        } | std::tuple<std::int8_t, std::int16_t>();
     } | kArithmeticTypes;
 };
 
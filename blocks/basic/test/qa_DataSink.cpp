@@ -519,6 +519,38 @@ const boost::ut::suite DataSinkTests = [] {
         expect(eq(poller->drop_count.load(), 0UZ));
     };
 
+    "callback trigger mode with compiled matchers"_test = [] {
+        constexpr gr::Size_t kSamples = 200000;
+
+        gr::Graph  testGraph;
+        auto&      src  = testGraph.emplaceBlock<gr::testing::TagSource<int32_t>>({{"n_samples_max", kSamples}, {"mark_tag", false}});
+        const auto tags = std::vector<Tag>{{3000, {{tag::TRIGGER_NAME.shortKey(), "CMD_A"}}}, {8000, {{tag::TRIGGER_NAME.shortKey(), "CMD_B"}}}, {180000, {{tag::TRIGGER_NAME.shortKey(), "CMD_A"}}}};
+        src._tags       = tags;
+        auto& sink      = testGraph.emplaceBlock<DataSink<int32_t>>({{"name", "test_sink"}});
+
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(sink)));
+
+        constexpr std::size_t             kListenersPerFilter = 4UZ;
+        const std::vector<std::string>    filters{"CMD_A", "CMD_B", "CMD_C"};
+        std::vector<std::vector<int32_t>> receivedData(filters.size() * kListenersPerFilter);
+        for (std::size_t i = 0UZ; i < receivedData.size(); ++i) {
+            sink.registerTriggerCallback(trigger::BasicTriggerNameCtxMatcher::Compiled(filters[i % filters.size()]), 3, 2, [&received = receivedData[i]](DataSet<int32_t>&& dataset) { //
+                received.insert(received.end(), dataset.signal_values.begin(), dataset.signal_values.end());
+            });
+        }
+
+        Scheduler sched{std::move(testGraph)};
+        expect(sched.runAndWait().has_value());
+
+        for (std::size_t i = 0UZ; i < receivedData.size(); ++i) {
+            switch (i % filters.size()) {
+            case 0UZ: expect(eq(receivedData[i], std::vector<int32_t>{2997, 2998, 2999, 3000, 3001, 179997, 179998, 179999, 180000, 180001})); break;
+            case 1UZ: expect(eq(receivedData[i], std::vector<int32_t>{7997, 7998, 7999, 8000, 8001})); break;
+            default: expect(receivedData[i].empty()); break;
+            }
+        }
+    };
+
     "propagation of signal metadata per data set"_test = [] {
         constexpr gr::Size_t kSamples = 40000000;
 
@@ -880,6 +912,103 @@ const boost::ut::suite DataSinkTests = [] {
         expect(eq(samplesSeen + poller->drop_count, static_cast<std::size_t>(kSamples)));
     };
 
+    "zero-copy polling"_test = [](BlockingMode blockingMode) {
+        constexpr gr::Size_t kSamples = 200000;
+
+        gr::Graph  testGraph;
+        const auto tags = makeTestTags(0, 1000);
+        auto&      src  = testGraph.emplaceBlock<gr::testing::TagSource<float>>({{"n_samples_max", kSamples}, {"mark_tag", false}});
+        src._tags       = tags;
+        auto& delay     = testGraph.emplaceBlock<testing::Delay<float>>({{"delay_ms", kProcessingDelayMs}});
+        auto& sink      = testGraph.emplaceBlock<DataSink<float>>({{"name", "test_sink"}});
+
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(delay)));
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(delay).to<"in">(sink)));
+
+        auto polling = std::async([blockingMode] {
+            std::shared_ptr<ZeroCopyPoller<float>> poller;
+            expect(spinUntil(4s, [&poller, blockingMode] {
+                poller = DataSinkRegistry::instance().getZeroCopyPoller<float>(DataSinkQuery::sinkName("test_sink"), blockingMode);
+                return poller != nullptr;
+            })) << boost::ut::fatal;
+
+            std::vector<float> received;
+            std::vector<Tag>   receivedTags;
+            bool               seenFinished = false;
+            while (!seenFinished) {
+                if (blockingMode == BlockingMode::NonBlocking) {
+                    std::this_thread::sleep_for(20ms);
+                }
+                seenFinished = poller->finished;
+                while (poller->process([&received, &receivedTags](std::span<const float> data, std::span<const Tag> tags_) {
+                    auto absolute = tags_ | std::views::transform([&received](const auto& t) { return gr::Tag{t.index + received.size(), t.map}; });
+                    receivedTags.insert(receivedTags.end(), absolute.begin(), absolute.end());
+                    received.insert(received.end(), data.begin(), data.end());
+                })) {
+                }
+            }
+            return std::make_tuple(poller, received, receivedTags);
+        });
+
+        Scheduler sched{std::move(testGraph)};
+        expect(sched.runAndWait().has_value());
+
+        auto [poller, received, receivedTags] = polling.get();
+        std::erase_if(receivedTags, [](const Tag& tag) { return tag.map.contains(std::string(tag::END_OF_STREAM.shortKey())); });
+        if (blockingMode == BlockingMode::Blocking) {
+            expect(eq(poller->drop_count.load(), 0UZ));
+            expect(eq(received, getIota<float>(kSamples)));
+            expect(eq(receivedTags.size(), tags.size()));
+            expect(eq(indexesMatch(receivedTags, tags), true)) << fmt::format("{} != {}", formatList(receivedTags), formatList(tags));
+        } else {
+            expect(eq(received.size() + poller->drop_count, static_cast<std::size_t>(kSamples)));
+        }
+    } | std::vector{BlockingMode::Blocking, BlockingMode::NonBlocking};
+
+    "envelope polling"_test = [] {
+        constexpr gr::Size_t kSamples = 200000;
+
+        gr::Graph testGraph;
+        auto&     src  = testGraph.emplaceBlock<gr::testing::TagSource<float>>({{"n_samples_max", kSamples}, {"mark_tag", false}});
+        auto&     sink = testGraph.emplaceBlock<DataSink<float>>({{"name", "test_sink"}});
+
+        expect(eq(ConnectionResult::SUCCESS, testGraph.connect<"out">(src).to<"in">(sink)));
+
+        auto poller = sink.getEnvelopePoller(16UZ, 8UZ, 2048UZ);
+        expect(eq(poller->nLevels(), 8UZ));
+        expect(eq(poller->bucketSize(2UZ), 256UZ));
+
+        Scheduler sched{std::move(testGraph)};
+        expect(sched.runAndWait().has_value());
+
+        expect(poller->finished.load());
+        expect(eq(poller->samples_processed.load(), static_cast<std::size_t>(kSamples)));
+
+        auto checkEnvelopes = [](const std::vector<Envelope<float>>& envelopes, std::size_t bucketSize) { // source emits 0, 1, 2, ...
+            for (std::size_t i = 0UZ; i < envelopes.size(); ++i) {
+                const auto& envelope = envelopes[i];
+                expect(eq(envelope.count, bucketSize));
+                expect(i == 0UZ || envelope.index == envelopes[i - 1UZ].index + bucketSize) << "buckets are contiguous";
+                expect(eq(envelope.min, static_cast<float>(envelope.index)));
+                expect(eq(envelope.max, static_cast<float>(envelope.index + bucketSize - 1UZ)));
+                expect(approx(envelope.mean(), 0.5f * (envelope.min + envelope.max), 1e-4f * envelope.max + 1e-3f));
+            }
+        };
+
+        // full range: level 1 (64 samples/bucket) would yield enough points but does not reach back far enough -> level 2
+        const auto overview = poller->get(0UZ, kSamples, 2000UZ);
+        expect(eq(overview.size(), kSamples / 256UZ));
+        expect(eq(overview.front().index, 0UZ));
+        checkEnvelopes(overview, 256UZ);
+
+        // zoomed-in: finest level
+        const auto zoomed = poller->get(kSamples - 1000UZ, kSamples, 50UZ);
+        expect(eq(zoomed.size(), 63UZ));
+        expect(le(zoomed.front().index, kSamples - 1000UZ));
+        expect(eq(zoomed.back().index + zoomed.back().count, static_cast<std::size_t>(kSamples)));
+        checkEnvelopes(zoomed, 16UZ);
+    };
+
     "data set poller"_test = [] {
         gr::Graph testGraph;
         auto&     source          = testGraph.emplaceBlock<testing::TagSource<float, testing::ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", static_cast<gr::Size_t>(1024)}, {"signal_name", "test signal"}, {"signal_unit", "test unit"}, {"mark_tag", false}});
@@ -188,7 +188,7 @@ const boost::ut::suite<"StreamToDataSet test"> streamToDataSetTest = [] {
     using namespace gr::basic;
     using namespace gr::testing;
 
-    auto runTestDataSet = [](gr::Size_t nSamples, std::string filter, gr::Size_t preSamples, gr::Size_t postSamples, const std::vector<std::vector<float>>& expectedValues, const std::vector<std::size_t>& nTags, gr::Size_t maxSamples = 100000U) {
+    auto runTestDataSet = [](gr::Size_t nSamples, std::string filter, gr::Size_t preSamples, gr::Size_t postSamples, const std::vector<std::vector<float>>& expectedValues, const std::vector<std::size_t>& nTags, gr::Size_t maxSamples = 100000U, bool preAllocate = true) {
         using namespace gr;
         using namespace gr::basic;
         using namespace gr::testing;
@@ -211,7 +211,7 @@ const boost::ut::suite<"StreamToDataSet test"> streamToDataSetTest = [] {
             genTrigger(32, "CMD_DIAG_TRIGGER1", "CMD_DIAG_TRIGGER1")                  // it is also used as end trigger for "including" mode
         };
 
-        const property_map blockSettings         = {{"filter", filter}, {"n_pre", preSamples}, {"n_post", postSamples}, {"n_max", maxSamples}};
+        const property_map blockSettings         = {{"filter", filter}, {"n_pre", preSamples}, {"n_post", postSamples}, {"n_max", maxSamples}, {"pre_allocate", preAllocate}};
         auto&              filterStreamToDataSet = graph.emplaceBlock<StreamToDataSet<float>>(blockSettings);
         auto&              dataSetSink           = graph.emplaceBlock<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>>({{"name", "dataSetSink"}, {"log_tags", true}, {"log_samples", true}, {"verbose_console", false}});
         expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(tagSrc).template to<"in">(filterStreamToDataSet)));
@@ -290,6 +290,12 @@ const boost::ut::suite<"StreamToDataSet test"> streamToDataSetTest = [] {
                                   {20, 21, 22, 23, 24, 25, 26, 27, 28, 29, 30, 31, 32, 33},      //
                                   {25, 26, 27, 28, 29, 30, 31, 32, 33, 34, 35, 36, 37, 38}};
     "single trigger (+pre/post, n_max)"_test = [&runTestDataSet, &expectedValues, &nMaxSamples] { runTestDataSet(50U, "CMD_DIAG_TRIGGER1", 7, 7, expectedValues, {3UZ, 2UZ, 3UZ, 1UZ}, nMaxSamples); };
+
+    // same results without pre-allocation and DataSet recycling
+    "single trigger (+pre/post, n_max, no pre-allocation)"_test = [&runTestDataSet, &expectedValues, &nMaxSamples] { runTestDataSet(50U, "CMD_DIAG_TRIGGER1", 7, 7, expectedValues, {3UZ, 2UZ, 3UZ, 1UZ}, nMaxSamples, false); };
+
+    expectedValues                                    = {{5, 6, 7, 8, 9}, {15, 16, 17, 18, 19, 20, 21, 22, 23, 24}, {20, 21, 22, 23, 24, 25, 26, 27, 28, 29}};
+    "start->stop (excluding, no pre-allocation)"_test = [&runTestDataSet, &expectedValues] { runTestDataSet(50U, "[CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=1, CMD_BP_START/FAIR.SELECTOR.C=1:S=1:P=2]", 0, 0, expectedValues, {3UZ, 3UZ, 4UZ}, 100000U, false); };
 };
 
 int main() { /* not needed for UT */ }
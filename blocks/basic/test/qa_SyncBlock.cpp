@@ -6,6 +6,9 @@
 
 #include <fmt/format.h>
 
+#include <array>
+#include <numeric>
+
 struct TestParams {
     std::string   testName       = "";
     gr::Size_t    nSamples       = 0U;                                        // 0 -> take inValues[i].size()
@@ -200,6 +203,60 @@ const boost::ut::suite SyncBlockTests = [] {
             .expectedTags     = {{genDropTag(0, 68000), genSyncTag(32'000, 100)}, {genDropTag(0, 69000), genSyncTag(32'000, 100)}}, //
             .expectedNSamples = 231'000});
     };
+
+    "SyncBlock many ports dense tags test"_test = [] {
+        constexpr std::size_t nPorts   = 32UZ;
+        constexpr gr::Size_t  nSamples = 100'000U;
+        TestParams            par{.nSamples = nSamples, .tolerance = 2ULL, .expectedNSamples = nSamples};
+        for (std::size_t i = 0UZ; i < nPorts; i++) {
+            std::vector<gr::Tag> tags;
+            for (std::size_t index = 0UZ; index < nSamples; index += 1000UZ) {
+                tags.push_back(genSyncTag(index, 100ULL * index + (i % 2UZ))); // trigger time jitter within tolerance
+            }
+            par.inValues.emplace_back();
+            par.inTags.push_back(tags);
+            par.expectedTags.push_back(std::move(tags)); // already aligned -> no dropped samples
+        }
+        runTest(par);
+    };
+
+    "SyncBlock sync tag beyond a shrunk span"_test = [] {
+        SyncBlock<int> block({{"n_ports", gr::Size_t(2U)}, {"tolerance", 2ULL}});
+        block.init(block.progress, block.ioThreadPool);
+        expect(eq(block.inputs.size(), 2UZ));
+
+        const std::vector<std::vector<gr::Tag>> tags{{genSyncTag(10, 100), genSyncTag(80, 200)}, {genSyncTag(20, 200)}};
+        for (std::size_t i = 0UZ; i < 2UZ; i++) {
+            auto writer    = block.inputs[i].buffer().streamBuffer.new_writer();
+            auto tagWriter = block.inputs[i].buffer().tagBuffer.new_writer();
+            auto writeSpan = writer.tryReserve<SpanReleasePolicy::ProcessAll>(100UZ);
+            auto tagSpan   = tagWriter.tryReserve(tags[i].size());
+            std::iota(writeSpan.begin(), writeSpan.end(), 0);
+            std::ranges::copy(tags[i], tagSpan.begin());
+            tagSpan.publish(tags[i].size());
+            writeSpan.publish(100UZ);
+        }
+
+        { // all samples available -> trigger time 200 is matched on both ports
+            std::array ins{block.inputs[0].get<SpanReleasePolicy::ProcessNone>(100UZ), block.inputs[1].get<SpanReleasePolicy::ProcessNone>(100UZ)};
+            block.updateSyncTagIndex(std::span(ins));
+            expect(block.synchronize(std::span(ins)));
+            expect(eq(block._syncData[0].index, 80UZ));
+        }
+        { // port 0 provides fewer samples -> its trigger at index 80 is no longer visible and must not be selected
+            std::array ins{block.inputs[0].get<SpanReleasePolicy::ProcessNone>(50UZ), block.inputs[1].get<SpanReleasePolicy::ProcessNone>(100UZ)};
+            block.updateSyncTagIndex(std::span(ins));
+            expect(eq(block._syncTagIndex[0].tags.size(), 1UZ));
+            expect(!block.synchronize(std::span(ins)));
+        }
+        { // ... and is re-indexed once available again
+            std::array ins{block.inputs[0].get<SpanReleasePolicy::ProcessNone>(100UZ), block.inputs[1].get<SpanReleasePolicy::ProcessNone>(100UZ)};
+            block.updateSyncTagIndex(std::span(ins));
+            expect(block.synchronize(std::span(ins)));
+            expect(eq(block._syncData[0].index, 80UZ));
+            expect(eq(block._syncData[1].index, 20UZ));
+        }
+    };
 };
 
 int main() {}
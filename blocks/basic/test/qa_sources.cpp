@@ -83,8 +83,11 @@ const boost::ut::suite TagTests = [] {
             // expected values corresponds to sample_rate = 1024., frequency = 128., amplitude = 1., offset = 0., phase = pi/4.
             std::map<std::string, std ::vector<double>> expResults = {{"Const", {1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1., 1.}}, {"Sin", {0.707106, 1., 0.707106, 0., -0.707106, -1., -0.707106, 0., 0.707106, 1., 0.707106, 0., -0.707106, -1., -0.707106, 0.}}, {"Cos", {0.707106, 0., -0.707106, -1., -0.7071067, 0., 0.707106, 1., 0.707106, 0., -0.707106, -1., -0.707106, 0., 0.707106, 1.}}, {"Square", {1., 1., 1., -1., -1., -1., -1., 1., 1., 1., 1., -1., -1., -1., -1., 1.}}, {"Saw", {0.25, 0.5, 0.75, -1., -0.75, -0.5, -0.25, 0., 0.25, 0.5, 0.75, -1., -0.75, -0.5, -0.25, 0.}}, {"Triangle", {0.5, 1., 0.5, 0., -0.5, -1., -0.5, 0., 0.5, 1., 0.5, 0., -0.5, -1., -0.5, 0.}}};
 
+            const std::vector<std::uint8_t> input(N);
+            std::vector<double>             values(N);
+            expect(signalGen.processBulk(input, values) == work::Status::OK);
             for (std::size_t i = 0; i < N; i++) {
-                const auto val = signalGen.processOne(0);
+                const auto val = values[i];
                 const auto exp = expResults[sig][i] + offset;
                 expect(approx(exp, val, 1e-5)) << fmt::format("SignalGenerator for signal: {} and i: {} does not match.", sig, i);
             }
@@ -100,7 +103,7 @@ const boost::ut::suite TagTests = [] {
 
             std::vector<double> xValues(N), yValues(N);
             std::iota(xValues.begin(), xValues.end(), 0);
-            std::ranges::generate(yValues, [&signalGen]() { return signalGen.processOne(0); });
+            expect(signalGen.processBulk(std::vector<std::uint8_t>(N), yValues) == work::Status::OK);
 
             fmt::println("Chart {}\n\n", sig);
             auto chart = gr::graphs::ImChart<128, 16>({{0., static_cast<double>(N)}, {-2.6, 2.6}});
@@ -17,12 +17,16 @@ namespace gr::electrical {
 
 template<typename T, std::size_t nPhases>
 requires(std::floating_point<T> or std::is_arithmetic_v<meta::fundamental_base_value_type_t<T>>)
-struct PowerMetrics : Block<PowerMetrics<T, nPhases>> {
+struct PowerMetrics : Block<PowerMetrics<T, nPhases>, Resampling<1UZ, 1UZ, false>> {
     using Description = Doc<R""(@brief PowerMetrics
 
 Computes per-phase active power (P), reactive power (Q), apparent power (S), RMS voltage (U_rms), and RMS current (I_rms)
 for single-phase or multi-phase electrical systems. It processes voltage and current inputs,
-applies low-pass filters to calculate average values, and outputs decimated results at a specified rate.
+applies low-pass filters to calculate average values, and outputs decimated results at a specified rate,
+i.e. one output sample at the end of every 'decim' input samples.
+
+For floating-point samples, the P, U² and I² averages of all phases share the same low-pass and are evaluated as one
+SIMD recurrence with 3 x nPhases lanes. UncertainValue<T> samples are filtered per phase and quantity (error propagation).
 
 [0] "IEEE Standard Definitions for the Measurement of Electric Power Quantities Under Sinusoidal, Nonsinusoidal,
     Balanced, or Unbalanced Conditions," in IEEE Std 1459-2010 (Revision of IEEE Std 1459-2000), vol., no., pp.1-50,
@@ -45,59 +49,101 @@ applies low-pass filters to calculate average values, and outputs decimated resu
     GR_MAKE_REFLECTABLE(PowerMetrics, U, I, P, Q, S, U_rms, I_rms, sample_rate, decim);
 
     // private state for exponential moving average (EMA)
-    using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<meta::fundamental_base_value_type_t<T>>>;
+    using ValueType  = meta::fundamental_base_value_type_t<T>;
+    using FilterImpl = std::conditional_t<UncertainValueLike<T>, filter::ErrorPropagatingFilter<T>, filter::Filter<ValueType>>;
+    using EmaLanes   = vir::stdx::fixed_size_simd<ValueType, 3UZ * nPhases>; // lanes: [P_0 … P_{n-1}, U²_0 … U²_{n-1}, I²_0 … I²_{n-1}]
 
-    std::array<FilterImpl, nPhases> _lpVoltageSquared;
+    std::array<FilterImpl, nPhases> _lpVoltageSquared; // N.B. UncertainValue<T> only
     std::array<FilterImpl, nPhases> _lpCurrentSquared;
     std::array<FilterImpl, nPhases> _lpActivePower;
+    filter::Filter<EmaLanes>        _lpBatched; // N.B. floating-point T only
+    std::size_t                     _decimationCounter = 0UZ;
 
     void initFilters() {
         using namespace gr::filter;
-        using ValueType = meta::fundamental_base_value_type_t<T>;
 
         const double cutoff_frequency = 0.5 * static_cast<double>(sample_rate) / static_cast<double>(decim);
-        const auto   filter_init      = [&, cutoff_frequency](auto) {                                                    //
-            return FilterImpl(iir::designFilter<ValueType>(Type::LOWPASS,                                         //
-                       FilterParameters{.order = 2UZ, .fLow = cutoff_frequency, .fs = static_cast<double>(sample_rate)}, //
-                       iir::Design::BUTTERWORTH));
+        const auto   design           = [&, cutoff_frequency] {
+            return iir::designFilter<ValueType>(Type::LOWPASS, FilterParameters{.order = 2UZ, .fLow = cutoff_frequency, .fs = static_cast<double>(sample_rate)}, iir::Design::BUTTERWORTH);
         };
 
-        constexpr auto indices = std::views::iota(0UZ, nPhases);
-        std::ranges::transform(indices, _lpVoltageSquared.begin(), filter_init);
-        std::ranges::transform(indices, _lpCurrentSquared.begin(), filter_init);
-        std::ranges::transform(indices, _lpActivePower.begin(), filter_init);
+        if constexpr (std::floating_point<T>) {
+            _lpBatched = filter::Filter<EmaLanes>(design());
+        } else {
+            const auto     filter_init = [&design](auto) { return FilterImpl(design()); };
+            constexpr auto indices     = std::views::iota(0UZ, nPhases);
+            std::ranges::transform(indices, _lpVoltageSquared.begin(), filter_init);
+            std::ranges::transform(indices, _lpCurrentSquared.begin(), filter_init);
+            std::ranges::transform(indices, _lpActivePower.begin(), filter_init);
+        }
+        _decimationCounter = 0UZ;
     }
 
-    void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) { initFilters(); }
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) {
+        this->input_chunk_size = decim;
+        initFilters();
+    }
+
+    void writeOutputs(std::size_t phaseIdx, std::size_t outIdx, T ema_p, T ema_u2, T ema_i2, auto& activePower, auto& reactivePower, auto& apparentPower, auto& rmsVoltage, auto& rmsCurrent) const noexcept {
+        const T u_rms = math::sqrt(ema_u2);
+        const T i_rms = math::sqrt(ema_i2);
+
+        const T S_i = u_rms * i_rms;                                         // apparent power
+        T       Q_i = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
+
+        activePower[phaseIdx][outIdx]   = ema_p;
+        reactivePower[phaseIdx][outIdx] = Q_i;
+        apparentPower[phaseIdx][outIdx] = S_i;
+
+        rmsVoltage[phaseIdx][outIdx] = u_rms;
+        rmsCurrent[phaseIdx][outIdx] = i_rms;
+    }
 
     template<typename TInputSpanType, typename TOutputSpanType>
     constexpr work::Status processBulk(std::span<TInputSpanType>& voltage, std::span<TInputSpanType>& current,                         // inputs
         std::span<TOutputSpanType>& activePower, std::span<TOutputSpanType>& reactivePower, std::span<TOutputSpanType>& apparentPower, // power outputs
         std::span<TOutputSpanType>& rmsVoltage, std::span<TOutputSpanType>& rmsCurrent) {
-        for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) { // process each phase
-            for (std::size_t i = 0UZ; i < voltage[phaseIdx].size(); ++i) { // iterate over samples
-                const T u_i = voltage[phaseIdx][i];
-                const T i_i = current[phaseIdx][i];
-
-                const T p_i    = u_i * i_i;                                         // instantaneous power
-                const T ema_p  = _lpActivePower[phaseIdx].processOne(p_i);          // update exponential moving average for power
-                const T ema_u2 = _lpVoltageSquared[phaseIdx].processOne(u_i * u_i); // update exponential moving average for voltage squared
-                const T ema_i2 = _lpCurrentSquared[phaseIdx].processOne(i_i * i_i); // update exponential moving average for current squared
-
-                if (i % static_cast<std::size_t>(decim) == 0UZ) {
-                    const std::size_t outIdx = i / static_cast<std::size_t>(decim);
-                    const T           u_rms  = math::sqrt(ema_u2);
-                    const T           i_rms  = math::sqrt(ema_i2);
-
-                    const T S_i = u_rms * i_rms;                                         // apparent power
-                    T       Q_i = math::sqrt(std::max(S_i * S_i - ema_p * ema_p, T(0))); // reactive power
-
-                    activePower[phaseIdx][outIdx]   = ema_p;
-                    reactivePower[phaseIdx][outIdx] = Q_i;
-                    apparentPower[phaseIdx][outIdx] = S_i;
-
-                    rmsVoltage[phaseIdx][outIdx] = u_rms;
-                    rmsCurrent[phaseIdx][outIdx] = i_rms;
+        const std::size_t nSamples = voltage[0UZ].size();
+        const std::size_t decimate = std::max<std::size_t>(1UZ, static_cast<std::size_t>(decim));
+        const std::size_t offset   = _decimationCounter + 1UZ; // N.B. carries partial decimation windows across calls
+        _decimationCounter         = (_decimationCounter + nSamples) % decimate;
+
+        if constexpr (std::floating_point<T>) { // all phases and quantities in one batched recurrence
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                const EmaLanes ema = _lpBatched.processOne(EmaLanes([&voltage, &current, i](auto lane) {
+                    constexpr std::size_t kLane = lane;
+                    const T               u_i   = voltage[kLane % nPhases][i];
+                    const T               i_i   = current[kLane % nPhases][i];
+                    if constexpr (kLane < nPhases) {
+                        return u_i * i_i; // instantaneous power
+                    } else if constexpr (kLane < 2UZ * nPhases) {
+                        return u_i * u_i; // voltage squared
+                    } else {
+                        return i_i * i_i; // current squared
+                    }
+                }));
+
+                if ((offset + i) % decimate == 0UZ) {
+                    const std::size_t outIdx = (offset + i) / decimate - 1UZ;
+                    for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) {
+                        writeOutputs(phaseIdx, outIdx, ema[phaseIdx], ema[nPhases + phaseIdx], ema[2UZ * nPhases + phaseIdx], activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent);
+                    }
+                }
+            }
+        } else {
+            for (std::size_t phaseIdx = 0UZ; phaseIdx < nPhases; ++phaseIdx) { // process each phase
+                for (std::size_t i = 0UZ; i < nSamples; ++i) {                 // iterate over samples
+                    const T u_i = voltage[phaseIdx][i];
+                    const T i_i = current[phaseIdx][i];
+
+                    const T p_i    = u_i * i_i;                                         // instantaneous power
+                    const T ema_p  = _lpActivePower[phaseIdx].processOne(p_i);          // update exponential moving average for power
+                    const T ema_u2 = _lpVoltageSquared[phaseIdx].processOne(u_i * u_i); // update exponential moving average for voltage squared
+                    const T ema_i2 = _lpCurrentSquared[phaseIdx].processOne(i_i * i_i); // update exponential moving average for current squared
+
+                    if ((offset + i) % decimate == 0UZ) {
+                        writeOutputs(phaseIdx, (offset + i) / decimate - 1UZ, ema_p, ema_u2, ema_i2, activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent);
+                    }
                 }
             }
         }
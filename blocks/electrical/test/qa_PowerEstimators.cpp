@@ -169,6 +169,77 @@ const boost::ut::suite<"Power Metrics Estimators"> powerEstimatorTests = [] {
             std::pair<gr::UncertainValue<float>, std::integral_constant<std::size_t, 3>>{}  //
         };
 
+    "PowerMetrics decimation across processBulk calls"_test = [] {
+        using T                        = float;
+        constexpr std::size_t kNPhases = 3UZ;
+        constexpr std::size_t kDecim   = 200UZ;
+        constexpr std::size_t kNIn     = 10'000UZ;
+        constexpr std::size_t kNOut    = kNIn / kDecim;
+
+        std::vector<std::vector<T>> voltageIn(kNPhases, std::vector<T>(kNIn));
+        std::vector<std::vector<T>> currentIn(kNPhases, std::vector<T>(kNIn));
+        for (std::size_t phase = 0UZ; phase < kNPhases; ++phase) {
+            for (std::size_t n = 0UZ; n < kNIn; ++n) {
+                const float t       = static_cast<float>(n) / sample_rate;
+                voltageIn[phase][n] = V_peak * std::sin(2.0f * std::numbers::pi_v<float> * freq * t + phaseShift[phase]);
+                currentIn[phase][n] = I_peak * std::sin(2.0f * std::numbers::pi_v<float> * freq * t + phaseShift[phase] + phaseOffset[phase]);
+            }
+        }
+
+        // processes the input in chunks that are not aligned to the decimation factor and returns all P, Q, S, U_rms, I_rms outputs
+        const auto process = [&](std::span<const std::size_t> chunkSizes) {
+            PowerMetrics<T, kNPhases> block;
+            block.decim = static_cast<gr::Size_t>(kDecim);
+            block.initFilters();
+
+            std::array<std::vector<std::vector<T>>, 5UZ> outputs;
+            outputs.fill(std::vector<std::vector<T>>(kNPhases, std::vector<T>(kNOut)));
+            std::size_t inPos  = 0UZ;
+            std::size_t outPos = 0UZ;
+            for (const std::size_t chunk : chunkSizes) {
+                const std::size_t nOut = (inPos + chunk) / kDecim - inPos / kDecim;
+
+                std::vector<std::span<const T>>            voltageSpans;
+                std::vector<std::span<const T>>            currentSpans;
+                std::array<std::vector<std::span<T>>, 5UZ> outputSpans;
+                for (std::size_t phase = 0UZ; phase < kNPhases; ++phase) {
+                    voltageSpans.emplace_back(voltageIn[phase].data() + inPos, chunk);
+                    currentSpans.emplace_back(currentIn[phase].data() + inPos, chunk);
+                    for (std::size_t k = 0UZ; k < outputs.size(); ++k) {
+                        outputSpans[k].emplace_back(outputs[k][phase].data() + outPos, nOut);
+                    }
+                }
+
+                std::span<std::span<const T>> spanInVoltage(voltageSpans);
+                std::span<std::span<const T>> spanInCurrent(currentSpans);
+                std::span<std::span<T>>       activePower(outputSpans[0]);
+                std::span<std::span<T>>       reactivePower(outputSpans[1]);
+                std::span<std::span<T>>       apparentPower(outputSpans[2]);
+                std::span<std::span<T>>       rmsVoltage(outputSpans[3]);
+                std::span<std::span<T>>       rmsCurrent(outputSpans[4]);
+                expect(block.processBulk(spanInVoltage, spanInCurrent, activePower, reactivePower, apparentPower, rmsVoltage, rmsCurrent) == gr::work::Status::OK);
+                inPos += chunk;
+                outPos += nOut;
+            }
+            expect(eq(outPos, kNOut));
+            return outputs;
+        };
+
+        const std::array<std::size_t, 1UZ> singleChunk{kNIn};
+        const std::array<std::size_t, 4UZ> oddChunks{1234UZ, 999UZ, 1UZ, kNIn - 1234UZ - 999UZ - 1UZ};
+        const auto                         reference = process(singleChunk);
+        const auto                         chunked   = process(oddChunks);
+        for (std::size_t k = 0UZ; k < reference.size(); ++k) {
+            for (std::size_t phase = 0UZ; phase < kNPhases; ++phase) {
+                expect(std::ranges::equal(reference[k][phase], chunked[k][phase])) << fmt::format("output {} phase {} depends on chunking", k, phase);
+            }
+        }
+
+        const float expectedActivePower = V_rms * I_rms * std::cos(phaseOffset[0]);
+        expect(approx(reference[0][0].back(), expectedActivePower, 0.1f * V_rms * I_rms)) << "active power mismatch"; // 10% of S: residual 100 Hz ripple
+        expect(approx(reference[3][0].back(), V_rms, 0.05f * V_rms)) << "RMS voltage mismatch";
+    };
+
     "PowerFactor"_test = []<typename TestParam>() {
         using T                        = typename TestParam::first_type;
         constexpr std::size_t kNPhases = TestParam::second_type::value;
@@ -0,0 +1,343 @@
+#ifndef ASYNCFILEWRITER_HPP
+#define ASYNCFILEWRITER_HPP
+
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/thread/thread_pool.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <atomic>
+#include <cerrno>
+#include <condition_variable>
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <memory>
+#include <mutex>
+#include <span>
+#include <string>
+#include <string_view>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#if defined(GR_FILEIO_HAS_LIBURING) && __has_include(<liburing.h>)
+#include <liburing.h>
+#define GR_FILEIO_USE_IO_URING 1
+#else
+#define GR_FILEIO_USE_IO_URING 0
+#endif
+
+namespace gr::blocks::fileio::detail {
+
+/**
+ * @brief Asynchronous binary file writer decoupling the caller (i.e. the scheduler thread) from disk latencies.
+ *
+ * Data is copied into `queueDepth` page-aligned staging buffers of `bufferSize` bytes each (i.e. at least double-buffered).
+ * Full buffers are written in the background while the next one is being filled:
+ *  - via io_uring if gnuradio has been built with liburing (GR_FILEIO_HAS_LIBURING), or
+ *  - via `pwrite` on the provided (IO) thread pool otherwise (or synchronously if no pool is given).
+ *
+ * `write(..)` never blocks on the disk: it returns the number of bytes it could accept, so that callers can leave
+ * the remaining samples in their input buffer (i.e. propagate the back-pressure upstream).
+ * Optionally, the file is opened with `O_DIRECT` (if supported by the platform and file-system) to by-pass the page cache.
+ */
+class AsyncFileWriter {
+    static constexpr std::size_t kAlignment = 4096UZ; // page and typical O_DIRECT logical block size
+
+    struct AlignedFree {
+        void operator()(std::byte* ptr) const noexcept { std::free(ptr); }
+    };
+
+    struct StagingBuffer {
+        std::unique_ptr<std::byte, AlignedFree> data;
+        std::size_t                             size{0UZ};       // number of valid bytes
+        std::size_t                             writeSize{0UZ};  // number of bytes submitted (may contain O_DIRECT padding)
+        std::size_t                             written{0UZ};    // number of bytes written so far (io_uring may complete short writes)
+        off_t                                   fileOffset{0};   // file offset of the first byte
+        std::atomic<bool>                       inFlight{false}; // owned by the background writer
+    };
+
+    std::size_t                                       _bufferSize;
+    std::size_t                                       _queueDepth;
+    bool                                              _directIo;
+    std::shared_ptr<gr::thread_pool::BasicThreadPool> _threadPool;
+    std::unique_ptr<StagingBuffer[]>                  _buffers;
+    StagingBuffer*                                    _active = nullptr; // buffer currently being filled by the caller
+    int                                               _fd     = -1;
+    bool                                              _fdDirect{false};
+    off_t                                             _fileOffset{0};    // file offset of the next buffer to be submitted
+    std::string                                       _fileName;
+    std::atomic<std::size_t>                          _nInFlight{0UZ};
+    std::mutex                                        _completionMutex;  // N.B. the last completion must not touch the writer after the waiter may return
+    std::condition_variable                           _completion;
+    std::atomic<int>                                  _error{0};         // first 'errno' reported by the background writes
+#if GR_FILEIO_USE_IO_URING
+    io_uring _ring{};
+    bool     _ringInitialised{false};
+#endif
+
+public:
+    AsyncFileWriter(std::size_t bufferSize, std::size_t queueDepth, bool directIo, std::shared_ptr<gr::thread_pool::BasicThreadPool> threadPool = nullptr) //
+        : _bufferSize(std::max(kAlignment, (bufferSize + kAlignment - 1UZ) / kAlignment * kAlignment)), _queueDepth(std::max(2UZ, queueDepth)), _directIo(directIo), _threadPool(std::move(threadPool)), _buffers(std::make_unique<StagingBuffer[]>(_queueDepth)) {
+        for (std::size_t i = 0UZ; i < _queueDepth; i++) {
+            _buffers[i].data.reset(static_cast<std::byte*>(std::aligned_alloc(kAlignment, _bufferSize)));
+            if (!_buffers[i].data) {
+                throw gr::exception(fmt::format("failed to allocate {} aligned staging buffers of {} bytes", _queueDepth, _bufferSize));
+            }
+        }
+#if GR_FILEIO_USE_IO_URING
+        _ringInitialised = io_uring_queue_init(static_cast<unsigned>(_queueDepth), &_ring, 0) == 0; // falls back to 'pwrite' if not permitted (e.g. seccomp)
+#endif
+    }
+
+    AsyncFileWriter(const AsyncFileWriter&)            = delete;
+    AsyncFileWriter& operator=(const AsyncFileWriter&) = delete;
+
+    ~AsyncFileWriter() {
+        try {
+            close();
+        } catch (...) { // NOSONAR -- destructor must not throw
+        }
+#if GR_FILEIO_USE_IO_URING
+        if (_ringInitialised) {
+            io_uring_queue_exit(&_ring);
+        }
+#endif
+    }
+
+    [[nodiscard]] std::string_view backend() const noexcept {
+#if GR_FILEIO_USE_IO_URING
+        if (_ringInitialised) {
+            return "io_uring";
+        }
+#endif
+        return _threadPool ? "thread-pool+pwrite" : "pwrite";
+    }
+
+    [[nodiscard]] bool        isOpen() const noexcept { return _fd >= 0; }
+    [[nodiscard]] bool        isDirect() const noexcept { return _fdDirect; }
+    [[nodiscard]] std::size_t bufferSize() const noexcept { return _bufferSize; }
+    [[nodiscard]] std::size_t queueDepth() const noexcept { return _queueDepth; }
+    [[nodiscard]] std::size_t nInFlight() const noexcept { return _nInFlight.load(std::memory_order_acquire); }
+
+    void open(const std::string& fileName, bool append) {
+        close();
+        _fileName      = fileName;
+        const int mode = O_WRONLY | O_CREAT | (append ? 0 : O_TRUNC) | O_CLOEXEC;
+        _fdDirect      = false;
+#ifdef O_DIRECT
+        if (_directIo) {
+            _fd       = ::open(fileName.c_str(), mode | O_DIRECT, 0644);
+            _fdDirect = _fd >= 0; // not all file-systems (e.g. tmpfs) support O_DIRECT -> fall back to buffered I/O
+        }
+#endif
+        if (_fd < 0) {
+            _fd = ::open(fileName.c_str(), mode, 0644);
+        }
+        if (_fd < 0) {
+            throw gr::exception(fmt::format("failed to open file '{}': {}", fileName, std::strerror(errno)));
+        }
+
+        struct stat fileStat{};
+        _fileOffset = append && ::fstat(_fd, &fileStat) == 0 ? fileStat.st_size : 0;
+        if (_fdDirect && (static_cast<std::size_t>(_fileOffset) % kAlignment) != 0UZ) { // O_DIRECT requires aligned file offsets
+            ::close(_fd);
+            _fd       = ::open(fileName.c_str(), mode, 0644);
+            _fdDirect = false;
+            if (_fd < 0) {
+                throw gr::exception(fmt::format("failed to open file '{}': {}", fileName, std::strerror(errno)));
+            }
+        }
+    }
+
+    /**
+     * @brief flushes the partially filled staging buffer, waits for all outstanding writes and closes the file.
+     */
+    void close() {
+        if (_fd < 0) {
+            return;
+        }
+        off_t fileSize = _fileOffset;
+        if (_active != nullptr && _active->size > 0UZ) {
+            fileSize += static_cast<off_t>(_active->size);
+            submit(*std::exchange(_active, nullptr));
+        }
+        _active = nullptr;
+        waitForAll();
+        if (_fdDirect && ::ftruncate(_fd, fileSize) != 0) { // remove O_DIRECT block padding
+            _error.store(errno, std::memory_order_release);
+        }
+        ::close(_fd);
+        _fd = -1;
+        throwOnError();
+    }
+
+    /**
+     * @brief number of bytes that can be accepted without blocking
+     */
+    [[nodiscard]] std::size_t capacity() noexcept {
+        reapCompletions();
+        std::size_t nBytes = _active != nullptr ? _bufferSize - _active->size : 0UZ;
+        for (std::size_t i = 0UZ; i < _queueDepth; i++) {
+            if (&_buffers[i] != _active && !_buffers[i].inFlight.load(std::memory_order_acquire)) {
+                nBytes += _bufferSize;
+            }
+        }
+        return nBytes;
+    }
+
+    /**
+     * @brief copies data into the staging buffers, submitting each buffer as soon as it is full.
+     * @param granularity number of bytes accepted is a multiple of this (e.g. sizeof(T) to not split samples)
+     * @return number of bytes accepted (may be less than data.size() if all staging buffers are in flight)
+     */
+    [[nodiscard]] std::size_t write(std::span<const std::byte> data, std::size_t granularity = 1UZ) {
+        if (_fd < 0) {
+            throw gr::exception("AsyncFileWriter: no open file");
+        }
+        throwOnError();
+
+        const std::size_t nBytes = std::min(data.size(), capacity()) / granularity * granularity;
+        std::size_t       offset = 0UZ;
+        while (offset < nBytes) {
+            if (_active == nullptr) {
+                _active = acquireFreeBuffer(); // guaranteed to succeed by the capacity() check above
+            }
+            const std::size_t nCopy = std::min(nBytes - offset, _bufferSize - _active->size);
+            std::memcpy(_active->data.get() + _active->size, data.data() + offset, nCopy);
+            _active->size += nCopy;
+            offset += nCopy;
+
+            if (_active->size == _bufferSize) {
+                submit(*std::exchange(_active, nullptr));
+            }
+        }
+        return nBytes;
+    }
+
+private:
+    [[nodiscard]] StagingBuffer* acquireFreeBuffer() noexcept {
+        for (std::size_t i = 0UZ; i < _queueDepth; i++) {
+            if (!_buffers[i].inFlight.load(std::memory_order_acquire)) {
+                _buffers[i].size = 0UZ;
+                return &_buffers[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void submit(StagingBuffer& buffer) {
+        buffer.fileOffset = _fileOffset;
+        buffer.writeSize  = buffer.size;
+        buffer.written    = 0UZ;
+        if (_fdDirect && (buffer.writeSize % kAlignment) != 0UZ) { // O_DIRECT requires block-sized writes, padding is truncated on close
+            const std::size_t padded = (buffer.writeSize + kAlignment - 1UZ) / kAlignment * kAlignment;
+            std::memset(buffer.data.get() + buffer.writeSize, 0, padded - buffer.writeSize);
+            buffer.writeSize = padded;
+        }
+        _fileOffset += static_cast<off_t>(buffer.size);
+        buffer.inFlight.store(true, std::memory_order_release);
+        _nInFlight.fetch_add(1UZ, std::memory_order_acq_rel);
+
+#if GR_FILEIO_USE_IO_URING
+        if (_ringInitialised) {
+            submitRemaining(buffer);
+            return;
+        }
+#endif
+        if (_threadPool) {
+            _threadPool->execute([this, &buffer] { complete(buffer, writeAll(_fd, buffer)); });
+        } else {
+            complete(buffer, writeAll(_fd, buffer));
+        }
+    }
+
+    [[nodiscard]] static int writeAll(int fd, const StagingBuffer& buffer) noexcept {
+        std::size_t written = 0UZ;
+        while (written < buffer.writeSize) {
+            const ssize_t ret = ::pwrite(fd, buffer.data.get() + written, buffer.writeSize - written, buffer.fileOffset + static_cast<off_t>(written));
+            if (ret < 0) {
+                if (errno == EINTR) {
+                    continue;
+                }
+                return errno;
+            }
+            written += static_cast<std::size_t>(ret);
+        }
+        return 0;
+    }
+
+#if GR_FILEIO_USE_IO_URING
+    void submitRemaining(StagingBuffer& buffer) noexcept {
+        io_uring_sqe* sqe = io_uring_get_sqe(&_ring); // cannot fail: number of buffers in flight <= queue depth
+        io_uring_prep_write(sqe, _fd, buffer.data.get() + buffer.written, static_cast<unsigned>(buffer.writeSize - buffer.written), static_cast<__u64>(buffer.fileOffset + static_cast<off_t>(buffer.written)));
+        io_uring_sqe_set_data(sqe, &buffer);
+        if (const int ret = io_uring_submit(&_ring); ret < 0) {
+            complete(buffer, -ret);
+        }
+    }
+#endif
+
+    void complete(StagingBuffer& buffer, int error) noexcept {
+        if (error != 0) {
+            int expected = 0;
+            _error.compare_exchange_strong(expected, error, std::memory_order_acq_rel);
+        }
+        // N.B. decrement and notify under the lock held by waitForAll(): otherwise the waiter may observe zero, return and destroy
+        // the writer (incl. the notified object) in-between
+        std::lock_guard lock(_completionMutex);
+        buffer.inFlight.store(false, std::memory_order_release);
+        _nInFlight.fetch_sub(1UZ, std::memory_order_acq_rel);
+        _completion.notify_all();
+    }
+
+    void reapCompletions() noexcept {
+#if GR_FILEIO_USE_IO_URING
+        io_uring_cqe* cqe = nullptr;
+        while (_ringInitialised && io_uring_peek_cqe(&_ring, &cqe) == 0) {
+            auto&     buffer = *static_cast<StagingBuffer*>(io_uring_cqe_get_data(cqe));
+            const int res    = cqe->res;
+            io_uring_cqe_seen(&_ring, cqe);
+            if (res < 0) {
+                complete(buffer, -res);
+                continue;
+            }
+            buffer.written += static_cast<std::size_t>(res);
+            if (buffer.written >= buffer.writeSize) {
+                complete(buffer, 0);
+            } else if (res == 0) { // no progress (e.g. disk full) -> report instead of re-submitting forever
+                complete(buffer, ENOSPC);
+            } else { // short write -> re-submit the remaining bytes
+                submitRemaining(buffer);
+            }
+        }
+#endif
+    }
+
+    void waitForAll() noexcept {
+#if GR_FILEIO_USE_IO_URING
+        while (_ringInitialised && _nInFlight.load(std::memory_order_acquire) > 0UZ) {
+            io_uring_cqe* cqe = nullptr;
+            if (io_uring_wait_cqe(&_ring, &cqe) == 0) {
+                reapCompletions();
+            }
+        }
+#endif
+        std::unique_lock lock(_completionMutex);
+        _completion.wait(lock, [this] { return _nInFlight.load(std::memory_order_acquire) == 0UZ; });
+    }
+
+    void throwOnError() {
+        if (const int error = _error.exchange(0, std::memory_order_acq_rel); error != 0) {
+            throw gr::exception(fmt::format("failed to write to file '{}': {}", _fileName, std::strerror(error)));
+        }
+    }
+};
+
+} // namespace gr::blocks::fileio::detail
+
+#endif // ASYNCFILEWRITER_HPP
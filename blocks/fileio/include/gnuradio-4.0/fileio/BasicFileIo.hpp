@@ -6,12 +6,21 @@
 #include <gnuradio-4.0/meta/formatter.hpp>
 #include <magic_enum.hpp>
 
+#include <gnuradio-4.0/fileio/AsyncFileWriter.hpp>
+#include <gnuradio-4.0/fileio/Compression.hpp>
+#include <gnuradio-4.0/fileio/MemoryMappedFile.hpp>
+
 #include <chrono>
 #include <complex>
+#include <cstring>
+#include <deque>
 #include <filesystem>
 #include <fstream>
+#include <future>
+#include <optional>
 #include <span>
 #include <string_view>
+#include <thread>
 
 namespace gr::blocks::fileio {
 
@@ -66,35 +75,71 @@ struct BasicFileSink : public gr::Block<BasicFileSink<T>> {
     using Description = Doc<R""(A sink block for writing a stream to a binary file.
 The file can be played back using a 'BasicFileSource' or read by any program that supports binary files (e.g. Python, C, C++, MATLAB).
 For complex types, the binary file contains [float, double]s in IQIQIQ order. No metadata is included with the binary data.)
-Important: this implementation assumes a host-order, CPU architecture specific byte order!)"">;
+Important: this implementation assumes a host-order, CPU architecture specific byte order!
+
+With 'async_io' enabled, samples are copied into 'queue_depth' page-aligned staging buffers of 'buffer_size' bytes that are
+written in the background (io_uring if available, IO thread-pool + pwrite otherwise), optionally using O_DIRECT.
+If all staging buffers are in flight, only part of the input is consumed, i.e. back-pressure is propagated via the input port
+rather than stalling the scheduler thread (nothing consumed: 'INSUFFICIENT_OUTPUT_ITEMS', i.e. no progress is reported).
+
+With 'compression' enabled, the stream is split into frames of 'buffer_size' bytes that are losslessly compressed on the IO
+thread pool (up to 'queue_depth' frames in flight) and written in order (see 'compression::Codec' for the file format).
+'BasicFileSource' decompresses such files transparently (with 'compressed' set). 'max_bytes_per_file' refers to the uncompressed size.)"">;
     template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
     using A = gr::Annotated<U, description, Arguments...>; // optional shortening
 
     PortIn<T> in;
 
-    A<std::string, "file name", Doc<"base filename, prefixed if ">, Visible>              file_name;
-    Mode                                                                                  _mode              = Mode::overwrite;
-    A<std::string, "mode", Doc<"mode: \"overwrite\", \"append\", \"multi\"">, Visible>    mode               = std::string(magic_enum::enum_name(_mode));
-    A<gr::Size_t, "max bytes per file", Doc<"max bytes per file, 0: infinite ">, Visible> max_bytes_per_file = 0U;
-
-    GR_MAKE_REFLECTABLE(BasicFileSink, in, file_name, mode, max_bytes_per_file);
-
-    std::size_t   _totalBytesWritten{0UZ};
-    std::size_t   _totalBytesWrittenFile{0UZ};
-    std::ofstream _file;
-    std::size_t   _fileCounter{0UZ};
-    std::string   _actualFileName;
+    A<std::string, "file name", Doc<"base filename, prefixed if ">, Visible>                               file_name;
+    Mode                                                                                                   _mode              = Mode::overwrite;
+    A<std::string, "mode", Doc<"mode: \"overwrite\", \"append\", \"multi\"">, Visible>                     mode               = std::string(magic_enum::enum_name(_mode));
+    A<gr::Size_t, "max bytes per file", Doc<"max bytes per file, 0: infinite ">, Visible>                  max_bytes_per_file = 0U;
+    A<bool, "async IO", Doc<"true: write asynchronously via aligned staging buffers">>                     async_io           = false;
+    A<bool, "direct IO", Doc<"true: by-pass page-cache (O_DIRECT) if supported, async only">>              direct_io          = false;
+    A<gr::Size_t, "queue depth", Doc<"number of staging buffers (>= 2) or compression frames in flight">>  queue_depth        = 4U;
+    A<gr::Size_t, "buffer size", Doc<"staging buffer or compression frame size">, Unit<"B">>               buffer_size        = 1U << 20U;
+    A<std::string, "compression", Doc<"\"none\", \"auto\", \"delta_bitpack\" (integers), \"shuffle_lz\"">> compression        = "none";
+
+    GR_MAKE_REFLECTABLE(BasicFileSink, in, file_name, mode, max_bytes_per_file, async_io, direct_io, queue_depth, buffer_size, compression);
+
+    struct CompressedFrame {
+        std::vector<std::byte> bytes;
+        std::vector<T>         samples; // N.B. handed back (cleared) to be re-used for a later frame, retains its capacity
+    };
+
+    std::size_t                                     _totalBytesWritten{0UZ}; // uncompressed
+    std::size_t                                     _totalBytesWrittenFile{0UZ};
+    std::size_t                                     _totalBytesCompressed{0UZ}; // written to disk if compression is enabled
+    std::ofstream                                   _file;
+    std::unique_ptr<detail::AsyncFileWriter>        _asyncFile;
+    std::size_t                                     _fileCounter{0UZ};
+    std::string                                     _actualFileName;
+    compression::Codec                              _codec = compression::Codec::none;
+    std::vector<T>                                  _frame;           // uncompressed samples of the frame being filled
+    std::vector<std::vector<T>>                     _spareFrames;     // sample buffers returned by the compression tasks
+    std::deque<std::future<CompressedFrame>>        _pendingFrames;   // frames being compressed on the IO thread pool
+    std::vector<std::byte>                          _compressedFrame; // compressed frame being written
+    std::size_t                                     _compressedFrameOffset{0UZ};
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) {
         _mode = magic_enum::enum_cast<Mode>(mode, magic_enum::case_insensitive).value_or(_mode);
+        if (const auto codec = compression::parseCodec<T>(compression.value); codec) {
+            _codec = *codec;
+        } else {
+            throw gr::exception(fmt::format("unsupported compression '{}' for type '{}'", compression.value, gr::meta::type_name<T>()));
+        }
         if (lifecycle::isActive(this->state())) {
             closeFile();
+            _asyncFile.reset(); // apply possibly changed async IO settings
             openNextFile();
+        } else {
+            _asyncFile.reset();
         }
     }
 
     void start() {
-        _totalBytesWritten = 0UZ;
+        _totalBytesWritten    = 0UZ;
+        _totalBytesCompressed = 0UZ;
         openNextFile();
     }
 
@@ -110,7 +155,15 @@ Important: this implementation assumes a host-order, CPU architecture specific b
         if (max_bytes_per_file.value != 0U) {
             nBytesMax = std::min(nBytesMax, static_cast<std::size_t>(max_bytes_per_file.value) - _totalBytesWrittenFile);
         }
-        _file.write(reinterpret_cast<const char*>(dataIn.data()), static_cast<std::streamsize>(nBytesMax));
+        if (_codec != compression::Codec::none) {
+            // accepts only what fits into the frames in flight -> remaining samples stay in the input buffer (back-pressure)
+            nBytesMax = compressFrames(std::span(dataIn.data(), nBytesMax / sizeof(T))) * sizeof(T);
+        } else if (_asyncFile) {
+            // accepts only what fits into the free staging buffers -> remaining samples stay in the input buffer (back-pressure)
+            nBytesMax = _asyncFile->write(std::span(reinterpret_cast<const std::byte*>(dataIn.data()), nBytesMax), sizeof(T));
+        } else {
+            _file.write(reinterpret_cast<const char*>(dataIn.data()), static_cast<std::streamsize>(nBytesMax));
+        }
         if (!dataIn.consume(nBytesMax / sizeof(T))) {
             throw gr::exception("could not consume input samples");
         }
@@ -118,6 +171,10 @@ Important: this implementation assumes a host-order, CPU architecture specific b
         if (!_file) {
             throw gr::exception(fmt::format("failed to write to file '{}'.", _actualFileName));
         }
+        if (nBytesMax == 0UZ && !dataIn.empty()) {
+            // all staging buffers (frames) in flight: report no progress so that the scheduler backs off instead of busy-spinning
+            return work::Status::INSUFFICIENT_OUTPUT_ITEMS;
+        }
 
         _totalBytesWritten += nBytesMax;
         _totalBytesWrittenFile += nBytesMax;
@@ -126,10 +183,95 @@ Important: this implementation assumes a host-order, CPU architecture specific b
     }
 
 private:
+    [[nodiscard]] std::size_t compressFrames(std::span<const T> samples) {
+        writeCompressedFrames(false);
+
+        const std::size_t frameSize = std::max(1UZ, static_cast<std::size_t>(buffer_size.value) / sizeof(T));
+        std::size_t       nSamples  = 0UZ;
+        while (nSamples < samples.size() || _frame.size() >= frameSize) {
+            if (_frame.size() >= frameSize) {
+                if (_pendingFrames.size() >= std::max(1UZ, static_cast<std::size_t>(queue_depth.value))) {
+                    break;
+                }
+                submitFrame();
+            }
+            const std::size_t nCopy = std::min(samples.size() - nSamples, frameSize - _frame.size());
+            _frame.insert(_frame.end(), samples.begin() + static_cast<std::ptrdiff_t>(nSamples), samples.begin() + static_cast<std::ptrdiff_t>(nSamples + nCopy));
+            nSamples += nCopy;
+        }
+        return nSamples;
+    }
+
+    void submitFrame() {
+        if (_frame.empty()) {
+            return;
+        }
+        std::vector<T> spare;
+        if (!_spareFrames.empty()) {
+            spare = std::move(_spareFrames.back());
+            _spareFrames.pop_back();
+        }
+        auto compress = [frame = std::exchange(_frame, std::move(spare)), codec = _codec]() mutable {
+            std::vector<std::byte> bytes = compression::compressFrame<T>(frame, codec);
+            frame.clear();
+            return CompressedFrame{std::move(bytes), std::move(frame)};
+        };
+        if (this->ioThreadPool) {
+            _pendingFrames.push_back(this->ioThreadPool->execute(std::move(compress)));
+        } else {
+            _pendingFrames.push_back(std::async(std::launch::deferred, std::move(compress)));
+        }
+    }
+
+    /**
+     * @brief writes the compressed frames in order, either only those that are ready (non-blocking) or all of them (blocking)
+     */
+    void writeCompressedFrames(bool blocking) {
+        using namespace std::chrono_literals;
+        while (true) {
+            if (_compressedFrameOffset >= _compressedFrame.size()) {
+                if (_pendingFrames.empty() || (!blocking && _pendingFrames.front().wait_for(0s) == std::future_status::timeout)) {
+                    return;
+                }
+                CompressedFrame frame  = _pendingFrames.front().get(); // N.B. re-throws compression errors
+                _compressedFrame       = std::move(frame.bytes);
+                _compressedFrameOffset = 0UZ;
+                _spareFrames.push_back(std::move(frame.samples));
+                _pendingFrames.pop_front();
+            }
+
+            const auto  remaining = std::span(_compressedFrame).subspan(_compressedFrameOffset);
+            std::size_t nWritten  = remaining.size();
+            if (_asyncFile) {
+                nWritten = _asyncFile->write(remaining);
+                if (nWritten == 0UZ) {
+                    if (!blocking) {
+                        return; // staging buffers busy -> continue during the next invocation
+                    }
+                    std::this_thread::yield();
+                }
+            } else {
+                _file.write(reinterpret_cast<const char*>(remaining.data()), static_cast<std::streamsize>(remaining.size()));
+                if (!_file) {
+                    throw gr::exception(fmt::format("failed to write to file '{}'.", _actualFileName));
+                }
+            }
+            _compressedFrameOffset += nWritten;
+            _totalBytesCompressed += nWritten;
+        }
+    }
+
     void closeFile() {
+        if (_file.is_open() || (_asyncFile && _asyncFile->isOpen())) {
+            submitFrame(); // flush the incomplete frame
+            writeCompressedFrames(true);
+        }
         if (_file.is_open()) {
             _file.close();
         }
+        if (_asyncFile) {
+            _asyncFile->close(); // flushes and waits for the outstanding writes
+        }
     }
     void openNextFile() {
         closeFile();
@@ -144,23 +286,25 @@ private:
 
         // Open file handle based on mode
         switch (_mode) {
-        case Mode::overwrite: {
-            _actualFileName = file_name.value;
-            _file.open(_actualFileName, std::ios::binary | std::ios::trunc);
-        } break;
-        case Mode::append: {
-            _actualFileName = file_name.value;
-            _file.open(_actualFileName, std::ios::binary | std::ios::app);
-        } break;
+        case Mode::overwrite:
+        case Mode::append: _actualFileName = file_name.value; break;
         case Mode::multi: {
             // _fileCounter ensures that the filenames are unique and still sortable by date-time, with an additional counter to handle rapid successive file creation.
             _actualFileName = filePath.parent_path() / (gr::time::getIsoTime() + "_" + std::to_string(_fileCounter++) + "_" + filePath.filename().string());
-            _file.open(_actualFileName, std::ios::binary);
             break;
         }
         default: throw gr::exception("unsupported file mode.");
         }
 
+        if (async_io) {
+            if (!_asyncFile) {
+                _asyncFile = std::make_unique<detail::AsyncFileWriter>(buffer_size.value, queue_depth.value, direct_io.value, this->ioThreadPool);
+            }
+            _asyncFile->open(_actualFileName, _mode == Mode::append);
+            return;
+        }
+
+        _file.open(_actualFileName, _mode == Mode::append ? (std::ios::binary | std::ios::app) : (std::ios::binary | std::ios::trunc));
         if (!_file) {
             throw gr::exception(fmt::format("failed to open file '{}'.", _actualFileName));
         }
@@ -172,38 +316,62 @@ struct BasicFileSource : public gr::Block<BasicFileSource<T>> {
     using Description = Doc<R""(A source block for reading a binary file and outputting the data.
 This source is the counterpart to 'BasicFileSink'.
 For complex types, the binary file contains [float, double]s in IQIQIQ order. No metadata is expected in the binary data.
-Important: this implementation assumes a host-order, CPU architecture specific byte order!)"">;
+Important: this implementation assumes a host-order, CPU architecture specific byte order!
+
+With 'memory_mapped' enabled, files are mmap-ed (MADV_SEQUENTIAL) with a sliding MADV_WILLNEED read-ahead window and the next
+file in 'multi' mode is opened and prefetched on the IO thread pool while the current one is being replayed.
+Setting 'seek_position' (e.g. via a settings message) moves the read position within the current file (random-access scrubbing).
+
+Files written by 'BasicFileSink' with 'compression' enabled are read with 'compressed' set (N.B. explicit rather than sniffed, since
+any raw sample sequence may match a frame header) and decompressed transparently, 'offset', 'length' and 'seek_position' refer to
+the uncompressed samples.)"">;
 
     template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
     using A = gr::Annotated<U, description, Arguments...>; // optional shortening
 
     PortOut<T> out;
 
-    A<std::string, "file name", Doc<"Base filename, prefixed if necessary">, Visible>          file_name;
-    Mode                                                                                       _mode        = Mode::overwrite;
-    A<std::string, "mode", Doc<"mode: \"overwrite\", \"append\", \"multi\"">, Visible>         mode         = std::string(magic_enum::enum_name(_mode));
-    A<bool, "repeat", Doc<"true: repeat back-to-back">>                                        repeat       = false;
-    A<gr::Size_t, "offset", Doc<"file start offset in bytes">, Visible>                        offset       = 0U;
-    A<gr::Size_t, "length", Doc<"max number of samples items to read (0: infinite)">, Visible> length       = 0U;
-    A<std::string, "trigger name", Doc<"name of trigger added to each file chunk">>            trigger_name = "BasicFileSource::start";
-
-    GR_MAKE_REFLECTABLE(BasicFileSource, out, file_name, mode, repeat, offset, length, trigger_name);
-
-    std::ifstream                      _file;
-    std::vector<std::filesystem::path> _filesToRead;
-    bool                               _emittedStartTrigger = false;
-    std::size_t                        _totalBytesRead      = 0UZ;
-    std::size_t                        _totalBytesReadFile  = 0UZ;
-    std::size_t                        _currentFileIndex    = 0UZ;
-    std::string                        _currentFileName;
-
-    void settingsChanged(const property_map& /*oldSettings*/, const property_map& /*newSettings*/) { //
+    A<std::string, "file name", Doc<"Base filename, prefixed if necessary">, Visible>                file_name;
+    Mode                                                                                             _mode         = Mode::overwrite;
+    A<std::string, "mode", Doc<"mode: \"overwrite\", \"append\", \"multi\"">, Visible>               mode          = std::string(magic_enum::enum_name(_mode));
+    A<bool, "repeat", Doc<"true: repeat back-to-back">>                                              repeat        = false;
+    A<gr::Size_t, "offset", Doc<"file start offset in bytes">, Visible>                              offset        = 0U;
+    A<gr::Size_t, "length", Doc<"max number of samples items to read (0: infinite)">, Visible>       length        = 0U;
+    A<std::string, "trigger name", Doc<"name of trigger added to each file chunk">>                  trigger_name  = "BasicFileSource::start";
+    A<bool, "memory mapped", Doc<"true: mmap-based reading with read-ahead and next-file prefetch">> memory_mapped = false;
+    A<std::int64_t, "seek position", Doc<"seek to sample index in the current file (-1: none)">>     seek_position = -1;
+    A<bool, "compressed", Doc<"true: file(s) written by 'BasicFileSink' with 'compression'">>        compressed    = false;
+
+    GR_MAKE_REFLECTABLE(BasicFileSource, out, file_name, mode, repeat, offset, length, trigger_name, memory_mapped, seek_position, compressed);
+
+    std::ifstream                         _file;
+    detail::MemoryMappedFile              _mappedFile;
+    std::future<detail::MemoryMappedFile> _prefetchedFile;
+    std::vector<std::filesystem::path>    _filesToRead;
+    bool                                  _emittedStartTrigger = false;
+    std::size_t                           _totalBytesRead      = 0UZ;
+    std::size_t                           _totalBytesReadFile  = 0UZ;
+    std::size_t                           _currentFileIndex    = 0UZ;
+    std::size_t                           _prefetchedFileIndex = 0UZ;
+    std::size_t                           _readPosition        = 0UZ; // byte position within the memory-mapped file
+    std::string                           _currentFileName;
+    bool                                  _compressed = false; // current file consists of compressed frames
+    std::vector<std::byte>                _framePayload;
+    std::vector<std::byte>                _decodedFrame;
+    std::size_t                           _decodedPosition = 0UZ; // byte position within '_decodedFrame'
+    std::optional<std::size_t>            _pendingSeek;           // sample index requested while no file was open (e.g. initial settings)
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) { //
         _mode = magic_enum::enum_cast<Mode>(mode, magic_enum::case_insensitive).value_or(_mode);
+        if (newSettings.contains("seek_position") && seek_position >= 0) {
+            seek(static_cast<std::size_t>(seek_position.value));
+        }
     }
 
     void start() {
         _currentFileIndex = 0UZ;
         _totalBytesRead   = 0UZ;
+        _prefetchedFile   = {};
         _filesToRead.clear();
 
         std::filesystem::path filePath(file_name.value);
@@ -227,8 +395,8 @@ Important: this implementation assumes a host-order, CPU architecture specific b
 
     void stop() { closeFile(); }
 
-    [[nodiscard]] constexpr work::Status processBulk(OutputSpanLike auto& dataOut) noexcept {
-        if (!_file.is_open()) {
+    [[nodiscard]] constexpr work::Status processBulk(OutputSpanLike auto& dataOut) {
+        if (!isFileOpen()) {
             return work::Status::DONE;
         }
         std::size_t nOutAvailable = dataOut.size() * sizeof(T);
@@ -236,7 +404,7 @@ Important: this implementation assumes a host-order, CPU architecture specific b
             nOutAvailable = std::min(nOutAvailable, (length.value * sizeof(T) - _totalBytesReadFile));
         }
 
-        std::size_t bytesRead = static_cast<std::size_t>(_file.read(reinterpret_cast<char*>(dataOut.data()), static_cast<std::streamsize>(nOutAvailable)).gcount());
+        std::size_t bytesRead = read(reinterpret_cast<std::byte*>(dataOut.data()), nOutAvailable);
         if (!_emittedStartTrigger && !trigger_name.value.empty()) {
             dataOut.publishTag(
                 property_map{
@@ -269,12 +437,141 @@ Important: this implementation assumes a host-order, CPU architecture specific b
         return work::Status::OK;
     }
 
+    /**
+     * @brief moves the read position to the given sample index within the current file ('length' is counted from there)
+     *
+     * If no file is open yet (e.g. 'seek_position' set in the initial settings), the seek is applied once the next file is opened.
+     */
+    void seek(std::size_t sampleIndex) {
+        if (!isFileOpen()) {
+            _pendingSeek = sampleIndex;
+            return;
+        }
+        _totalBytesReadFile = 0UZ;
+        if (_compressed) {
+            seekCompressed(sampleIndex * sizeof(T));
+        } else if (memory_mapped) {
+            _readPosition = std::min(sampleIndex * sizeof(T), _mappedFile.size() / sizeof(T) * sizeof(T));
+            _mappedFile.seek(_readPosition);
+        } else {
+            _file.clear();
+            _file.seekg(static_cast<std::streamoff>(sampleIndex * sizeof(T)), std::ios::beg);
+        }
+    }
+
 private:
+    [[nodiscard]] bool isFileOpen() const noexcept { return _file.is_open() || _mappedFile.isOpen(); }
+
+    [[nodiscard]] std::size_t read(std::byte* dst, std::size_t nBytesMax) {
+        if (!_compressed) {
+            return readRaw(dst, nBytesMax);
+        }
+        std::size_t nBytes = 0UZ;
+        while (nBytes < nBytesMax && (_decodedPosition < _decodedFrame.size() || decodeNextFrame())) {
+            const std::size_t nCopy = std::min(nBytesMax - nBytes, _decodedFrame.size() - _decodedPosition);
+            std::memcpy(dst + nBytes, _decodedFrame.data() + _decodedPosition, nCopy);
+            _decodedPosition += nCopy;
+            nBytes += nCopy;
+        }
+        return nBytes;
+    }
+
+    [[nodiscard]] std::size_t readRaw(std::byte* dst, std::size_t nBytesMax) noexcept {
+        if (!_mappedFile.isOpen()) {
+            return static_cast<std::size_t>(_file.read(reinterpret_cast<char*>(dst), static_cast<std::streamsize>(nBytesMax)).gcount());
+        }
+        const auto        data   = _mappedFile.data();
+        const std::size_t nBytes = std::min(nBytesMax, data.size() - std::min(_readPosition, data.size()));
+        std::memcpy(dst, data.data() + _readPosition, nBytes);
+        _readPosition += nBytes;
+        _mappedFile.advance(_readPosition);
+        return nBytes;
+    }
+
+    /**
+     * @brief returns a view of the next 'nBytes' bytes (zero-copy if memory-mapped), shorter if the file is truncated
+     */
+    [[nodiscard]] std::span<const std::byte> readRawView(std::size_t nBytes) {
+        if (_mappedFile.isOpen()) {
+            const auto data = _mappedFile.data().subspan(std::min(_readPosition, _mappedFile.size()));
+            const auto view = data.first(std::min(nBytes, data.size()));
+            _readPosition += view.size();
+            _mappedFile.advance(_readPosition);
+            return view;
+        }
+        _framePayload.resize(nBytes);
+        return std::span(_framePayload).first(readRaw(_framePayload.data(), nBytes));
+    }
+
+    void skipRaw(std::size_t nBytes) {
+        if (_mappedFile.isOpen()) {
+            _readPosition = std::min(_readPosition + nBytes, _mappedFile.size());
+        } else {
+            _file.seekg(static_cast<std::streamoff>(nBytes), std::ios::cur);
+        }
+    }
+
+    [[nodiscard]] std::optional<compression::FrameHeader> readFrameHeader() {
+        compression::FrameHeader header;
+        if (readRaw(reinterpret_cast<std::byte*>(&header), sizeof(header)) != sizeof(header)) {
+            return std::nullopt; // end of file
+        }
+        if (header.magic != compression::kFrameMagic || header.itemSize != sizeof(T)) {
+            throw gr::exception(fmt::format("file '{}': corrupt compressed frame or item size mismatch ({} vs. {} for '{}')", _currentFileName, header.itemSize, sizeof(T), gr::meta::type_name<T>()));
+        }
+        return header;
+    }
+
+    [[nodiscard]] bool decodeFrame(const compression::FrameHeader& header) {
+        const auto payload = readRawView(header.compressedSize);
+        if (payload.size() != header.compressedSize) {
+            return false; // truncated frame (e.g. incomplete recording)
+        }
+        _decodedFrame.resize(header.rawSize);
+        compression::decompressFrame(header, payload, _decodedFrame);
+        _decodedPosition = 0UZ;
+        return true;
+    }
+
+    [[nodiscard]] bool decodeNextFrame() {
+        _decodedFrame.clear();
+        _decodedPosition = 0UZ;
+        const auto header = readFrameHeader();
+        return header.has_value() && decodeFrame(*header);
+    }
+
+    void seekCompressed(std::size_t bytePosition) { // linear scan over the frame headers, payloads are skipped
+        if (_mappedFile.isOpen()) {
+            _readPosition = 0UZ;
+            _mappedFile.seek(0UZ);
+        } else {
+            _file.clear();
+            _file.seekg(0, std::ios::beg);
+        }
+        _decodedFrame.clear();
+        _decodedPosition = 0UZ;
+        while (const auto header = readFrameHeader()) {
+            if (bytePosition < header->rawSize) {
+                if (decodeFrame(*header)) {
+                    _decodedPosition = bytePosition / sizeof(T) * sizeof(T);
+                }
+                return;
+            }
+            bytePosition -= header->rawSize;
+            skipRaw(header->compressedSize);
+        }
+    }
+
     void closeFile() {
         if (_file.is_open()) {
             _file.close();
         }
+        _mappedFile = detail::MemoryMappedFile{};
+        _compressed = false;
+        _decodedFrame.clear();
+        _decodedPosition = 0UZ;
     }
+
     void openNextFile() {
         if (_currentFileIndex >= _filesToRead.size()) {
             return;
@@ -283,15 +580,59 @@ private:
         _emittedStartTrigger = false;
 
         _currentFileName = _filesToRead[_currentFileIndex].string();
+        if (memory_mapped) {
+            if (_prefetchedFile.valid() && _prefetchedFileIndex == _currentFileIndex) {
+                _mappedFile = _prefetchedFile.get(); // opened and paged-in in the background
+            } else {
+                _mappedFile = detail::MemoryMappedFile(_currentFileName);
+            }
+            _compressed = compressed;
+            if (_compressed) {
+                seekCompressed(static_cast<std::size_t>(offset.value) * sizeof(T));
+            } else {
+                _readPosition = std::min(static_cast<std::size_t>(offset.value) * sizeof(T), _mappedFile.size());
+                _mappedFile.seek(_readPosition);
+            }
+            applyPendingSeek();
+            _currentFileIndex++;
+            prefetchNextFile();
+            return;
+        }
+
         _file.open(_currentFileName, std::ios::binary);
         if (!_file) {
             throw gr::exception(fmt::format("failed to open file '{}'.", _currentFileName));
         }
-        if (offset.value != 0U) {
+        _compressed = compressed;
+        if (_compressed) {
+            seekCompressed(static_cast<std::size_t>(offset.value) * sizeof(T));
+        } else if (offset.value != 0U) {
             _file.seekg(offset.value * sizeof(T), std::ios::beg);
         }
+        applyPendingSeek();
         _currentFileIndex++;
     }
+
+    void applyPendingSeek() {
+        if (_pendingSeek) {
+            seek(*std::exchange(_pendingSeek, std::nullopt));
+        }
+    }
+
+    void prefetchNextFile() {
+        std::size_t nextIndex = _currentFileIndex;
+        if (nextIndex >= _filesToRead.size()) {
+            if (!repeat || _filesToRead.size() <= 1UZ) {
+                return;
+            }
+            nextIndex = 0UZ;
+        }
+        if (!this->ioThreadPool) {
+            return;
+        }
+        _prefetchedFileIndex = nextIndex;
+        _prefetchedFile      = this->ioThreadPool->execute([fileName = _filesToRead[nextIndex].string()] { return detail::MemoryMappedFile(fileName); });
+    }
 };
 
 } // namespace gr::blocks::fileio
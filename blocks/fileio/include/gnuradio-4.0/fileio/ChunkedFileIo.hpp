@@ -0,0 +1,566 @@
+#ifndef CHUNKEDFILEIO_HPP
+#define CHUNKEDFILEIO_HPP
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/Tag.hpp>
+#include <gnuradio-4.0/YamlPmt.hpp>
+#include <gnuradio-4.0/fileio/BasicFileIo.hpp>
+
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <complex>
+#include <cstdint>
+#include <cstring>
+#include <fstream>
+#include <optional>
+#include <span>
+#include <string>
+#include <vector>
+
+namespace gr::blocks::fileio {
+
+/**
+ * Self-describing chunked capture format ('*.gr4c'):
+ *
+ *   FileHeader                         magic, version, item size, chunk size, flags, sample type name
+ *   { [Tags record] Data record }*     each data chunk holds up to 'chunkSize' samples, optionally preceded by the tags it covers
+ *   Index record                       one IndexEntry per data chunk (sample index, time-stamp -> file offset)
+ *   Trailer                            file offset of the index record + trailer magic
+ *
+ * Every record starts with a RecordHeader carrying its payload size, the index/time-stamp of its first sample and an
+ * optional CRC-32 checksum of the payload. Captures that lack the footer (e.g. after a crash) are re-indexed by a linear
+ * scan of the record headers (i.e. without reading the payloads). All fields are stored in host byte-order.
+ */
+namespace chunked {
+
+inline constexpr std::array<char, 8> kFileMagic    = {'G', 'R', '4', 'C', 'H', 'N', 'K', '1'};
+inline constexpr std::array<char, 8> kTrailerMagic = {'G', 'R', '4', 'I', 'N', 'D', 'E', 'X'};
+inline constexpr std::uint32_t       kVersion      = 1U;
+inline constexpr std::uint32_t       kFlagChecksum = 1U << 0U;
+
+enum class RecordType : std::uint32_t { Data = 1U, Tags = 2U, Index = 3U };
+
+struct FileHeader {
+    std::array<char, 8>  magic     = kFileMagic;
+    std::uint32_t        version   = kVersion;
+    std::uint32_t        itemSize  = 0U; // sizeof(T)
+    std::uint32_t        chunkSize = 0U; // max. number of samples per data chunk
+    std::uint32_t        flags     = 0U;
+    std::array<char, 64> typeName{};     // null-terminated sample type name (informative only)
+};
+static_assert(sizeof(FileHeader) == 88UZ && std::is_trivially_copyable_v<FileHeader>);
+
+struct RecordHeader {
+    RecordType    type{RecordType::Data};
+    std::uint32_t checksum{0U};    // CRC-32 of the payload (0: not computed)
+    std::uint64_t payloadSize{0U}; // [bytes]
+    std::uint64_t sampleIndex{0U}; // index of the first sample covered by this record
+    std::int64_t  timeNs{0};       // UTC time-stamp of 'sampleIndex' [ns]
+};
+static_assert(sizeof(RecordHeader) == 32UZ && std::is_trivially_copyable_v<RecordHeader>);
+
+struct IndexEntry {
+    std::uint64_t sampleIndex{0U}; // index of the first sample of the chunk
+    std::uint64_t nSamples{0U};
+    std::int64_t  timeNs{0};       // UTC time-stamp of 'sampleIndex' [ns]
+    std::uint64_t fileOffset{0U};  // offset of the chunk's first record (tags or data)
+    double        sampleRate{0.0}; // [Hz], used to seek within a chunk
+};
+static_assert(sizeof(IndexEntry) == 40UZ && std::is_trivially_copyable_v<IndexEntry>);
+
+struct Trailer {
+    std::uint64_t       indexOffset{0U}; // file offset of the index record header
+    std::array<char, 8> magic = kTrailerMagic;
+};
+static_assert(sizeof(Trailer) == 16UZ && std::is_trivially_copyable_v<Trailer>);
+
+[[nodiscard]] inline std::uint32_t crc32(std::span<const std::byte> data, std::uint32_t crc = 0U) noexcept {
+    static constexpr std::array<std::uint32_t, 256> table = [] {
+        std::array<std::uint32_t, 256> result{};
+        for (std::uint32_t i = 0U; i < 256U; i++) {
+            std::uint32_t c = i;
+            for (int k = 0; k < 8; k++) {
+                c = (c & 1U) != 0U ? 0xEDB88320U ^ (c >> 1U) : c >> 1U;
+            }
+            result[i] = c;
+        }
+        return result;
+    }();
+    crc = ~crc;
+    for (const std::byte b : data) {
+        crc = table[(crc ^ static_cast<std::uint32_t>(b)) & 0xFFU] ^ (crc >> 8U);
+    }
+    return ~crc;
+}
+
+template<typename TPod>
+requires std::is_trivially_copyable_v<TPod>
+void write(std::ostream& os, const TPod& value) {
+    os.write(reinterpret_cast<const char*>(&value), sizeof(TPod));
+}
+
+template<typename TPod>
+requires std::is_trivially_copyable_v<TPod>
+[[nodiscard]] bool read(std::istream& is, TPod& value) {
+    return static_cast<bool>(is.read(reinterpret_cast<char*>(&value), sizeof(TPod)));
+}
+
+/**
+ * @brief serialises tags as [u64 absolute sample index, u64 length, YAML-encoded (type-tagged) property map]*
+ */
+inline void serialiseTags(std::span<const Tag> tags, std::vector<std::byte>& out) {
+    out.clear();
+    for (const Tag& tag : tags) {
+        const std::string   yaml   = pmtv::yaml::serialize(tag.map);
+        const std::uint64_t index  = static_cast<std::uint64_t>(tag.index);
+        const std::uint64_t length = yaml.size();
+        const auto          offset = out.size();
+        out.resize(offset + 2UZ * sizeof(std::uint64_t) + yaml.size());
+        std::memcpy(out.data() + offset, &index, sizeof(index));
+        std::memcpy(out.data() + offset + sizeof(index), &length, sizeof(length));
+        std::memcpy(out.data() + offset + 2UZ * sizeof(std::uint64_t), yaml.data(), yaml.size());
+    }
+}
+
+[[nodiscard]] inline std::vector<Tag> deserialiseTags(std::span<const std::byte> in) {
+    std::vector<Tag> tags;
+    std::size_t      offset = 0UZ;
+    while (offset + 2UZ * sizeof(std::uint64_t) <= in.size()) {
+        std::uint64_t index  = 0U;
+        std::uint64_t length = 0U;
+        std::memcpy(&index, in.data() + offset, sizeof(index));
+        std::memcpy(&length, in.data() + offset + sizeof(index), sizeof(length));
+        offset += 2UZ * sizeof(std::uint64_t);
+        if (offset + length > in.size()) {
+            throw gr::exception(fmt::format("corrupt tag record: tag length {} exceeds record size {}", length, in.size()));
+        }
+        auto map = pmtv::yaml::deserialize(std::string_view(reinterpret_cast<const char*>(in.data() + offset), length));
+        if (!map) {
+            throw gr::exception(fmt::format("corrupt tag record: failed to parse tag at sample index {}: {}", index, map.error().message));
+        }
+        tags.emplace_back(static_cast<std::size_t>(index), std::move(*map));
+        offset += length;
+    }
+    return tags;
+}
+
+/**
+ * @brief fills in the sample rates of an index rebuilt from the record headers (which do not carry them) using the sample-index
+ * and time-stamp differences to the next chunk; chunks without a valid difference (e.g. the last one) use the nearest estimate
+ */
+inline void estimateSampleRates(std::span<IndexEntry> index) noexcept {
+    for (std::size_t i = 0UZ; i + 1UZ < index.size(); i++) {
+        const IndexEntry& entry = index[i];
+        const IndexEntry& next  = index[i + 1UZ];
+        index[i].sampleRate     = next.sampleIndex > entry.sampleIndex && next.timeNs > entry.timeNs ? static_cast<double>(next.sampleIndex - entry.sampleIndex) * 1e9 / static_cast<double>(next.timeNs - entry.timeNs) : 0.0;
+    }
+    const auto firstValid = std::ranges::find_if(index, [](const IndexEntry& entry) { return entry.sampleRate > 0.0; });
+    double     rate       = firstValid != index.end() ? firstValid->sampleRate : 0.0;
+    for (IndexEntry& entry : index) {
+        if (entry.sampleRate > 0.0) {
+            rate = entry.sampleRate;
+        } else {
+            entry.sampleRate = rate;
+        }
+    }
+}
+
+/**
+ * @brief reads the footer index or -- if absent (e.g. incomplete capture) -- rebuilds it by scanning the record headers
+ */
+[[nodiscard]] inline std::vector<IndexEntry> readIndex(std::istream& is, std::uint64_t fileSize, const FileHeader& header) {
+    std::vector<IndexEntry> index;
+    if (fileSize >= sizeof(FileHeader) + sizeof(RecordHeader) + sizeof(Trailer)) {
+        Trailer trailer;
+        is.seekg(static_cast<std::streamoff>(fileSize - sizeof(Trailer)));
+        RecordHeader record;
+        if (read(is, trailer) && trailer.magic == kTrailerMagic && trailer.indexOffset < fileSize && is.seekg(static_cast<std::streamoff>(trailer.indexOffset)) && read(is, record) && record.type == RecordType::Index && record.payloadSize % sizeof(IndexEntry) == 0U) {
+            index.resize(record.payloadSize / sizeof(IndexEntry));
+            if (is.read(reinterpret_cast<char*>(index.data()), static_cast<std::streamsize>(record.payloadSize))) {
+                return index;
+            }
+            index.clear();
+        }
+        is.clear();
+    }
+
+    // linear scan fall-back
+    std::uint64_t offset      = sizeof(FileHeader);
+    std::uint64_t chunkOffset = offset;
+    bool          pendingTags = false;
+    RecordHeader  record;
+    while (is.seekg(static_cast<std::streamoff>(offset)) && read(is, record)) {
+        const std::uint64_t next = offset + sizeof(RecordHeader) + record.payloadSize;
+        if (next > fileSize || record.type == RecordType::Index) { // truncated record or start of a (broken) footer
+            break;
+        }
+        if (record.type == RecordType::Tags) {
+            chunkOffset = offset;
+            pendingTags = true;
+        } else if (record.type == RecordType::Data) {
+            index.push_back({.sampleIndex = record.sampleIndex, .nSamples = record.payloadSize / header.itemSize, .timeNs = record.timeNs, .fileOffset = pendingTags ? chunkOffset : offset, .sampleRate = 0.0});
+            pendingTags = false;
+        }
+        offset = next;
+    }
+    is.clear();
+    estimateSampleRates(index);
+    return index;
+}
+
+/**
+ * @brief true if the chunk time-stamps are non-decreasing (N.B. may not hold if the time reference was re-synchronised)
+ */
+[[nodiscard]] inline bool isTimeMonotonic(std::span<const IndexEntry> index) noexcept { return std::ranges::is_sorted(index, {}, &IndexEntry::timeNs); }
+
+/**
+ * @brief look-up of the chunk containing the given time-stamp (or the first/last chunk if out of range): O(log n) for
+ * monotonic chunk time-stamps, otherwise a linear scan for the first chunk covering it or, if none, the next chunk in time
+ */
+[[nodiscard]] inline std::size_t findChunkByTime(std::span<const IndexEntry> index, std::int64_t timeNs, bool monotonic) noexcept {
+    if (monotonic) {
+        const auto it = std::ranges::upper_bound(index, timeNs, {}, &IndexEntry::timeNs);
+        return it == index.begin() ? 0UZ : static_cast<std::size_t>(std::distance(index.begin(), it)) - 1UZ;
+    }
+    std::optional<std::size_t> next;
+    std::size_t                latest = 0UZ;
+    for (std::size_t i = 0UZ; i < index.size(); i++) {
+        const IndexEntry& entry    = index[i];
+        const double      duration = entry.sampleRate > 0.0 ? static_cast<double>(entry.nSamples) / entry.sampleRate * 1e9 : 0.0; // [ns]
+        if (entry.timeNs <= timeNs && static_cast<double>(timeNs - entry.timeNs) < duration) {
+            return i;
+        }
+        if (entry.timeNs > timeNs && (!next || entry.timeNs < index[*next].timeNs)) {
+            next = i;
+        }
+        if (entry.timeNs > index[latest].timeNs) {
+            latest = i;
+        }
+    }
+    return next.value_or(latest);
+}
+
+/**
+ * @brief O(log n) look-up of the chunk containing the given sample index (or the first/last chunk if out of range)
+ */
+[[nodiscard]] inline std::size_t findChunkBySample(std::span<const IndexEntry> index, std::uint64_t sampleIndex) noexcept {
+    const auto it = std::ranges::upper_bound(index, sampleIndex, {}, &IndexEntry::sampleIndex);
+    return it == index.begin() ? 0UZ : static_cast<std::size_t>(std::distance(index.begin(), it)) - 1UZ;
+}
+
+} // namespace chunked
+
+template<typename T>
+struct ChunkedFileSink : public gr::Block<ChunkedFileSink<T>> {
+    using Description = Doc<R""(A sink block writing a stream and its tags into a self-describing chunked capture file.
+The samples are stored in fixed-size data chunks, each preceded by the tags it covers, followed by a footer index mapping
+sample indices and time-stamps to file offsets (see 'ChunkedFileSource'). Optionally, each chunk is protected by a CRC-32 checksum.
+The time-stamps are derived from the 'trigger_time' tags (or the start time if none) and the 'sample_rate'.
+Important: this implementation assumes a host-order, CPU architecture specific byte order!)"">;
+    template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
+    using A = gr::Annotated<U, description, Arguments...>; // optional shortening
+
+    PortIn<T> in;
+
+    A<std::string, "file name", Doc<"capture file name">, Visible>                   file_name;
+    A<gr::Size_t, "chunk size", Doc<"number of samples per data chunk">, Visible>    chunk_size  = 65536U;
+    A<bool, "checksum", Doc<"true: store CRC-32 checksum for each chunk">>           checksum    = true;
+    A<float, "sample rate", Doc<"signal sample rate (updated by tags)">, Unit<"Hz">> sample_rate = 1.f;
+
+    GR_MAKE_REFLECTABLE(ChunkedFileSink, in, file_name, chunk_size, checksum, sample_rate);
+
+    std::ofstream                    _file;
+    std::uint64_t                    _fileOffset{0U};
+    std::vector<T>                   _chunk;
+    std::vector<Tag>                 _pendingTags; // tags of the current and not yet written chunk(s), absolute sample indices
+    std::vector<chunked::IndexEntry> _index;
+    std::vector<std::byte>           _tagPayload;
+    std::uint64_t                    _chunkStartIndex{0U};
+    std::uint64_t                    _refSampleIndex{0U}; // time reference: sample index ...
+    std::int64_t                     _refTimeNs{0};       // ... and its UTC time-stamp [ns]
+
+    void start() {
+        if (chunk_size == 0U) {
+            throw gr::exception("chunk_size must be > 0");
+        }
+        detail::ensureDirectoryExists(file_name.value);
+        _file.open(file_name.value, std::ios::binary | std::ios::trunc);
+        if (!_file) {
+            throw gr::exception(fmt::format("failed to open file '{}'.", file_name.value));
+        }
+        chunked::FileHeader header{.itemSize = sizeof(T), .chunkSize = chunk_size.value, .flags = checksum ? chunked::kFlagChecksum : 0U};
+        const auto          typeName = gr::meta::type_name<T>();
+        std::ranges::copy_n(typeName.begin(), static_cast<std::ptrdiff_t>(std::min(typeName.size(), header.typeName.size() - 1UZ)), header.typeName.begin());
+        chunked::write(_file, header);
+        _fileOffset = sizeof(chunked::FileHeader);
+
+        _chunk.clear();
+        _chunk.reserve(chunk_size.value);
+        _pendingTags.clear();
+        _index.clear();
+        _chunkStartIndex = 0U;
+        _refSampleIndex  = 0U;
+        _refTimeNs       = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::system_clock::now().time_since_epoch()).count();
+    }
+
+    void stop() {
+        if (!_file.is_open()) {
+            return;
+        }
+        writeChunk();
+
+        const std::uint64_t indexOffset = _fileOffset;
+        writeRecord(chunked::RecordType::Index, _chunkStartIndex, std::as_bytes(std::span(_index)));
+        chunked::write(_file, chunked::Trailer{.indexOffset = indexOffset});
+        _file.close();
+    }
+
+    [[nodiscard]] work::Status processBulk(InputSpanLike auto& inSpan) {
+        const std::size_t   nSamples    = inSpan.size();
+        const std::uint64_t streamIndex = _chunkStartIndex + _chunk.size();
+        for (const auto& [relIndex, tagMap] : inSpan.tags()) {
+            if (relIndex < 0 || static_cast<std::size_t>(relIndex) >= nSamples) {
+                continue;
+            }
+            property_map map = tagMap;
+            map.erase(std::string(tag::END_OF_STREAM.shortKey())); // stream-control only, re-generated by the reader
+            if (map.empty()) {
+                continue;
+            }
+            const std::uint64_t index = streamIndex + static_cast<std::uint64_t>(relIndex);
+            if (auto it = map.find(std::string(tag::TRIGGER_TIME.shortKey())); it != map.end()) {
+                if (const auto* triggerTime = std::get_if<std::uint64_t>(&it->second)) {
+                    _refSampleIndex = index;
+                    _refTimeNs      = static_cast<std::int64_t>(*triggerTime);
+                }
+            }
+            _pendingTags.emplace_back(static_cast<std::size_t>(index), std::move(map));
+        }
+
+        std::size_t offset = 0UZ;
+        while (offset < nSamples) {
+            const std::size_t nCopy = std::min(nSamples - offset, static_cast<std::size_t>(chunk_size.value) - _chunk.size());
+            _chunk.insert(_chunk.end(), std::next(inSpan.begin(), static_cast<std::ptrdiff_t>(offset)), std::next(inSpan.begin(), static_cast<std::ptrdiff_t>(offset + nCopy)));
+            offset += nCopy;
+            if (_chunk.size() >= chunk_size.value) {
+                writeChunk();
+            }
+        }
+        if (!inSpan.consume(nSamples)) {
+            throw gr::exception("could not consume input samples");
+        }
+        return work::Status::OK;
+    }
+
+private:
+    [[nodiscard]] std::int64_t timeOf(std::uint64_t sampleIndex) const noexcept {
+        const double dt = (static_cast<double>(sampleIndex) - static_cast<double>(_refSampleIndex)) / static_cast<double>(sample_rate.value);
+        return _refTimeNs + static_cast<std::int64_t>(std::llround(dt * 1e9));
+    }
+
+    void writeRecord(chunked::RecordType type, std::uint64_t sampleIndex, std::span<const std::byte> payload) {
+        const chunked::RecordHeader header{.type = type, .checksum = checksum ? chunked::crc32(payload) : 0U, .payloadSize = payload.size(), .sampleIndex = sampleIndex, .timeNs = timeOf(sampleIndex)};
+        chunked::write(_file, header);
+        _file.write(reinterpret_cast<const char*>(payload.data()), static_cast<std::streamsize>(payload.size()));
+        if (!_file) {
+            throw gr::exception(fmt::format("failed to write to file '{}'.", file_name.value));
+        }
+        _fileOffset += sizeof(chunked::RecordHeader) + payload.size();
+    }
+
+    void writeChunk() {
+        if (_chunk.empty()) {
+            return;
+        }
+        const std::uint64_t chunkEnd = _chunkStartIndex + _chunk.size();
+        _index.push_back({.sampleIndex = _chunkStartIndex, .nSamples = _chunk.size(), .timeNs = timeOf(_chunkStartIndex), .fileOffset = _fileOffset, .sampleRate = static_cast<double>(sample_rate.value)});
+
+        const auto chunkTagsEnd = std::ranges::find_if(_pendingTags, [chunkEnd](const Tag& tag) { return static_cast<std::uint64_t>(tag.index) >= chunkEnd; });
+        if (chunkTagsEnd != _pendingTags.begin()) {
+            chunked::serialiseTags(std::span(_pendingTags.begin(), chunkTagsEnd), _tagPayload);
+            writeRecord(chunked::RecordType::Tags, _chunkStartIndex, _tagPayload);
+            _pendingTags.erase(_pendingTags.begin(), chunkTagsEnd);
+        }
+        writeRecord(chunked::RecordType::Data, _chunkStartIndex, std::as_bytes(std::span(_chunk)));
+
+        _chunkStartIndex = chunkEnd;
+        _chunk.clear();
+    }
+};
+
+template<typename T>
+struct ChunkedFileSource : public gr::Block<ChunkedFileSource<T>> {
+    using Description = Doc<R""(A source block replaying a chunked capture file written by 'ChunkedFileSink' including its tags.
+Setting 'seek_time' (UTC [ns]) or 'seek_position' (sample index), e.g. via a settings message, jumps to the corresponding sample
+using the footer index (O(log n) in the number of chunks, linear if the chunk time-stamps are not monotonic). Chunk checksums are verified if present and 'verify_checksum' is enabled.
+Important: this implementation assumes a host-order, CPU architecture specific byte order!)"">;
+    template<typename U, gr::meta::fixed_string description = "", typename... Arguments>
+    using A = gr::Annotated<U, description, Arguments...>; // optional shortening
+
+    PortOut<T> out;
+
+    A<std::string, "file name", Doc<"capture file name">, Visible>                     file_name;
+    A<bool, "verify checksum", Doc<"true: verify chunk checksums (if present)">>       verify_checksum = true;
+    A<std::int64_t, "seek time", Doc<"seek to UTC time-stamp (-1: none)">, Unit<"ns">> seek_time       = -1;
+    A<std::int64_t, "seek position", Doc<"seek to sample index (-1: none)">>           seek_position   = -1;
+
+    GR_MAKE_REFLECTABLE(ChunkedFileSource, out, file_name, verify_checksum, seek_time, seek_position);
+
+    std::ifstream                    _file;
+    chunked::FileHeader              _header;
+    std::vector<chunked::IndexEntry> _index;
+    bool                             _timeMonotonic{true}; // false: time-stamp look-up falls back to a linear scan
+    std::vector<T>                   _chunk;
+    std::vector<Tag>                 _chunkTags;
+    std::vector<std::byte>           _tagPayload;
+    std::uint64_t                    _chunkStartIndex{0U};
+    std::size_t                      _chunkReadPosition{0UZ};
+    std::size_t                      _nextTag{0UZ};
+    std::size_t                      _totalSamplesRead{0UZ};
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
+        if (newSettings.contains("seek_time") && seek_time >= 0) {
+            seekTime(seek_time.value);
+        }
+        if (newSettings.contains("seek_position") && seek_position >= 0) {
+            seekSample(static_cast<std::uint64_t>(seek_position.value));
+        }
+    }
+
+    void start() {
+        _file.open(file_name.value, std::ios::binary);
+        if (!_file) {
+            throw gr::exception(fmt::format("failed to open file '{}'.", file_name.value));
+        }
+        if (!chunked::read(_file, _header) || _header.magic != chunked::kFileMagic) {
+            throw gr::exception(fmt::format("file '{}' is not a chunked capture file.", file_name.value));
+        }
+        if (_header.version != chunked::kVersion || _header.itemSize != sizeof(T)) {
+            throw gr::exception(fmt::format("file '{}': unsupported version {} or item size {} (expected: {} for '{}')", file_name.value, _header.version, _header.itemSize, sizeof(T), gr::meta::type_name<T>()));
+        }
+        _index         = chunked::readIndex(_file, detail::getFileSize(file_name.value), _header);
+        _timeMonotonic = chunked::isTimeMonotonic(_index);
+        _file.seekg(sizeof(chunked::FileHeader));
+        resetChunk();
+        _totalSamplesRead = 0UZ;
+    }
+
+    void stop() {
+        if (_file.is_open()) {
+            _file.close();
+        }
+    }
+
+    [[nodiscard]] work::Status processBulk(OutputSpanLike auto& outSpan) {
+        if (!_file.is_open() || (_chunkReadPosition >= _chunk.size() && !readNextChunk())) {
+            outSpan.publish(0UZ);
+            return work::Status::DONE;
+        }
+
+        const std::size_t   nSamples    = std::min(outSpan.size(), _chunk.size() - _chunkReadPosition);
+        const std::uint64_t streamIndex = _chunkStartIndex + _chunkReadPosition;
+        for (; _nextTag < _chunkTags.size() && static_cast<std::uint64_t>(_chunkTags[_nextTag].index) < streamIndex + nSamples; _nextTag++) {
+            const std::uint64_t tagIndex = std::max(static_cast<std::uint64_t>(_chunkTags[_nextTag].index), streamIndex);
+            outSpan.publishTag(_chunkTags[_nextTag].map, static_cast<std::size_t>(tagIndex - streamIndex));
+        }
+        std::copy_n(std::next(_chunk.begin(), static_cast<std::ptrdiff_t>(_chunkReadPosition)), nSamples, outSpan.begin());
+        outSpan.publish(nSamples);
+        _chunkReadPosition += nSamples;
+        _totalSamplesRead += nSamples;
+        return work::Status::OK;
+    }
+
+    /**
+     * @brief positions the reader at the first sample at or after the given UTC time-stamp [ns]
+     */
+    void seekTime(std::int64_t timeNs) {
+        if (!_file.is_open() || _index.empty()) {
+            return;
+        }
+        const chunked::IndexEntry& entry = _index[chunked::findChunkByTime(_index, timeNs, _timeMonotonic)];
+        const double               dt    = static_cast<double>(timeNs - entry.timeNs) * 1e-9;
+        const auto                 nSkip = entry.sampleRate > 0.0 ? std::llround(std::max(0.0, std::ceil(dt * entry.sampleRate - 1e-6))) : 0LL;
+        seekTo(entry, static_cast<std::uint64_t>(nSkip));
+    }
+
+    /**
+     * @brief positions the reader at the given sample index
+     */
+    void seekSample(std::uint64_t sampleIndex) {
+        if (!_file.is_open() || _index.empty()) {
+            return;
+        }
+        const chunked::IndexEntry& entry = _index[chunked::findChunkBySample(_index, sampleIndex)];
+        seekTo(entry, sampleIndex > entry.sampleIndex ? sampleIndex - entry.sampleIndex : 0U);
+    }
+
+    [[nodiscard]] std::uint64_t position() const noexcept { return _chunkStartIndex + _chunkReadPosition; }
+
+private:
+    void resetChunk() {
+        _chunk.clear();
+        _chunkTags.clear();
+        _chunkReadPosition = 0UZ;
+        _nextTag           = 0UZ;
+    }
+
+    void seekTo(const chunked::IndexEntry& entry, std::uint64_t nSkip) {
+        _file.clear();
+        _file.seekg(static_cast<std::streamoff>(entry.fileOffset));
+        resetChunk();
+        if (!readNextChunk()) {
+            return;
+        }
+        _chunkReadPosition              = static_cast<std::size_t>(std::min<std::uint64_t>(nSkip, _chunk.size()));
+        const std::uint64_t streamIndex = _chunkStartIndex + _chunkReadPosition;
+        while (_nextTag < _chunkTags.size() && static_cast<std::uint64_t>(_chunkTags[_nextTag].index) < streamIndex) {
+            _nextTag++;
+        }
+    }
+
+    template<typename TContainer>
+    void readPayload(const chunked::RecordHeader& record, TContainer& container) {
+        using value_type = typename TContainer::value_type;
+        if (record.payloadSize % sizeof(value_type) != 0U) {
+            throw gr::exception(fmt::format("file '{}': corrupt record at sample index {} (payload size {})", file_name.value, record.sampleIndex, record.payloadSize));
+        }
+        container.resize(record.payloadSize / sizeof(value_type));
+        if (!_file.read(reinterpret_cast<char*>(container.data()), static_cast<std::streamsize>(record.payloadSize))) {
+            container.clear(); // truncated (e.g. incomplete capture)
+            return;
+        }
+        if (verify_checksum && (_header.flags & chunked::kFlagChecksum) != 0U && chunked::crc32(std::as_bytes(std::span(container))) != record.checksum) {
+            throw gr::exception(fmt::format("file '{}': checksum mismatch in record at sample index {}", file_name.value, record.sampleIndex));
+        }
+    }
+
+    [[nodiscard]] bool readNextChunk() {
+        resetChunk();
+        chunked::RecordHeader record;
+        while (chunked::read(_file, record)) {
+            switch (record.type) {
+            case chunked::RecordType::Tags: {
+                readPayload(record, _tagPayload);
+                _chunkTags = chunked::deserialiseTags(_tagPayload);
+            } break;
+            case chunked::RecordType::Data: {
+                readPayload(record, _chunk);
+                _chunkStartIndex = record.sampleIndex;
+                return !_chunk.empty();
+            }
+            case chunked::RecordType::Index: return false;
+            default: throw gr::exception(fmt::format("file '{}': unknown record type {}", file_name.value, static_cast<std::uint32_t>(record.type)));
+            }
+        }
+        return false;
+    }
+};
+
+} // namespace gr::blocks::fileio
+
+const inline auto registerChunkedFileIo = gr::registerBlock<gr::blocks::fileio::ChunkedFileSink, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry()) //
+                                          | gr::registerBlock<gr::blocks::fileio::ChunkedFileSource, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>>(gr::globalBlockRegistry());
+
+#endif // CHUNKEDFILEIO_HPP
@@ -0,0 +1,390 @@
+#ifndef FILEIO_COMPRESSION_HPP
+#define FILEIO_COMPRESSION_HPP
+
+#include <gnuradio-4.0/Message.hpp>
+#include <gnuradio-4.0/meta/utils.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <array>
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace gr::blocks::fileio::compression {
+
+/**
+ * Lossless frame-based compression for binary sample streams.
+ *
+ * A compressed file is a sequence of independent frames, each consisting of a 'FrameHeader' followed by the payload:
+ *  - 'delta_bitpack': (integral types) zig-zag encoded first-order differences, bit-packed in blocks of 'kBlockSize' values,
+ *                     each block preceded by its bit-width (i.e. n-bit ADC data costs at most n+1 bits/sample)
+ *  - 'shuffle_lz':    (any type) XOR with the previous sample, byte-shuffled into byte-planes (sign/exponent/upper mantissa
+ *                     bytes of slowly varying floats become long zero runs), followed by a byte-oriented LZ77 (LZ4-like) stage
+ *  - 'none':          stored payload, used as fall-back if a frame does not compress
+ * All fields are stored in host byte-order.
+ */
+enum class Codec : std::uint8_t { none = 0U, delta_bitpack = 1U, shuffle_lz = 2U };
+
+inline constexpr std::array<char, 4> kFrameMagic = {'G', 'R', '4', 'Z'};
+inline constexpr std::size_t         kBlockSize  = 128UZ; // number of values per bit-packed block
+
+struct FrameHeader {
+    std::array<char, 4> magic = kFrameMagic;
+    Codec               codec{Codec::none};
+    std::uint8_t        itemSize{0U};
+    std::uint16_t       reserved{0U};
+    std::uint32_t       rawSize{0U};        // uncompressed size [bytes]
+    std::uint32_t       compressedSize{0U}; // payload size [bytes]
+};
+static_assert(sizeof(FrameHeader) == 16UZ && std::is_trivially_copyable_v<FrameHeader>);
+
+/**
+ * @brief parses the codec name: "none", "auto" (-> best suited codec for T), "delta_bitpack" or "shuffle_lz"
+ */
+template<typename T>
+[[nodiscard]] std::optional<Codec> parseCodec(std::string_view name) noexcept {
+    if (name.empty() || name == "none") {
+        return Codec::none;
+    } else if (name == "auto") {
+        return std::is_integral_v<T> ? Codec::delta_bitpack : Codec::shuffle_lz;
+    } else if (name == "delta_bitpack") {
+        return std::is_integral_v<T> ? std::optional(Codec::delta_bitpack) : std::nullopt;
+    } else if (name == "shuffle_lz") {
+        return Codec::shuffle_lz;
+    }
+    return std::nullopt;
+}
+
+namespace detail {
+
+template<std::size_t N>
+using unsigned_of_size = std::conditional_t<N == 1UZ, std::uint8_t, std::conditional_t<N == 2UZ, std::uint16_t, std::conditional_t<N == 4UZ, std::uint32_t, std::uint64_t>>>;
+
+template<std::unsigned_integral U>
+[[nodiscard]] constexpr U zigZagEncode(U delta) noexcept {
+    return static_cast<U>(static_cast<U>(delta << 1U) ^ static_cast<U>(0U - static_cast<U>(delta >> (sizeof(U) * 8U - 1U))));
+}
+
+template<std::unsigned_integral U>
+[[nodiscard]] constexpr U zigZagDecode(U value) noexcept {
+    return static_cast<U>(static_cast<U>(value >> 1U) ^ static_cast<U>(0U - static_cast<U>(value & 1U)));
+}
+
+template<std::unsigned_integral U>
+void encodeDeltaBitpack(std::span<const U> in, std::vector<std::byte>& out) {
+    std::array<U, kBlockSize> block{};
+    U                         previous = 0U;
+    for (std::size_t start = 0UZ; start < in.size(); start += kBlockSize) {
+        const std::size_t n        = std::min(kBlockSize, in.size() - start);
+        U                 maxValue = 0U;
+        for (std::size_t i = 0UZ; i < n; i++) {
+            block[i] = zigZagEncode(static_cast<U>(in[start + i] - previous)); // modulo-2^n difference -> no overflow
+            previous = in[start + i];
+            maxValue |= block[i];
+        }
+        const auto        width  = static_cast<std::uint8_t>(std::bit_width(maxValue));
+        const std::size_t offset = out.size();
+        out.resize(offset + 1UZ + (n * width + 7UZ) / 8UZ);
+        out[offset]          = static_cast<std::byte>(width);
+        std::byte*    dst    = out.data() + offset + 1UZ;
+        std::uint64_t acc    = 0U;
+        std::size_t   nBits  = 0UZ;
+        const auto    append = [&](std::uint64_t value, std::size_t nValueBits) { // nValueBits <= 32
+            acc |= value << nBits;
+            nBits += nValueBits;
+            for (; nBits >= 8UZ; nBits -= 8UZ, acc >>= 8U) {
+                *dst++ = static_cast<std::byte>(acc & 0xFFU);
+            }
+        };
+        for (std::size_t i = 0UZ; width != 0U && i < n; i++) {
+            const auto value = static_cast<std::uint64_t>(block[i]);
+            if (width > 32U) {
+                append(value & 0xFFFF'FFFFU, 32UZ);
+                append(value >> 32U, width - 32UZ);
+            } else {
+                append(value, width);
+            }
+        }
+        if (nBits > 0UZ) {
+            *dst = static_cast<std::byte>(acc & 0xFFU);
+        }
+    }
+}
+
+template<std::unsigned_integral U>
+void decodeDeltaBitpack(std::span<const std::byte> in, std::span<U> out) {
+    std::size_t pos      = 0UZ;
+    U           previous = 0U;
+    for (std::size_t start = 0UZ; start < out.size(); start += kBlockSize) {
+        const std::size_t n = std::min(kBlockSize, out.size() - start);
+        if (pos >= in.size()) {
+            throw gr::exception("corrupt delta_bitpack frame: truncated block header");
+        }
+        const auto width = static_cast<std::size_t>(in[pos++]);
+        if (width > sizeof(U) * 8UZ || pos + (n * width + 7UZ) / 8UZ > in.size()) {
+            throw gr::exception(fmt::format("corrupt delta_bitpack frame: invalid bit-width {} or truncated block", width));
+        }
+        std::uint64_t acc   = 0U;
+        std::size_t   nBits = 0UZ;
+        const auto    take  = [&](std::size_t nValueBits) -> std::uint64_t { // nValueBits <= 32
+            for (; nBits < nValueBits; nBits += 8UZ) {
+                acc |= static_cast<std::uint64_t>(in[pos++]) << nBits;
+            }
+            const std::uint64_t value = acc & ((std::uint64_t{1} << nValueBits) - 1U);
+            acc >>= nValueBits;
+            nBits -= nValueBits;
+            return value;
+        };
+        for (std::size_t i = 0UZ; i < n; i++) {
+            std::uint64_t value = 0U;
+            if (width > 32UZ) {
+                value = take(32UZ);
+                value |= take(width - 32UZ) << 32U;
+            } else if (width > 0UZ) {
+                value = take(width);
+            }
+            previous       = static_cast<U>(previous + zigZagDecode(static_cast<U>(value)));
+            out[start + i] = previous;
+        }
+    }
+    if (pos != in.size()) {
+        throw gr::exception(fmt::format("corrupt delta_bitpack frame: {} trailing bytes", in.size() - pos));
+    }
+}
+
+/**
+ * @brief XOR with the previous item and transposition into 'itemSize' byte-planes
+ */
+inline void xorShuffle(std::span<const std::byte> in, std::size_t itemSize, std::span<std::byte> out) noexcept {
+    const std::size_t nItems = in.size() / itemSize;
+    for (std::size_t k = 0UZ; k < itemSize; k++) {
+        std::byte* plane = out.data() + k * nItems;
+        std::byte  prev{0};
+        for (std::size_t i = 0UZ; i < nItems; i++) {
+            const std::byte current = in[i * itemSize + k];
+            plane[i]                = current ^ prev;
+            prev                    = current;
+        }
+    }
+}
+
+inline void xorUnshuffle(std::span<const std::byte> in, std::size_t itemSize, std::span<std::byte> out) noexcept {
+    const std::size_t nItems = in.size() / itemSize;
+    for (std::size_t k = 0UZ; k < itemSize; k++) {
+        const std::byte* plane = in.data() + k * nItems;
+        std::byte        prev{0};
+        for (std::size_t i = 0UZ; i < nItems; i++) {
+            prev                  = plane[i] ^ prev;
+            out[i * itemSize + k] = prev;
+        }
+    }
+}
+
+inline constexpr std::size_t kMinMatch  = 4UZ;
+inline constexpr std::size_t kMaxOffset = 65535UZ;
+inline constexpr unsigned    kHashLog   = 14U;
+inline constexpr std::size_t kMaxSkip   = 32UZ;
+
+inline void appendLength(std::vector<std::byte>& out, std::size_t length) { // LZ4-style length extension (after the 4-bit token field)
+    for (; length >= 255UZ; length -= 255UZ) {
+        out.push_back(std::byte{255});
+    }
+    out.push_back(static_cast<std::byte>(length));
+}
+
+inline void appendSequence(std::vector<std::byte>& out, std::span<const std::byte> literals, std::size_t offset, std::size_t matchLength) {
+    const std::size_t litToken   = std::min(literals.size(), 15UZ);
+    const std::size_t matchToken = matchLength == 0UZ ? 0UZ : std::min(matchLength - kMinMatch, 15UZ);
+    out.push_back(static_cast<std::byte>((litToken << 4U) | matchToken));
+    if (litToken == 15UZ) {
+        appendLength(out, literals.size() - 15UZ);
+    }
+    out.insert(out.end(), literals.begin(), literals.end());
+    if (matchLength == 0UZ) { // last sequence: literals only
+        return;
+    }
+    out.push_back(static_cast<std::byte>(offset & 0xFFU));
+    out.push_back(static_cast<std::byte>(offset >> 8U));
+    if (matchToken == 15UZ) {
+        appendLength(out, matchLength - kMinMatch - 15UZ);
+    }
+}
+
+/**
+ * @brief greedy single-pass LZ77 compressor using an LZ4-like sequence format: [token][literal length][literals][offset][match length]
+ */
+inline void lzCompress(std::span<const std::byte> in, std::vector<std::byte>& out) {
+    thread_local std::vector<std::uint32_t> hashTable; // position + 1 of the last occurrence of a 4-byte sequence (0: none)
+    hashTable.assign(1UZ << kHashLog, 0U);
+
+    const std::byte*  base   = in.data();
+    const std::size_t size   = in.size();
+    std::size_t       anchor = 0UZ;
+    std::size_t       pos    = 0UZ;
+    while (pos + kMinMatch <= size) {
+        std::uint32_t sequence;
+        std::memcpy(&sequence, base + pos, sizeof(sequence));
+        const std::uint32_t hash      = (sequence * 2654435761U) >> (32U - kHashLog);
+        const std::size_t   candidate = hashTable[hash];
+        hashTable[hash]               = static_cast<std::uint32_t>(pos + 1UZ);
+
+        if (candidate == 0UZ || pos - (candidate - 1UZ) > kMaxOffset || std::memcmp(base + candidate - 1UZ, base + pos, kMinMatch) != 0) {
+            pos += 1UZ + std::min((pos - anchor) >> 6U, kMaxSkip); // skip faster through incompressible data
+            continue;
+        }
+        const std::size_t reference = candidate - 1UZ;
+        std::size_t       length    = kMinMatch;
+        while (pos + length < size && base[reference + length] == base[pos + length]) {
+            length++;
+        }
+        appendSequence(out, in.subspan(anchor, pos - anchor), pos - reference, length);
+        pos += length;
+        anchor = pos;
+    }
+    appendSequence(out, in.subspan(anchor), 0UZ, 0UZ);
+}
+
+inline void lzDecompress(std::span<const std::byte> in, std::span<std::byte> out) {
+    std::size_t ip         = 0UZ;
+    std::size_t op         = 0UZ;
+    const auto  readLength = [&](std::size_t length) {
+        if (length != 15UZ) {
+            return length;
+        }
+        for (std::byte b{255}; b == std::byte{255};) {
+            if (ip >= in.size()) {
+                throw gr::exception("corrupt shuffle_lz frame: truncated length");
+            }
+            b = in[ip++];
+            length += static_cast<std::size_t>(b);
+        }
+        return length;
+    };
+
+    while (ip < in.size()) {
+        const auto        token     = static_cast<std::size_t>(in[ip++]);
+        const std::size_t nLiterals = readLength(token >> 4U);
+        if (ip + nLiterals > in.size() || op + nLiterals > out.size()) {
+            throw gr::exception("corrupt shuffle_lz frame: literals out of range");
+        }
+        std::memcpy(out.data() + op, in.data() + ip, nLiterals);
+        ip += nLiterals;
+        op += nLiterals;
+        if (ip == in.size()) { // last sequence
+            break;
+        }
+
+        if (ip + 2UZ > in.size()) {
+            throw gr::exception("corrupt shuffle_lz frame: truncated match offset");
+        }
+        const std::size_t offset = static_cast<std::size_t>(in[ip]) | (static_cast<std::size_t>(in[ip + 1UZ]) << 8U);
+        ip += 2UZ;
+        const std::size_t matchLength = readLength(token & 0xFU) + kMinMatch;
+        if (offset == 0UZ || offset > op || op + matchLength > out.size()) {
+            throw gr::exception("corrupt shuffle_lz frame: match out of range");
+        }
+        if (offset >= matchLength) {
+            std::memcpy(out.data() + op, out.data() + op - offset, matchLength);
+            op += matchLength;
+        } else {
+            for (std::size_t i = 0UZ; i < matchLength; i++, op++) { // N.B. source and destination overlap (run-length)
+                out[op] = out[op - offset];
+            }
+        }
+    }
+    if (op != out.size()) {
+        throw gr::exception(fmt::format("corrupt shuffle_lz frame: decoded {} of {} bytes", op, out.size()));
+    }
+}
+
+} // namespace detail
+
+/**
+ * @brief compresses 'samples' into a single self-contained frame (header + payload), falls back to 'Codec::none' if the data does not compress
+ */
+template<typename T>
+requires std::is_trivially_copyable_v<T>
+[[nodiscard]] std::vector<std::byte> compressFrame(std::span<const T> samples, Codec codec) {
+    static_assert(sizeof(T) <= 255UZ);
+    const auto rawBytes = std::as_bytes(samples);
+    if (rawBytes.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw gr::exception(fmt::format("compression frame size {} exceeds 4 GiB", rawBytes.size()));
+    }
+
+    std::vector<std::byte> frame(sizeof(FrameHeader));
+    frame.reserve(sizeof(FrameHeader) + rawBytes.size() + rawBytes.size() / 255UZ + 16UZ);
+    switch (codec) {
+    case Codec::delta_bitpack: {
+        if constexpr (std::is_integral_v<T>) {
+            using U = detail::unsigned_of_size<sizeof(T)>;
+            detail::encodeDeltaBitpack<U>(std::span(reinterpret_cast<const U*>(samples.data()), samples.size()), frame);
+        } else {
+            throw gr::exception(fmt::format("delta_bitpack codec is not supported for non-integral type '{}'", gr::meta::type_name<T>()));
+        }
+    } break;
+    case Codec::shuffle_lz: {
+        thread_local std::vector<std::byte> shuffled;
+        shuffled.resize(rawBytes.size());
+        detail::xorShuffle(rawBytes, sizeof(T), shuffled);
+        detail::lzCompress(shuffled, frame);
+    } break;
+    case Codec::none: break;
+    }
+
+    if (codec == Codec::none || frame.size() - sizeof(FrameHeader) >= rawBytes.size()) { // store uncompressed
+        codec = Codec::none;
+        frame.resize(sizeof(FrameHeader));
+        frame.insert(frame.end(), rawBytes.begin(), rawBytes.end());
+    }
+    const FrameHeader header{.codec = codec, .itemSize = static_cast<std::uint8_t>(sizeof(T)), .rawSize = static_cast<std::uint32_t>(rawBytes.size()), .compressedSize = static_cast<std::uint32_t>(frame.size() - sizeof(FrameHeader))};
+    std::memcpy(frame.data(), &header, sizeof(header));
+    return frame;
+}
+
+/**
+ * @brief decompresses a frame payload into 'out' (size: 'header.rawSize')
+ */
+inline void decompressFrame(const FrameHeader& header, std::span<const std::byte> payload, std::span<std::byte> out) {
+    if (header.magic != kFrameMagic || payload.size() != header.compressedSize || out.size() != header.rawSize || header.itemSize == 0U || header.rawSize % header.itemSize != 0U) {
+        throw gr::exception(fmt::format("corrupt compressed frame (raw size: {}, compressed size: {}, item size: {})", header.rawSize, header.compressedSize, header.itemSize));
+    }
+    switch (header.codec) {
+    case Codec::none: {
+        if (payload.size() != out.size()) {
+            throw gr::exception("corrupt stored frame: size mismatch");
+        }
+        std::ranges::copy(payload, out.begin());
+    } break;
+    case Codec::delta_bitpack: {
+        const auto decode = [&]<std::unsigned_integral U>(U) { detail::decodeDeltaBitpack<U>(payload, std::span(reinterpret_cast<U*>(out.data()), out.size() / sizeof(U))); };
+        switch (header.itemSize) {
+        case 1U: decode(std::uint8_t{}); break;
+        case 2U: decode(std::uint16_t{}); break;
+        case 4U: decode(std::uint32_t{}); break;
+        case 8U: decode(std::uint64_t{}); break;
+        default: throw gr::exception(fmt::format("corrupt delta_bitpack frame: unsupported item size {}", header.itemSize));
+        }
+    } break;
+    case Codec::shuffle_lz: {
+        thread_local std::vector<std::byte> shuffled;
+        shuffled.resize(out.size());
+        detail::lzDecompress(payload, shuffled);
+        detail::xorUnshuffle(shuffled, header.itemSize, out);
+    } break;
+    default: throw gr::exception(fmt::format("unknown compression codec {}", static_cast<int>(header.codec)));
+    }
+}
+
+} // namespace gr::blocks::fileio::compression
+
+#endif // FILEIO_COMPRESSION_HPP
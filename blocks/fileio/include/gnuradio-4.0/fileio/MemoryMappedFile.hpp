@@ -0,0 +1,135 @@
+#ifndef MEMORYMAPPEDFILE_HPP
+#define MEMORYMAPPEDFILE_HPP
+
+#include <gnuradio-4.0/Message.hpp>
+
+#include <fmt/format.h>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <cstring>
+#include <span>
+#include <string>
+#include <tuple>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace gr::blocks::fileio::detail {
+
+/**
+ * @brief Read-only memory-mapped file with sequential access hints and a sliding read-ahead window.
+ *
+ * The mapping is advised as `MADV_SEQUENTIAL` and the first `kReadAhead` bytes as `MADV_WILLNEED` upon construction, so that
+ * the kernel starts paging-in asynchronously (e.g. when prefetching the next file on a background thread).
+ * `advance(position)` keeps the `MADV_WILLNEED` window ahead of the reader.
+ */
+class MemoryMappedFile {
+    int              _fd   = -1;
+    const std::byte* _data = nullptr;
+    std::size_t      _size{0UZ};
+    std::size_t      _advisedEnd{0UZ}; // end of the range already advised as MADV_WILLNEED
+    std::string      _fileName;
+
+public:
+    static constexpr std::size_t kReadAhead = 16UZ << 20UZ; // 16 MiB
+
+    MemoryMappedFile() = default;
+
+    explicit MemoryMappedFile(std::string fileName) : _fileName(std::move(fileName)) {
+        _fd = ::open(_fileName.c_str(), O_RDONLY | O_CLOEXEC);
+        if (_fd < 0) {
+            throw gr::exception(fmt::format("failed to open file '{}': {}", _fileName, std::strerror(errno)));
+        }
+        struct stat fileStat{};
+        if (::fstat(_fd, &fileStat) != 0) {
+            const int error = errno;
+            ::close(std::exchange(_fd, -1));
+            throw gr::exception(fmt::format("failed to stat file '{}': {}", _fileName, std::strerror(error)));
+        }
+        _size = static_cast<std::size_t>(fileStat.st_size);
+        if (_size == 0UZ) { // zero-sized files cannot be mapped
+            return;
+        }
+
+        void* addr = ::mmap(nullptr, _size, PROT_READ, MAP_PRIVATE, _fd, 0);
+        if (addr == MAP_FAILED) {
+            const int error = errno;
+            ::close(std::exchange(_fd, -1));
+            throw gr::exception(fmt::format("failed to mmap file '{}': {}", _fileName, std::strerror(error)));
+        }
+        _data       = static_cast<const std::byte*>(addr);
+        std::ignore = ::madvise(addr, _size, MADV_SEQUENTIAL);
+        advance(0UZ);
+    }
+
+    MemoryMappedFile(const MemoryMappedFile&)            = delete;
+    MemoryMappedFile& operator=(const MemoryMappedFile&) = delete;
+
+    MemoryMappedFile(MemoryMappedFile&& other) noexcept : _fd(std::exchange(other._fd, -1)), _data(std::exchange(other._data, nullptr)), _size(std::exchange(other._size, 0UZ)), _advisedEnd(std::exchange(other._advisedEnd, 0UZ)), _fileName(std::move(other._fileName)) {}
+
+    MemoryMappedFile& operator=(MemoryMappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            _fd         = std::exchange(other._fd, -1);
+            _data       = std::exchange(other._data, nullptr);
+            _size       = std::exchange(other._size, 0UZ);
+            _advisedEnd = std::exchange(other._advisedEnd, 0UZ);
+            _fileName   = std::move(other._fileName);
+        }
+        return *this;
+    }
+
+    ~MemoryMappedFile() { unmap(); }
+
+    [[nodiscard]] bool                       isOpen() const noexcept { return _fd >= 0; }
+    [[nodiscard]] std::size_t                size() const noexcept { return _size; }
+    [[nodiscard]] const std::string&         fileName() const noexcept { return _fileName; }
+    [[nodiscard]] std::span<const std::byte> data() const noexcept { return {_data, _data == nullptr ? 0UZ : _size}; }
+
+    /**
+     * @brief notifies the current read position: keeps the MADV_WILLNEED window at least `kReadAhead / 2` bytes ahead.
+     */
+    void advance(std::size_t position) noexcept {
+        if (_data == nullptr || position + kReadAhead / 2UZ < _advisedEnd || _advisedEnd >= _size) {
+            return;
+        }
+        const std::size_t pageSize = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+        const std::size_t begin    = std::max(position, _advisedEnd) / pageSize * pageSize;
+        const std::size_t end      = std::min(_size, position + kReadAhead);
+        if (end > begin) {
+            std::ignore = ::madvise(const_cast<std::byte*>(_data) + begin, end - begin, MADV_WILLNEED);
+        }
+        _advisedEnd = end;
+    }
+
+    /**
+     * @brief resets the read-ahead window, e.g. after a random-access seek.
+     */
+    void seek(std::size_t position) noexcept {
+        _advisedEnd = 0UZ;
+        advance(position);
+    }
+
+private:
+    void unmap() noexcept {
+        if (_data != nullptr) {
+            ::munmap(const_cast<std::byte*>(_data), _size);
+            _data = nullptr;
+        }
+        if (_fd >= 0) {
+            ::close(_fd);
+            _fd = -1;
+        }
+        _size       = 0UZ;
+        _advisedEnd = 0UZ;
+    }
+};
+
+} // namespace gr::blocks::fileio::detail
+
+#endif // MEMORYMAPPEDFILE_HPP
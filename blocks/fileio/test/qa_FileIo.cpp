@@ -1,12 +1,17 @@
 #include <boost/ut.hpp>
 
 #include <gnuradio-4.0/fileio/BasicFileIo.hpp>
+#include <gnuradio-4.0/fileio/ChunkedFileIo.hpp>
 
 #include <gnuradio-4.0/Scheduler.hpp>
 #include <gnuradio-4.0/testing/NullSources.hpp>
+#include <gnuradio-4.0/testing/TagMonitors.hpp>
 
 #include <fmt/format.h>
 
+#include <cstring>
+#include <numeric>
+
 namespace {
 using namespace std::chrono_literals;
 template<typename Scheduler>
@@ -31,7 +36,7 @@ auto createWatchdog(Scheduler& sched, std::chrono::seconds timeOut = 2s, std::ch
 }
 
 template<typename DataType>
-void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thread_pool::BasicThreadPool>& threadPool) {
+void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thread_pool::BasicThreadPool>& threadPool, bool asyncIo = false, std::string compression = "none") {
     using namespace boost::ut;
     using namespace gr::blocks::fileio;
     using namespace gr::testing;
@@ -44,11 +49,12 @@ void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thre
     gr::blocks::fileio::detail::deleteFilesContaining(fileName);
 
     "BasicFileSink"_test = [&] { // NOSONAR capture all
-        std::string testCaseName = fmt::format("BasicFileSink: failed for type '{}' and '{}", gr::meta::type_name<DataType>(), modeName);
+        std::string testCaseName = fmt::format("BasicFileSink: failed for type '{}' and '{}' (async: {}, compression: {})", gr::meta::type_name<DataType>(), modeName, asyncIo, compression);
         gr::Graph   flow;
 
         auto& source   = flow.emplaceBlock<ConstantSource<DataType>>({{"n_samples_max", nSamples}});
-        auto& fileSink = flow.emplaceBlock<BasicFileSink<DataType>>({{"file_name", fileName}, {"mode", modeName}, {"max_bytes_per_file", maxFileSize}});
+        // N.B. small async staging buffers to exercise buffer hand-over and back-pressure
+        auto& fileSink = flow.emplaceBlock<BasicFileSink<DataType>>({{"file_name", fileName}, {"mode", modeName}, {"max_bytes_per_file", maxFileSize}, {"async_io", asyncIo}, {"queue_depth", gr::Size_t(2U)}, {"buffer_size", gr::Size_t(4096U)}, {"compression", compression}});
         expect(eq(gr::ConnectionResult::SUCCESS, flow.template connect<"out">(source).template to<"in">(fileSink)));
 
         auto sched                                        = scheduler{std::move(flow), threadPool};
@@ -74,6 +80,8 @@ void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thre
             if (mode == gr::blocks::fileio::Mode::multi) {
                 // less-equal 'le' because files can be legitimally zero-sized
                 expect(le(fileSize, maxFileSize)) << testCaseName;
+            } else if (compression != "none") {
+                expect(lt(fileSize, nSamples * sizeof(DataType))) << testCaseName;
             } else {
                 expect(eq(fileSize, nSamples * sizeof(DataType))) << testCaseName;
             }
@@ -81,10 +89,10 @@ void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thre
     };
 
     // N.B. test directory contains the output files from the previous sink test
-    "BasicFileSource"_test = [&] { // NOSONAR capture all
-        std::string testCaseName = fmt::format("BasicFileSource: failed for type '{}' and '{}", gr::meta::type_name<DataType>(), modeName);
+    "BasicFileSource"_test = [&](bool memoryMapped) { // NOSONAR capture all
+        std::string testCaseName = fmt::format("BasicFileSource: failed for type '{}' and '{}' (memory-mapped: {}, compression: {})", gr::meta::type_name<DataType>(), modeName, memoryMapped, compression);
         gr::Graph   flow;
-        auto&       fileSource = flow.emplaceBlock<BasicFileSource<DataType>>({{"file_name", fileName}, {"mode", modeName}});
+        auto&       fileSource = flow.emplaceBlock<BasicFileSource<DataType>>({{"file_name", fileName}, {"mode", modeName}, {"memory_mapped", memoryMapped}, {"compressed", compression != "none"}});
         auto&       sink       = flow.emplaceBlock<CountingSink<DataType>>();
 
         expect(eq(gr::ConnectionResult::SUCCESS, flow.template connect<"out">(fileSource).template to<"in">(sink)));
@@ -99,7 +107,7 @@ void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thre
         expect(!externalInterventionNeededRead->load(std::memory_order_relaxed)) << testCaseName;
         expect(eq(sink.count, nSamples)) << testCaseName;
         expect(eq(fileSource._totalBytesRead, nSamples * sizeof(DataType))) << testCaseName;
-    };
+    } | std::vector{false, true};
 
     // Test for `offset` and `length` parameters
     "BasicFileSource with offset and length"_test = [&] { // NOSONAR capture all
@@ -107,7 +115,7 @@ void runTest(const gr::blocks::fileio::Mode mode, const std::shared_ptr<gr::thre
         constexpr gr::Size_t lengthSamples = 8U;
         std::string          testCaseName  = fmt::format("BasicFileSource with offset and length: failed for type '{}' and '{}", gr::meta::type_name<DataType>(), modeName);
         gr::Graph            flow;
-        auto&                fileSource = flow.emplaceBlock<BasicFileSource<DataType>>({{"file_name", fileName}, {"mode", modeName}, {"offset", offsetSamples}, {"length", lengthSamples}});
+        auto&                fileSource = flow.emplaceBlock<BasicFileSource<DataType>>({{"file_name", fileName}, {"mode", modeName}, {"offset", offsetSamples}, {"length", lengthSamples}, {"compressed", compression != "none"}});
         auto&                sink       = flow.emplaceBlock<CountingSink<DataType>>();
 
         expect(eq(gr::ConnectionResult::SUCCESS, flow.template connect<"out">(fileSource).template to<"in">(sink)));
@@ -146,6 +154,241 @@ const boost::ut::suite<"basic file IO tests"> basicFileIOTests = [] {
     "append mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(append, threadPool); } | kArithmeticTypes;
 
     "create new mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(multi, threadPool); } | kArithmeticTypes;
+
+    "memory-mapped seek"_test = [] {
+        using namespace gr::blocks::fileio;
+        const std::string fileName = "/tmp/gr4_file_sink_test/TestFileName_seek.bin";
+        detail::ensureDirectoryExists(fileName);
+        std::vector<float> data(1024);
+        std::iota(data.begin(), data.end(), 0.f);
+        {
+            std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(float)));
+        }
+
+        BasicFileSource<float> fileSource({{"file_name", fileName}, {"memory_mapped", true}});
+        fileSource.init(fileSource.progress, fileSource.ioThreadPool);
+        fileSource.start();
+        expect(eq(fileSource._mappedFile.size(), data.size() * sizeof(float)));
+        expect(eq(fileSource._readPosition, 0UZ));
+
+        fileSource.seek(512UZ);
+        expect(eq(fileSource._readPosition, 512UZ * sizeof(float)));
+        const auto mapped = fileSource._mappedFile.data();
+        expect(eq(*reinterpret_cast<const float*>(mapped.data() + fileSource._readPosition), 512.f));
+
+        fileSource.seek(4096UZ); // beyond end of file -> clamped
+        expect(eq(fileSource._readPosition, data.size() * sizeof(float)));
+        fileSource.stop();
+        expect(!fileSource._mappedFile.isOpen());
+
+        for (bool memoryMapped : {false, true}) { // 'seek_position' set before the file is opened, i.e. via the initial settings
+            BasicFileSource<float> seekSource({{"file_name", fileName}, {"memory_mapped", memoryMapped}, {"seek_position", std::int64_t(300)}});
+            seekSource.init(seekSource.progress, seekSource.ioThreadPool);
+            seekSource.start();
+            const auto readPosition = [&seekSource, memoryMapped] { return memoryMapped ? seekSource._readPosition : static_cast<std::size_t>(std::streamoff(seekSource._file.tellg())); };
+            expect(eq(readPosition(), 300UZ * sizeof(float))) << fmt::format("initial seek_position, memory-mapped: {}", memoryMapped);
+
+            expect(seekSource.settings().set({{"seek_position", std::int64_t(700)}}).empty());
+            expect(seekSource.settings().activateContext() != std::nullopt);
+            std::ignore = seekSource.settings().applyStagedParameters();
+            expect(eq(readPosition(), 700UZ * sizeof(float))) << fmt::format("seek_position via settings, memory-mapped: {}", memoryMapped);
+            seekSource.stop();
+        }
+
+        expect(!detail::deleteFilesContaining(fileName).empty());
+    };
+
+    "raw file starting with the compression frame magic"_test = [&threadPool] {
+        using namespace gr::blocks::fileio;
+        using namespace gr::testing;
+        const std::string         fileName = "/tmp/gr4_file_sink_test/TestFileName_raw_magic.bin";
+        std::vector<std::int32_t> data(256);
+        std::iota(data.begin(), data.end(), 0);
+        std::memcpy(data.data(), compression::kFrameMagic.data(), sizeof(std::int32_t)); // N.B. must not be mistaken for a compressed frame
+        detail::ensureDirectoryExists(fileName);
+        {
+            std::ofstream file(fileName, std::ios::binary | std::ios::trunc);
+            file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size() * sizeof(std::int32_t)));
+        }
+
+        for (bool memoryMapped : {false, true}) {
+            gr::Graph flow;
+            auto&     fileSource = flow.emplaceBlock<BasicFileSource<std::int32_t>>({{"file_name", fileName}, {"memory_mapped", memoryMapped}});
+            auto&     sink       = flow.emplaceBlock<TagSink<std::int32_t, ProcessFunction::USE_PROCESS_BULK>>({{"log_samples", true}, {"log_tags", false}});
+            expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(fileSource).template to<"in">(sink)));
+
+            auto sched = gr::scheduler::Simple<>{std::move(flow), threadPool};
+            expect(sched.runAndWait().has_value());
+            expect(std::ranges::equal(sink._samples, data)) << fmt::format("memory-mapped: {}", memoryMapped);
+        }
+
+        expect(!detail::deleteFilesContaining(fileName).empty());
+    };
+
+    "chunked capture round-trip"_test = [&threadPool] {
+        using namespace gr::blocks::fileio;
+        using namespace gr::testing;
+        using scheduler = gr::scheduler::Simple<>;
+
+        constexpr gr::Size_t    nSamples  = 1000U;
+        constexpr std::uint64_t startTime = 1'000'000'000U; // [ns]
+        const std::string       fileName  = "/tmp/gr4_file_sink_test/TestFileName_chunked.gr4c";
+        detail::deleteFilesContaining(fileName);
+
+        const std::vector<Tag> tags{{0UZ, {{std::string(tag::SAMPLE_RATE.shortKey()), 1000.f}, {std::string(tag::TRIGGER_TIME.shortKey()), startTime}}}, //
+            {63UZ, {{"key", "chunk boundary - 1"}}}, {64UZ, {{"key", "chunk boundary"}}}, {500UZ, {{"key", "mid"}, {"value", 42.0}}}, {999UZ, {{"key", "last"}}}};
+        {
+            gr::Graph flow;
+            auto&     source = flow.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", nSamples}, {"mark_tag", false}});
+            source._tags     = tags;
+            auto& fileSink   = flow.emplaceBlock<ChunkedFileSink<float>>({{"file_name", fileName}, {"chunk_size", gr::Size_t(64U)}});
+            expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).to<"in">(fileSink)));
+
+            auto sched = scheduler{std::move(flow), threadPool};
+            expect(sched.runAndWait().has_value());
+            expect(eq(fileSink._index.size(), (nSamples + 63U) / 64U));
+        }
+        {
+            gr::Graph flow;
+            auto&     fileSource = flow.emplaceBlock<ChunkedFileSource<float>>({{"file_name", fileName}});
+            auto&     sink       = flow.emplaceBlock<TagSink<float, ProcessFunction::USE_PROCESS_BULK>>({{"log_samples", true}, {"log_tags", true}});
+            expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(fileSource).to<"in">(sink)));
+
+            auto sched = scheduler{std::move(flow), threadPool};
+            expect(sched.runAndWait().has_value());
+            expect(eq(sink._samples.size(), std::size_t(nSamples)));
+            for (std::size_t i = 0UZ; i < sink._samples.size(); i++) {
+                expect(eq(sink._samples[i], static_cast<float>(i))) << fmt::format("sample mismatch at index {}", i);
+            }
+            std::vector<Tag> receivedTags = sink._tags;
+            std::erase_if(receivedTags, [](const Tag& tag) { return tag.map.contains(std::string(tag::END_OF_STREAM.shortKey())); });
+            expect(equal_tag_lists(receivedTags, tags));
+        }
+
+        "seek"_test = [&fileName] {
+            ChunkedFileSource<float> fileSource({{"file_name", fileName}});
+            fileSource.init(fileSource.progress, fileSource.ioThreadPool);
+            fileSource.start();
+            expect(eq(fileSource._index.size(), 16UZ));
+            expect(eq(fileSource.position(), 0UZ));
+
+            fileSource.seekTime(static_cast<std::int64_t>(startTime) + 500'000'000); // 500 ms @ 1 kHz
+            expect(eq(fileSource.position(), 500UZ));
+            expect(eq(fileSource._chunk[fileSource._chunkReadPosition], 500.f));
+
+            fileSource.seekSample(777U);
+            expect(eq(fileSource.position(), 777UZ));
+            expect(eq(fileSource._chunk[fileSource._chunkReadPosition], 777.f));
+
+            fileSource.seekTime(0); // before start -> first sample
+            expect(eq(fileSource.position(), 0UZ));
+            fileSource.stop();
+        };
+
+        "index rebuilt by linear scan"_test = [&fileName] {
+            // drop the footer (index record + trailer) as for an incomplete capture
+            const auto fileSize = detail::getFileSize(fileName);
+            std::filesystem::resize_file(fileName, fileSize - sizeof(chunked::Trailer) - 1UZ);
+
+            ChunkedFileSource<float> fileSource({{"file_name", fileName}});
+            fileSource.init(fileSource.progress, fileSource.ioThreadPool);
+            fileSource.start();
+            expect(eq(fileSource._index.size(), 16UZ));
+            fileSource.seekSample(777U);
+            expect(eq(fileSource.position(), 777UZ));
+            expect(eq(fileSource._chunk[fileSource._chunkReadPosition], 777.f));
+
+            expect(std::ranges::all_of(fileSource._index, [](const chunked::IndexEntry& entry) { return std::abs(entry.sampleRate - 1000.0) < 1e-6; })) << "sample rate recovered from the chunk time-stamps";
+            fileSource.seekTime(static_cast<std::int64_t>(startTime) + 500'000'000); // 500 ms @ 1 kHz
+            expect(eq(fileSource.position(), 500UZ));
+            fileSource.stop();
+        };
+
+        "seek with non-monotonic chunk time-stamps"_test = [] {
+            // time reference re-synchronised (stepped back by 1 s) after the second chunk
+            const std::vector<chunked::IndexEntry> index{{.sampleIndex = 0U, .nSamples = 100U, .timeNs = 10'000'000'000, .sampleRate = 1000.0}, //
+                {.sampleIndex = 100U, .nSamples = 100U, .timeNs = 10'100'000'000, .sampleRate = 1000.0},                                        //
+                {.sampleIndex = 200U, .nSamples = 100U, .timeNs = 9'200'000'000, .sampleRate = 1000.0},                                         //
+                {.sampleIndex = 300U, .nSamples = 100U, .timeNs = 9'300'000'000, .sampleRate = 1000.0}};
+            expect(!chunked::isTimeMonotonic(index));
+            expect(eq(chunked::findChunkByTime(index, 9'250'000'000, false), 2UZ));
+            expect(eq(chunked::findChunkByTime(index, 10'150'000'000, false), 1UZ));
+            expect(eq(chunked::findChunkByTime(index, 9'500'000'000, false), 0UZ)) << "gap -> next chunk in time";
+            expect(eq(chunked::findChunkByTime(index, 0, false), 2UZ)) << "before all -> earliest chunk";
+            expect(eq(chunked::findChunkByTime(index, 20'000'000'000, false), 1UZ)) << "after all -> latest chunk";
+        };
+
+        expect(!detail::deleteFilesContaining(fileName).empty());
+    };
+
+    constexpr auto kAsyncTypes = std::tuple<uint8_t, float, std::complex<double>>();
+
+    "async overwrite mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(overwrite, threadPool, true); } | kAsyncTypes;
+
+    "async append mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(append, threadPool, true); } | kAsyncTypes;
+
+    "async create new mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(multi, threadPool, true); } | kAsyncTypes;
+
+    "compressed overwrite mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(overwrite, threadPool, false, "auto"); } | kAsyncTypes;
+
+    "compressed create new mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(multi, threadPool, false, "auto"); } | kAsyncTypes;
+
+    "compressed async overwrite mode"_test = [&threadPool]<typename T>(const T&) { runTest<T>(overwrite, threadPool, true, "auto"); } | kAsyncTypes;
+
+    "compressed round-trip"_test = [&threadPool]<typename T>(const T&) {
+        using namespace gr::blocks::fileio;
+        using namespace gr::testing;
+        using scheduler = gr::scheduler::Simple<>;
+
+        constexpr gr::Size_t nSamples = 10'000U;
+        const std::string    fileName = fmt::format("/tmp/gr4_file_sink_test/TestFileName_compressed_{}.bin", gr::meta::type_name<T>());
+        detail::deleteFilesContaining(fileName);
+        {
+            gr::Graph flow;
+            auto&     source   = flow.emplaceBlock<TagSource<T, ProcessFunction::USE_PROCESS_BULK>>({{"n_samples_max", nSamples}, {"mark_tag", false}});
+            auto&     fileSink = flow.emplaceBlock<BasicFileSink<T>>({{"file_name", fileName}, {"compression", "auto"}, {"buffer_size", gr::Size_t(4096U)}});
+            expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(source).template to<"in">(fileSink)));
+
+            auto sched = scheduler{std::move(flow), threadPool};
+            expect(sched.runAndWait().has_value());
+            expect(eq(fileSink._totalBytesWritten, nSamples * sizeof(T)));
+            expect(eq(fileSink._totalBytesCompressed, detail::getFileSize(fileName)));
+            expect(lt(fileSink._totalBytesCompressed * 2UZ, fileSink._totalBytesWritten)) << "ramp should compress by at least 2:1";
+        }
+
+        for (bool memoryMapped : {false, true}) {
+            gr::Graph flow;
+            auto&     fileSource = flow.emplaceBlock<BasicFileSource<T>>({{"file_name", fileName}, {"memory_mapped", memoryMapped}, {"compressed", true}});
+            auto&     sink       = flow.emplaceBlock<TagSink<T, ProcessFunction::USE_PROCESS_BULK>>({{"log_samples", true}, {"log_tags", false}});
+            expect(eq(gr::ConnectionResult::SUCCESS, flow.connect<"out">(fileSource).template to<"in">(sink)));
+
+            auto sched = scheduler{std::move(flow), threadPool};
+            expect(sched.runAndWait().has_value());
+            expect(eq(sink._samples.size(), std::size_t(nSamples))) << fmt::format("memory-mapped: {}", memoryMapped);
+            for (std::size_t i = 0UZ; i < sink._samples.size(); i++) {
+                if (sink._samples[i] != static_cast<T>(i)) {
+                    expect(false) << fmt::format("sample mismatch at index {} (memory-mapped: {})", i, memoryMapped);
+                    break;
+                }
+            }
+        }
+
+        "seek"_test = [&fileName] {
+            BasicFileSource<T> fileSource({{"file_name", fileName}, {"compressed", true}});
+            fileSource.init(fileSource.progress, fileSource.ioThreadPool);
+            fileSource.start();
+            expect(fileSource._compressed);
+            fileSource.seek(7777UZ);
+            expect(le(fileSource._decodedPosition + sizeof(T), fileSource._decodedFrame.size()));
+            T value{};
+            std::memcpy(&value, fileSource._decodedFrame.data() + fileSource._decodedPosition, sizeof(T));
+            expect(eq(value, static_cast<T>(7777)));
+            fileSource.stop();
+        };
+
+        expect(!detail::deleteFilesContaining(fileName).empty());
+    } | std::tuple<std::int16_t, float>();
 };
 
 int main() { /* not needed for UT */ }
@@ -2,11 +2,16 @@
 #define FREQUENCY_ESTIMATOR_HPP
 
 #include <algorithm>
+#include <array>
 #include <cmath>
 #include <numbers>
+#include <ranges>
 #include <stdexcept>
 #include <vector>
 
+#include <magic_enum.hpp>
+#include <vir/simd.h>
+
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
@@ -183,21 +188,32 @@ This block estimates the frequency of a signal using the frequency-domain algori
       "Improving FFT frequency measurement resolution by parabolic and gaussian spectrum interpolation",
       AIP Conf. Proc. 732 (2004) 276,
       https://doi.org/10.1063/1.1831158.
+
+The spectrum is computed either via a full FFT ('FFT') or -- since only the [f_min, f_max] band is needed -- via a
+band-limited set of DFT bins ('Goertzel'). The latter updates the bins incrementally using a sliding DFT for 'processOne'
+and a Goertzel recurrence per chunk for 'processBulk', applies the Hann window in the frequency domain (three-tap kernel),
+and costs O(number of in-band bins) per sample instead of O(N log N) per FFT.
+Both methods use the periodic (DFT-even) Hann window w(n) = 0.5 - 0.5 cos(2 pi n / N), i.e. yield the same spectral peak.
 )"">;
     using TParent     = Block<FrequencyEstimatorFrequencyDomain<T, Args...>, Args...>;
 
+    enum class Method { FFT, Goertzel };
+
+    Method _method{Method::FFT};
+
     PortIn<T>  in;
     PortOut<T> out;
 
     // settings
-    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>       sample_rate{1.f};
-    Annotated<float, "f_min", Doc<"exp. min frequency range">, Unit<"Hz">>       f_min{40.f};
-    Annotated<float, "f_expected", Doc<"expected likely frequency">, Unit<"Hz">> f_expected{50.f};
-    Annotated<float, "f_max", Doc<"exp. max frequency">, Unit<"Hz">>             f_max{60.f};
-    Annotated<gr::Size_t, "min FFT size", Doc<"minimum FFT size">>               min_fft_size{256U};
-    Annotated<T, "epsilon", Doc<"numerical error threshold">>                    epsilon{T(1e-8)};
+    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>                                                           sample_rate{1.f};
+    Annotated<float, "f_min", Doc<"exp. min frequency range">, Unit<"Hz">>                                                           f_min{40.f};
+    Annotated<float, "f_expected", Doc<"expected likely frequency">, Unit<"Hz">>                                                     f_expected{50.f};
+    Annotated<float, "f_max", Doc<"exp. max frequency">, Unit<"Hz">>                                                                 f_max{60.f};
+    Annotated<gr::Size_t, "min FFT size", Doc<"minimum FFT size">>                                                                   min_fft_size{256U};
+    Annotated<T, "epsilon", Doc<"numerical error threshold">>                                                                        epsilon{T(1e-8)};
+    Annotated<std::string, "method", Doc<"spectrum estimate ('FFT': full spectrum, 'Goertzel': [f_min, f_max] bins only)">, Visible> method = std::string(magic_enum::enum_name(_method));
 
-    GR_MAKE_REFLECTABLE(FrequencyEstimatorFrequencyDomain, in, out, sample_rate, f_expected, f_min, f_max, min_fft_size, epsilon);
+    GR_MAKE_REFLECTABLE(FrequencyEstimatorFrequencyDomain, in, out, sample_rate, f_expected, f_min, f_max, min_fft_size, epsilon, method);
 
     // private internal state
     T           _prevFrequency{50.0}; // previous frequency value for continuity
@@ -207,12 +223,25 @@ This block estimates the frequency of a signal using the frequency-domain algori
 
     gr::algorithm::FFT<T, std::complex<T>> _fftImpl{};
     std::vector<T>                         _inData;
-    std::vector<T>                         _window;
+    std::shared_ptr<const std::vector<T>>  _windowStorage; // shared across blocks via the window cache
+    std::span<const T>                     _window;
     std::vector<std::complex<T>>           _outData;
     std::vector<T>                         _magnitudeSpectrum;
 
+    // band-limited DFT state (Method::Goertzel): bin k = _binOffset + j, split into real/imaginary parts for SIMD
+    using TSimd = vir::stdx::native_simd<T>;
+
+    std::size_t    _binOffset{0UZ};           // first stored bin (= search range start - 2, i.e. neighbours incl. Hann kernel)
+    std::size_t    _binMin{0UZ};              // peak search range [_binMin, _binMax)
+    std::size_t    _binMax{0UZ};              //
+    std::size_t    _samplesSinceRefresh{0UZ}; // sliding DFT updates since the last Goertzel re-computation
+    std::vector<T> _binReal;                  // N.B. padded to a multiple of TSimd::size()
+    std::vector<T> _binImag;
+    std::vector<T> _twiddleReal; // cos(2 pi k / N)
+    std::vector<T> _twiddleImag; // sin(2 pi k / N)
+
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
-        if (newSettings.contains("n_periods") || newSettings.contains("sample_rate") || newSettings.contains("f_expected") || newSettings.contains("f_min") || newSettings.contains("f_max") || newSettings.contains("min_fft_size")) {
+        if (newSettings.contains("n_periods") || newSettings.contains("sample_rate") || newSettings.contains("f_expected") || newSettings.contains("f_min") || newSettings.contains("f_max") || newSettings.contains("min_fft_size") || newSettings.contains("method")) {
             if (f_min < 0 || f_max >= sample_rate || f_expected < 0 || f_expected >= sample_rate) {
                 throw gr::exception(fmt::format("Ill-formed block parameters: f_min: {} < f_expected: {} < f_max: {} < sample_rate: {}", f_min, f_expected, f_max, sample_rate));
             }
@@ -221,16 +250,51 @@ This block estimates the frequency of a signal using the frequency-domain algori
     }
 
     void initialiseFFT() {
+        const auto result = magic_enum::enum_cast<Method>(method.value);
+        if (!result.has_value()) {
+            throw gr::exception(fmt::format("invalid value for {}: {}", magic_enum::enum_type_name<Method>(), method.value));
+        }
+        _method = result.value();
+
         _minFFT = std::bit_ceil(std::max(std::size_t(min_fft_size.value), std::size_t(f_min > 0 ? sample_rate / std::min(f_min.value, f_expected.value) : sample_rate / f_expected.value)));
+        if (_method == Method::Goertzel && _minFFT < 8UZ) { // N.B. need the search range [2, N/2 - 1) plus the +-2 neighbour bins
+            throw gr::exception(fmt::format("FFT size {} too small for method 'Goertzel' (min: 8), increase min_fft_size or decrease f_min/f_expected w.r.t. sample_rate", _minFFT));
+        }
 
         _inputHistory = HistoryBuffer<T>(_minFFT);
         if constexpr (not TParent::ResamplingControl::kIsConst) {
             this->input_chunk_size = static_cast<gr::Size_t>(_minFFT);
         }
         _inData.resize(_minFFT, T(0));
-        _window = gr::algorithm::window::create<T>(gr::algorithm::window::Type::Hann, _minFFT);
+        // periodic Hann window (as the three-tap kernel of the 'Goertzel' method): the symmetric Hann of length N+1 without its
+        // first sample, i.e. already reversed for the newest-first history order (the window is applied to _inputHistory[0 … N-1])
+        _windowStorage = gr::algorithm::window::cached<T>(gr::algorithm::window::Type::Hann, _minFFT + 1UZ);
+        _window        = std::span(*_windowStorage).last(_minFFT);
         _outData.resize(_minFFT, std::complex<T>(T(0)));
         _magnitudeSpectrum.resize(_minFFT / 2UZ, T(0));
+
+        if (_method == Method::Goertzel) {
+            initialiseBins();
+        }
+    }
+
+    void initialiseBins() {
+        const std::size_t lastBin = _minFFT / 2UZ - 2UZ;
+        _binMin                   = std::clamp(static_cast<std::size_t>(std::floor(f_min / sample_rate * static_cast<float>(_minFFT))), 2UZ, lastBin);
+        _binMax                   = std::clamp(static_cast<std::size_t>(std::ceil(f_max / sample_rate * static_cast<float>(_minFFT))), _binMin + 1UZ, lastBin + 1UZ);
+        _binOffset                = _binMin - 2UZ;
+
+        const std::size_t nBins = (_binMax + 2UZ - _binOffset + TSimd::size() - 1UZ) / TSimd::size() * TSimd::size();
+        _binReal.assign(nBins, T(0));
+        _binImag.assign(nBins, T(0));
+        _twiddleReal.resize(nBins);
+        _twiddleImag.resize(nBins);
+        for (std::size_t j = 0UZ; j < nBins; ++j) {
+            const double omega = 2. * std::numbers::pi * static_cast<double>(_binOffset + j) / static_cast<double>(_minFFT);
+            _twiddleReal[j]    = static_cast<T>(std::cos(omega));
+            _twiddleImag[j]    = static_cast<T>(std::sin(omega));
+        }
+        _samplesSinceRefresh = 0UZ;
     }
 
     void reset() {
@@ -241,6 +305,11 @@ This block estimates the frequency of a signal using the frequency-domain algori
     [[nodiscard]] T processOne(T input) noexcept
     requires(TParent::ResamplingControl::kIsConst)
     {
+        if (_method == Method::Goertzel) {
+            slideBins(input);
+            _prevFrequency = estimateFrequencyBins();
+            return _prevFrequency;
+        }
         _inputHistory.push_back(input);
         _prevFrequency = estimateFrequencyFFT();
         return _prevFrequency;
@@ -259,12 +328,14 @@ This block estimates the frequency of a signal using the frequency-domain algori
             const std::size_t  offset = chunk_idx * this->input_chunk_size;
             std::span<const T> chunk  = input.subspan(offset, this->input_chunk_size);
 
-            for (const T& sample : chunk) {
-                _inputHistory.push_back(sample);
+            _inputHistory.push_back_bulk(chunk.begin(), chunk.end());
+            if (_method == Method::Goertzel) {
+                refreshBins();
+                _prevFrequency = estimateFrequencyBins();
+            } else {
+                _prevFrequency = estimateFrequencyFFT();
             }
-
-            _prevFrequency = estimateFrequencyFFT();
-            *output_it++   = _prevFrequency;
+            *output_it++ = _prevFrequency;
         }
 
         return work::Status::OK;
@@ -307,11 +378,91 @@ private:
             return _prevFrequency; // Return previous frequency if peak is at the edges
         }
 
-        // ensure magnitudes are positive
-        const T S_km1 = _magnitudeSpectrum[k_max - 1];
-        const T S_k   = _magnitudeSpectrum[k_max];
-        const T S_kp1 = _magnitudeSpectrum[k_max + 1];
+        return interpolatePeak(k_max, _magnitudeSpectrum[k_max - 1], _magnitudeSpectrum[k_max], _magnitudeSpectrum[k_max + 1]);
+    }
+
+    void slideBins(T input) noexcept {
+        // sliding DFT: X_k[n] = e^{+j 2 pi k / N} (X_k[n-1] + x[n] - x[n-N])
+        const T oldest = _inputHistory.size() == _inputHistory.capacity() ? _inputHistory[_inputHistory.capacity() - 1UZ] : T(0);
+        _inputHistory.push_back(input);
 
+        const TSimd delta(input - oldest);
+        for (std::size_t j = 0UZ; j < _binReal.size(); j += TSimd::size()) {
+            const TSimd re = TSimd(&_binReal[j], vir::stdx::element_aligned) + delta;
+            const TSimd im(&_binImag[j], vir::stdx::element_aligned);
+            const TSimd twRe(&_twiddleReal[j], vir::stdx::element_aligned);
+            const TSimd twIm(&_twiddleImag[j], vir::stdx::element_aligned);
+            (re * twRe - im * twIm).copy_to(&_binReal[j], vir::stdx::element_aligned);
+            (re * twIm + im * twRe).copy_to(&_binImag[j], vir::stdx::element_aligned);
+        }
+
+        if (++_samplesSinceRefresh >= _minFFT) {
+            refreshBins(); // bounds the round-off accumulated by the recursion, amortised O(1) per sample and bin
+        }
+    }
+
+    void refreshBins() noexcept {
+        // Goertzel: s[n] = x[n] + 2 cos(w) s[n-1] - s[n-2] -> X_k = e^{+jw} s[N-1] - s[N-2] (time origin: oldest sample)
+        auto                     bufferStart = _inputHistory.begin();
+        const std::span<const T> data(bufferStart, std::next(bufferStart, static_cast<std::ptrdiff_t>(_inputHistory.size()))); // newest sample first
+        constexpr std::size_t kGroups = 4UZ; // independent recurrences interleaved to hide the s[n-1] -> s[n] latency
+        for (std::size_t j0 = 0UZ; j0 < _binReal.size(); j0 += kGroups * TSimd::size()) {
+            const std::size_t          nGroups = std::min(kGroups, (_binReal.size() - j0) / TSimd::size());
+            std::array<TSimd, kGroups> coeff;
+            std::array<TSimd, kGroups> s1;
+            std::array<TSimd, kGroups> s2;
+            for (std::size_t g = 0UZ; g < kGroups; ++g) {
+                coeff[g] = g < nGroups ? T(2) * TSimd(&_twiddleReal[j0 + g * TSimd::size()], vir::stdx::element_aligned) : TSimd(T(0));
+                s1[g]    = TSimd(T(0));
+                s2[g]    = TSimd(T(0));
+            }
+
+            for (const T& sample : data | std::views::reverse) { // oldest to newest
+                for (std::size_t g = 0UZ; g < kGroups; ++g) {
+                    const TSimd s0 = sample + coeff[g] * s1[g] - s2[g];
+                    s2[g]          = s1[g];
+                    s1[g]          = s0;
+                }
+            }
+
+            for (std::size_t g = 0UZ; g < nGroups; ++g) {
+                const std::size_t j = j0 + g * TSimd::size();
+                const TSimd       twRe(&_twiddleReal[j], vir::stdx::element_aligned);
+                const TSimd       twIm(&_twiddleImag[j], vir::stdx::element_aligned);
+                (twRe * s1[g] - s2[g]).copy_to(&_binReal[j], vir::stdx::element_aligned);
+                (twIm * s1[g]).copy_to(&_binImag[j], vir::stdx::element_aligned);
+            }
+        }
+        _samplesSinceRefresh = 0UZ;
+    }
+
+    T estimateFrequencyBins() const noexcept {
+        if (_inputHistory.size() < _minFFT) {
+            return _prevFrequency; // Return previous frequency during settling time
+        }
+
+        // periodic Hann window applied in the frequency domain: X_w[k] = 0.5 X[k] - 0.25 (X[k-1] + X[k+1])
+        const auto hannMagnitude = [this](std::size_t k) {
+            const std::size_t j  = k - _binOffset;
+            const T           re = T(0.5) * _binReal[j] - T(0.25) * (_binReal[j - 1UZ] + _binReal[j + 1UZ]);
+            const T           im = T(0.5) * _binImag[j] - T(0.25) * (_binImag[j - 1UZ] + _binImag[j + 1UZ]);
+            return std::hypot(re, im);
+        };
+
+        std::size_t k_max = _binMin;
+        T           S_k   = hannMagnitude(_binMin);
+        for (std::size_t k = _binMin + 1UZ; k < _binMax; ++k) {
+            if (const T S = hannMagnitude(k); S > S_k) {
+                S_k   = S;
+                k_max = k;
+            }
+        }
+
+        return interpolatePeak(k_max, hannMagnitude(k_max - 1UZ), S_k, hannMagnitude(k_max + 1UZ));
+    }
+
+    T interpolatePeak(std::size_t k_max, T S_km1, T S_k, T S_kp1) const noexcept {
+        // ensure magnitudes are positive
         if (!std::isfinite(S_km1) || !std::isfinite(S_k) || !std::isfinite(S_kp1) //
             || S_km1 <= T(0) || S_k <= T(0) || S_kp1 <= T(0)) {
             return _prevFrequency; // cannot compute logarithm
@@ -338,7 +489,7 @@ private:
         // calculate the interpolated frequency
         T interpolated_freq_bin = static_cast<T>(k_max) + delta_k;
 
-        return interpolated_freq_bin * static_cast<T>(sample_rate) / static_cast<T>(_inData.size());
+        return interpolated_freq_bin * static_cast<T>(sample_rate) / static_cast<T>(_minFFT);
     }
 };
 
@@ -10,6 +10,7 @@
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/algorithm/filter/FilterTool.hpp>
+#include <gnuradio-4.0/meta/FixedPoint.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
 #include <magic_enum.hpp>
@@ -19,31 +20,48 @@ namespace gr::filter {
 using namespace gr;
 
 template<typename T>
-requires std::floating_point<T>
+requires std::floating_point<T> || FixedPointLike<T>
 struct fir_filter : Block<fir_filter<T>> {
     using Description = Doc<R""(
 @brief Finite Impulse Response (FIR) filter class
 
 The transfer function of an FIR filter is given by:
 H(z) = b[0] + b[1]*z^-1 + b[2]*z^-2 + ... + b[N]*z^-N
+
+For fixed-point sample types (e.g. gr::Q15) the coefficients are kept as 32-bit mantissas with a common exponent (Q1.30 for
+|b[i]| <= 1, i.e. also |b[i]| >= 1 and the default pass-through b = {1.0} are exact) and the products are accumulated in 64-bit
+with a single rounding and saturation per output sample.
 )"">;
-    PortIn<T>      in;
-    PortOut<T>     out;
-    std::vector<T> b{T{1}}; // feedforward coefficients
+    using coefficient_type = std::conditional_t<FixedPointLike<T>, double, T>;
+
+    PortIn<T>                     in;
+    PortOut<T>                    out;
+    std::vector<coefficient_type> b{coefficient_type{1}}; // feedforward coefficients
 
     GR_MAKE_REFLECTABLE(fir_filter, in, out, b);
 
-    HistoryBuffer<T> inputHistory{32};
+    HistoryBuffer<T>          inputHistory{32};
+    std::vector<std::int32_t> _taps{std::int32_t(1) << 30}; // 'b' as mantissas * 2^-_tapShift (fixed-point only), default: 1.0
+    int                       _tapShift = 30;
 
     void settingsChanged(const property_map& /*old_settings*/, const property_map& new_settings) noexcept {
         if (new_settings.contains("b") && b.size() > inputHistory.capacity()) {
             inputHistory = HistoryBuffer<T>(std::bit_ceil(b.size()));
         }
+        if constexpr (FixedPointLike<T>) {
+            _taps.resize(b.size());
+            _tapShift = fixed_point::toMantissas(b, _taps);
+        }
     }
 
     constexpr T processOne(T input) noexcept {
         inputHistory.push_back(input);
-        return std::transform_reduce(std::execution::unseq, b.cbegin(), b.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
+        if constexpr (FixedPointLike<T>) {
+            const std::size_t nTaps = std::min(_taps.size(), inputHistory.capacity());
+            return fixed_point::dot(std::span<const T>(inputHistory.cbegin(), nTaps), std::span<const std::int32_t>(_taps).first(nTaps), _tapShift); // N.B. newest sample first
+        } else {
+            return std::transform_reduce(std::execution::unseq, b.cbegin(), b.cend(), inputHistory.cbegin(), T{0}, std::plus<>{}, std::multiplies<>{});
+        }
     }
 };
 
@@ -255,12 +273,12 @@ aliasing and sub-sampling related effects.
 
 } // namespace gr::filter
 
-inline static auto registerFilter = gr::registerBlock<gr::filter::fir_filter, double, float>(gr::globalBlockRegistry())                                                                                                                                                                      //
+inline static auto registerFilter = gr::registerBlock<gr::filter::fir_filter, double, float, gr::Q15, gr::Q31>(gr::globalBlockRegistry())                                                                                                                                                                      //
                                     + gr::registerBlock<gr::filter::iir_filter, gr::filter::IIRForm::DF_I, double, float>(gr::globalBlockRegistry())                                                                                                                                         //
                                     + gr::registerBlock<gr::filter::iir_filter, gr::filter::IIRForm::DF_II, double, float>(gr::globalBlockRegistry())                                                                                                                                        //
                                     + gr::registerBlock<gr::filter::iir_filter, gr::filter::IIRForm::DF_I_TRANSPOSED, double, float>(gr::globalBlockRegistry()) + gr::registerBlock<gr::filter::iir_filter, gr::filter::IIRForm::DF_II_TRANSPOSED, double, float>(gr::globalBlockRegistry()) //
                                     + gr::registerBlock<gr::filter::BasicFilter, double, float, gr::UncertainValue<float>, gr::UncertainValue<double>>(gr::globalBlockRegistry())                                                                                                            //
                                     + gr::registerBlock<gr::filter::BasicDecimatingFilter, double, float, gr::UncertainValue<float>, gr::UncertainValue<double>>(gr::globalBlockRegistry())                                                                                                  //
-                                    + gr::registerBlock<gr::filter::Decimator, uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t, float, double, std::complex<float>, std::complex<double>, gr::UncertainValue<float>, gr::UncertainValue<double>>(gr::globalBlockRegistry());
+                                    + gr::registerBlock<gr::filter::Decimator, uint8_t, int8_t, uint16_t, int16_t, uint32_t, int32_t, uint64_t, int64_t, float, double, std::complex<float>, std::complex<double>, gr::UncertainValue<float>, gr::UncertainValue<double>, gr::Q15, gr::Q31>(gr::globalBlockRegistry());
 
 #endif // GNURADIO_TIME_DOMAIN_FILTER_HPP
@@ -156,6 +156,123 @@ const boost::ut::suite<"FrequencyEstimatorTests"> FrequencyEstimatorTests = [] {
         testFrequencyEstimator(estimator, processFunc, std::vector<float>(testFrequencies.begin(), testFrequencies.end()), sample_rate, numSamples, noiseAmp, tolerance);
     };
 
+    "Frequency Estimator - Frequency Domain (Goertzel)"_test = [] {
+        constexpr float       sample_rate = 1000.0f; // sampling frequency 1 kHz
+        constexpr std::size_t numSamples  = 4100UZ;  // number of samples
+        constexpr float       noiseAmp    = 0.01f;   // 1% noise level
+        constexpr float       tolerance   = 1.0f;
+
+        FrequencyEstimatorFrequencyDomain<float> estimator;
+        estimator.sample_rate  = sample_rate;
+        estimator.f_min        = 45.f;
+        estimator.f_expected   = 50.f;
+        estimator.f_max        = 55.f;
+        estimator.min_fft_size = 4096U;
+        estimator.method       = "Goertzel";
+        estimator.reset();
+
+        // reference full-FFT estimator -- the band-limited DFT bins should yield the same spectral peak
+        FrequencyEstimatorFrequencyDomain<float> reference;
+        reference.sample_rate  = sample_rate;
+        reference.f_min        = 45.f;
+        reference.f_expected   = 50.f;
+        reference.f_max        = 55.f;
+        reference.min_fft_size = 4096U;
+
+        auto processFunc = [&estimator, &reference](const std::vector<float>& samples, std::vector<float>& frequencyTrue, std::vector<float>& frequencyEstimates, float trueFreq) {
+            reference.reset();
+            size_t i = 0;
+            for (const auto& sample : samples) {
+                float freqEstimate  = estimator.processOne(sample);
+                float freqReference = reference.processOne(sample);
+                if (i > estimator.min_fft_size) {
+                    frequencyTrue.push_back(trueFreq);
+                    frequencyEstimates.push_back(freqEstimate);
+                    expect(approx(freqEstimate, freqReference, 5e-5f)) << fmt::format("sample {}: Goertzel {:.6f} Hz vs. FFT {:.6f} Hz", i, freqEstimate, freqReference); // N.B. float round-off of the FFT
+                }
+                ++i;
+            }
+        };
+
+        testFrequencyEstimator(estimator, processFunc, std::vector<float>(testFrequencies.begin(), testFrequencies.end()), sample_rate, numSamples, noiseAmp, tolerance);
+
+        estimator.method = "Bogus";
+        expect(throws([&estimator] { estimator.reset(); })) << "invalid method should be rejected";
+    };
+
+    "Frequency Estimator - Frequency Domain (Goertzel vs. FFT, same window)"_test = [] {
+        // both methods use the periodic Hann window, i.e. in double precision the spectral peaks should agree to round-off
+        FrequencyEstimatorFrequencyDomain<double> estimator;
+        FrequencyEstimatorFrequencyDomain<double> reference;
+        for (auto* block : {&estimator, &reference}) {
+            block->sample_rate  = 1000.f;
+            block->f_min        = 45.f;
+            block->f_expected   = 50.f;
+            block->f_max        = 55.f;
+            block->min_fft_size = 4096U;
+        }
+        estimator.method = "Goertzel";
+        estimator.reset();
+        reference.reset();
+
+        double maxDeviation = 0.0;
+        for (std::size_t i = 0UZ; i < 4200UZ; ++i) {
+            const double sample        = std::sin(2.0 * std::numbers::pi * 50.123 * static_cast<double>(i) / 1000.0);
+            const double freqEstimate  = estimator.processOne(sample);
+            const double freqReference = reference.processOne(sample);
+            if (i >= estimator.min_fft_size) {
+                maxDeviation = std::max(maxDeviation, std::abs(freqEstimate - freqReference));
+            }
+        }
+        expect(lt(maxDeviation, 1e-9)) << fmt::format("max. Goertzel vs. FFT deviation: {} Hz", maxDeviation);
+    };
+
+    "Frequency Estimator - Frequency Domain Decimating (Goertzel vs. FFT)"_test = [] {
+        // processBulk path: the Goertzel recurrence per chunk should yield the same spectral peak as the full FFT
+        FrequencyEstimatorFrequencyDomainDecimating<double> estimator;
+        FrequencyEstimatorFrequencyDomainDecimating<double> reference;
+        for (auto* block : {&estimator, &reference}) {
+            block->sample_rate  = 1000.f;
+            block->f_min        = 45.f;
+            block->f_expected   = 50.f;
+            block->f_max        = 55.f;
+            block->min_fft_size = 4096U;
+        }
+        estimator.method = "Goertzel";
+        estimator.reset();
+        reference.reset();
+        const std::size_t chunkSize = estimator.input_chunk_size;
+        expect(eq(chunkSize, std::size_t(reference.input_chunk_size)));
+
+        std::vector<double> samples(4UZ * chunkSize);
+        for (std::size_t i = 0UZ; i < samples.size(); ++i) {
+            samples[i] = std::sin(2.0 * std::numbers::pi * 50.123 * static_cast<double>(i) / 1000.0);
+        }
+        for (std::size_t chunk = 0UZ; chunk < samples.size() / chunkSize; ++chunk) {
+            const std::span<const double> input(samples.data() + chunk * chunkSize, chunkSize);
+            double                        freqEstimate  = 0.0;
+            double                        freqReference = 0.0;
+            expect(estimator.processBulk(input, std::span(&freqEstimate, 1UZ)) == work::Status::OK);
+            expect(reference.processBulk(input, std::span(&freqReference, 1UZ)) == work::Status::OK);
+            expect(approx(freqEstimate, freqReference, 1e-9)) << fmt::format("chunk {}: Goertzel {:.9f} Hz vs. FFT {:.9f} Hz", chunk, freqEstimate, freqReference);
+            expect(approx(freqEstimate, 50.123, 0.05)) << fmt::format("chunk {}: Goertzel {:.6f} Hz", chunk, freqEstimate);
+        }
+    };
+
+    "Frequency Estimator - Frequency Domain (Goertzel minimum FFT size)"_test = [] {
+        FrequencyEstimatorFrequencyDomain<float> estimator;
+        estimator.sample_rate  = 16.f; // N.B. sample_rate / f_expected = 4 -> N = 4
+        estimator.f_min        = 4.f;
+        estimator.f_expected   = 4.f;
+        estimator.f_max        = 6.f;
+        estimator.min_fft_size = 4U;
+        expect(nothrow([&estimator] { estimator.reset(); })) << "FFT method has no bin range constraint";
+        estimator.method = "Goertzel";
+        expect(throws([&estimator] { estimator.reset(); })) << "FFT size < 8 should be rejected for Goertzel";
+        estimator.min_fft_size = 8U;
+        expect(nothrow([&estimator] { estimator.reset(); }));
+    };
+
     skip / "Frequency Estimator - Frequency Domain Decimating"_test = [] {
         constexpr float       sample_rate = 1000.0f; // sampling frequency 1 kHz
         constexpr std::size_t numSamples  = 40960UZ; // number of samples (multiple of chunk size)
@@ -123,6 +123,43 @@ const boost::ut::suite SequenceTests = [] {
 #endif
         }
     };
+
+    "FIR fixed-point vs. floating-point"_test = []<typename T>(const T&) {
+        const std::vector<double> coefficients{0.05, -0.1, 0.2, 0.35, 0.2, -0.1, 0.05, 0.02, -0.01};
+        fir_filter<double>        reference(gr::property_map{{"b", coefficients}});
+        fir_filter<T>             filter(gr::property_map{{"b", coefficients}});
+        reference.init(reference.progress, reference.ioThreadPool); // needed for unit-test only when executed outside a Scheduler/Graph
+        filter.init(filter.progress, filter.ioThreadPool);
+
+        // N.B. error budget: (Q31 only) product rounding of 1/2 LSB each plus the final rounding
+        const double tolerance = 0.5 * static_cast<double>(T::epsilon()) * (1.0 + 2.0 * static_cast<double>(coefficients.size()));
+        for (std::size_t i = 0UZ; i < 200UZ; ++i) {
+            const double input    = 0.9 * std::sin(0.05 * static_cast<double>(i)) + ((i / 50UZ) % 2UZ == 0UZ ? 0.0 : 0.09);
+            const double expected = reference.processOne(static_cast<double>(T(input)));
+            const T      output   = filter.processOne(T(input));
+            expect(approx(static_cast<double>(output), expected, tolerance)) << fmt::format("sample {}: {} vs. {}", i, static_cast<double>(output), expected);
+        }
+
+        // saturation instead of two's complement wrap-around
+        fir_filter<T> gain(gr::property_map{{"b", std::vector<double>{0.75, 0.75}}});
+        gain.init(gain.progress, gain.ioThreadPool);
+        std::ignore = gain.processOne(T(0.9));
+        expect(gain.processOne(T(0.9)) == T::max());
+        std::ignore = gain.processOne(T(-0.9));
+        expect(gain.processOne(T(-0.9)) == T::lowest());
+
+        fir_filter<T> passThrough(gr::property_map{});
+        passThrough.init(passThrough.progress, passThrough.ioThreadPool);
+        for (const T input : {T(0.5), T::max(), T::lowest(), T::epsilon()}) {
+            expect(passThrough.processOne(input) == input) << "default tap 1.0 is an exact pass-through";
+        }
+
+        fir_filter<T> boost(gr::property_map{{"b", std::vector<double>{1.5, 0.0}}}); // |b| >= 1
+        boost.init(boost.progress, boost.ioThreadPool);
+        expect(boost.processOne(T(0.5)) == T(0.75));
+        expect(boost.processOne(T(-0.25)) == T(-0.375));
+        expect(boost.processOne(T(0.9)) == T::max());
+    } | std::tuple<gr::Q15, gr::Q31>();
 };
 
 const boost::ut::suite<"Basic[Decimating]Filter"> BasicFilterTests = [] {
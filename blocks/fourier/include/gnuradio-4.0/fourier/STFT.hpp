@@ -0,0 +1,255 @@
+#ifndef GNURADIO_STFT_HPP
+#define GNURADIO_STFT_HPP
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/HistoryBuffer.hpp>
+
+#include <gnuradio-4.0/algorithm/fourier/fft.hpp>
+#include <gnuradio-4.0/algorithm/fourier/fft_common.hpp>
+#include <gnuradio-4.0/algorithm/fourier/window.hpp>
+
+#include <gnuradio-4.0/fourier/fft.hpp>
+
+namespace gr::blocks::fft {
+
+using namespace gr;
+
+template<typename T, typename U = OutputDataSet<T>::type, template<typename, typename> typename FourierAlgorithm = gr::algorithm::FFT>
+requires((gr::meta::complex_like<T> || std::floating_point<T>) && (std::is_same_v<U, DataSet<float>> || std::is_same_v<U, DataSet<double>>))
+struct STFT : public Block<STFT<T, U, FourierAlgorithm>> {
+    using Description = Doc<R""(
+@brief Short-Time Fourier Transform (STFT) producing a rolling spectrogram ('waterfall') DataSet.
+
+The input stream is kept in a sliding `HistoryBuffer` of `fftSize` samples. A new spectrum is computed every
+`hop = max(1, round(fftSize * (1 - overlap)))` samples, i.e. each update only ingests the new hop samples rather
+than re-copying the whole frame. Arbitrary overlaps (e.g. 0.9 for 90%) as well as gaps (negative overlap) are supported.
+
+Optionally, `n_averages` consecutive spectra are combined into one waterfall row using Welch's method
+(i.e. averaging of the power spectral density of the overlapping, windowed segments).
+
+The output DataSet holds the last `n_rows` rows (bounded memory) ordered from oldest to newest:
+ * extents: [n_rows (time), N (frequency)], row-major (LayoutRight)
+ * axis_values[0]: time of the row centre [s], axis_values[1]: frequency [Hz] (centred around 0 Hz for complex inputs)
+ * signal_values: magnitude spectra (linear or dB)
+At most one DataSet is published per invocation once new rows are available.
+
+@tparam T type of the input signal.
+@tparam U type of the output data (presently limited to DataSet<float> and DataSet<double>)
+@tparam FourierAlgorithm the specific algorithm used to perform the Fourier Transform (can be FFT, FFTW).
+)"">;
+    using value_type  = U::value_type;
+    using InDataType  = std::conditional_t<gr::meta::complex_like<T>, std::complex<value_type>, value_type>;
+    using OutDataType = std::complex<value_type>;
+
+    PortIn<T>         in{};
+    PortOut<U, Async> out{};
+
+    FourierAlgorithm<T, std::complex<typename U::value_type>> _fftImpl{};
+    gr::algorithm::window::Type                               _windowType = gr::algorithm::window::Type::Hann;
+
+    // settings
+    const std::string                                                                algorithm = gr::meta::type_name<decltype(_fftImpl)>();
+    Annotated<gr::Size_t, "FFT size", Doc<"FFT size">>                               fftSize{1024U};
+    Annotated<std::string, "window type", Doc<gr::algorithm::window::TypeNames>>     window = std::string(magic_enum::enum_name(_windowType));
+    Annotated<float, "overlap", Doc<"fraction of overlapping samples, < 1">>         overlap{0.5f};
+    Annotated<gr::Size_t, "n averages", Doc<"number of Welch averages per row">>     n_averages{1U};
+    Annotated<gr::Size_t, "n rows", Doc<"waterfall depth (number of time rows)">>    n_rows{64U};
+    Annotated<bool, "output in dB", Doc<"calculate output in decibels">>             outputInDb{false};
+    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate = 1.f;
+    Annotated<std::string, "signal name", Visible>                                   signal_name = "unknown signal";
+    Annotated<std::string, "signal unit", Visible, Doc<"signal's physical SI unit">> signal_unit = "a.u.";
+
+    GR_MAKE_REFLECTABLE(STFT, in, out, algorithm, fftSize, window, overlap, n_averages, n_rows, outputInDb, sample_rate, signal_name, signal_unit);
+
+    constexpr static bool computeFullSpectrum = gr::meta::complex_like<T>;
+
+    // semi-private state (need to be public for unit-test)
+    HistoryBuffer<T>                               _history{1024U};
+    std::shared_ptr<const std::vector<value_type>> _windowStorage{};                // shared across blocks via the window cache
+    std::span<const value_type>                    _window{};
+    std::vector<InDataType>                        _frame{};
+    std::vector<OutDataType>                       _spectrum{};
+    std::vector<value_type>                        _powerSum{};                     // Welch accumulator (|X|^2)
+    std::vector<value_type>                        _waterfall{};                    // ring buffer of n_rows x N magnitudes
+    std::vector<double>                            _rowTimes{};                     // ring buffer of n_rows time stamps [s], N.B. double: float loses resolution for long streams
+    std::size_t                                    _hopSize{512UZ};
+    std::size_t                                    _nSamplesUntilNextFrame{1024UZ};
+    std::size_t                                    _nAccumulated{0UZ};
+    std::size_t                                    _rowWriteIndex{0UZ};             // next row to be written
+    std::size_t                                    _nRowsFilled{0UZ};
+    std::size_t                                    _nNewRows{0UZ};                  // rows not yet published
+    std::uint64_t                                  _nSamplesTotal{0ULL};
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
+        if (newSettings.contains("overlap") && (overlap >= 1.f || !std::isfinite(overlap.value))) {
+            throw gr::exception(fmt::format("overlap ({}) must be < 1", overlap.value));
+        }
+        if (fftSize == 0U || n_averages == 0U || n_rows == 0U) {
+            throw gr::exception(fmt::format("fftSize ({}), n_averages ({}) and n_rows ({}) must be > 0", fftSize.value, n_averages.value, n_rows.value));
+        }
+        if (newSettings.contains("fftSize") || newSettings.contains("window") || newSettings.contains("overlap") || newSettings.contains("n_averages") || newSettings.contains("n_rows")) {
+            reset();
+        }
+    }
+
+    void reset() {
+        const std::size_t N = fftSize;
+        _history            = HistoryBuffer<T>(N);
+        _windowType         = magic_enum::enum_cast<gr::algorithm::window::Type>(window, magic_enum::case_insensitive).value_or(_windowType);
+        _windowStorage      = gr::algorithm::window::cached<value_type>(_windowType, N);
+        _window             = *_windowStorage;
+
+        _frame.assign(N, InDataType{});
+        _spectrum.assign(N, OutDataType{});
+        _powerSum.assign(nBins(), value_type(0));
+        _waterfall.assign(static_cast<std::size_t>(n_rows) * nBins(), value_type(0));
+        _rowTimes.assign(n_rows, 0.0);
+
+        _hopSize                = std::max(1UZ, static_cast<std::size_t>(std::lround(static_cast<double>(N) * (1.0 - static_cast<double>(overlap)))));
+        _nSamplesUntilNextFrame = N;
+        _nAccumulated           = 0UZ;
+        _rowWriteIndex          = 0UZ;
+        _nRowsFilled            = 0UZ;
+        _nNewRows               = 0UZ;
+        _nSamplesTotal          = 0ULL;
+    }
+
+    [[nodiscard]] constexpr std::size_t nBins() const noexcept { return computeFullSpectrum ? static_cast<std::size_t>(fftSize) : static_cast<std::size_t>(fftSize) / 2UZ; }
+
+    gr::work::Status processBulk(InputSpanLike auto& inSamples, OutputSpanLike auto& outSamples) {
+        if (_window.size() != fftSize) { // settings have not been applied yet
+            reset();
+        }
+
+        // only the new hop samples are pushed into the history, a frame is transformed whenever a full hop has been received
+        const std::size_t nSamples = inSamples.size();
+        std::size_t       pos      = 0UZ;
+        while (pos < nSamples) {
+            const std::size_t nSamplesToPush = std::min(_nSamplesUntilNextFrame, nSamples - pos);
+            _history.push_back_bulk(std::next(inSamples.begin(), static_cast<std::ptrdiff_t>(pos)), std::next(inSamples.begin(), static_cast<std::ptrdiff_t>(pos + nSamplesToPush)));
+            pos += nSamplesToPush;
+            _nSamplesTotal += nSamplesToPush;
+            _nSamplesUntilNextFrame -= nSamplesToPush;
+
+            if (_nSamplesUntilNextFrame == 0UZ) {
+                processFrame();
+                _nSamplesUntilNextFrame = _hopSize;
+            }
+        }
+        std::ignore = inSamples.consume(nSamples);
+
+        if (_nNewRows > 0UZ && !outSamples.empty()) {
+            fillDataSet(outSamples[0]);
+            _nNewRows = 0UZ;
+            outSamples.publish(1UZ);
+        } else {
+            outSamples.publish(0UZ);
+        }
+        return work::Status::OK;
+    }
+
+    /**
+     * @brief (re-)populates a DataSet in-place, re-using its existing storage if the dimensions did not change.
+     */
+    void fillDataSet(U& ds) const {
+        const std::size_t N       = nBins();
+        const std::size_t nRows   = _nRowsFilled;
+        const std::size_t nRowMax = _rowTimes.size();
+        const std::size_t first   = (_rowWriteIndex + nRowMax - nRows) % nRowMax; // oldest row
+
+        ds.timestamp = 0;
+        ds.axis_names.assign({"Time", "Frequency"});
+        ds.axis_units.assign({"s", "Hz"});
+        ds.axis_values.resize(2UZ);
+        ds.axis_values[0].resize(nRows);
+        ds.axis_values[1].resize(N);
+        ds.extents.assign({static_cast<int32_t>(nRows), static_cast<int32_t>(N)});
+        ds.layout = gr::LayoutRight{};
+
+        ds.signal_values.resize(nRows * N);
+        for (std::size_t row = 0UZ; row < nRows; row++) {
+            const std::size_t ringRow = (first + row) % nRowMax;
+            ds.axis_values[0][row]    = static_cast<value_type>(_rowTimes[ringRow]);
+            std::ranges::copy_n(std::next(_waterfall.begin(), static_cast<std::ptrdiff_t>(ringRow * N)), static_cast<std::ptrdiff_t>(N), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(row * N)));
+        }
+
+        const auto freqWidth  = static_cast<value_type>(sample_rate) / static_cast<value_type>(fftSize);
+        const auto freqOffset = computeFullSpectrum ? static_cast<value_type>(N / 2) * freqWidth : value_type(0);
+        std::ranges::transform(std::views::iota(0UZ, N), ds.axis_values[1].begin(), [freqWidth, freqOffset](const auto i) { return static_cast<value_type>(i) * freqWidth - freqOffset; });
+
+        if (ds.signal_names.size() != 1UZ) {
+            ds.signal_names.resize(1UZ);
+            ds.signal_units.resize(1UZ);
+        }
+        ds.signal_names[0] = signal_name.value;
+        ds.signal_units[0] = outputInDb ? "dB" : signal_unit.value;
+
+        ds.signal_ranges.resize(1UZ);
+        if (!ds.signal_values.empty()) {
+            const auto [min, max] = std::ranges::minmax(ds.signal_values);
+            ds.signal_ranges[0].assign({min, max});
+        }
+        ds.signal_errors.clear();
+    }
+
+private:
+    void processFrame() {
+        const std::size_t N = fftSize;
+        if (_history.size() < N) {
+            return;
+        }
+
+        // fused re-ordering (HistoryBuffer is newest-first), type-conversion and window function application
+        const auto history = _history.get_span(0UZ, N);
+        if constexpr (gr::meta::complex_like<T>) {
+            std::ranges::transform(history | std::views::reverse, _window, _frame.begin(), [](const T c, const value_type w) { return InDataType(static_cast<value_type>(c.real()) * w, static_cast<value_type>(c.imag()) * w); });
+        } else {
+            std::ranges::transform(history | std::views::reverse, _window, _frame.begin(), [](const T c, const value_type w) { return static_cast<InDataType>(c) * w; });
+        }
+
+        std::ignore = _fftImpl.compute(_frame, _spectrum);
+
+        // Welch: accumulate the power spectrum, for complex inputs the spectrum is re-ordered to [-fs/2, +fs/2)
+        const std::size_t nBin = nBins();
+        for (std::size_t i = 0UZ; i < nBin; i++) {
+            const std::size_t k = computeFullSpectrum ? (i + N / 2UZ) % N : i;
+            _powerSum[i] += std::norm(_spectrum[k]);
+        }
+
+        if (++_nAccumulated < static_cast<std::size_t>(n_averages)) {
+            return;
+        }
+
+        // magnitude normalisation consistent with 'gr::algorithm::fft::computeMagnitudeSpectrum(...)'
+        const value_type scale = value_type(2) / static_cast<value_type>(N);
+        const value_type norm  = value_type(1) / static_cast<value_type>(_nAccumulated);
+        auto             row   = std::span(_waterfall).subspan(_rowWriteIndex * nBin, nBin);
+        std::ranges::transform(_powerSum, row.begin(), [&](const value_type power) {
+            const value_type mag = std::sqrt(power * norm) * scale;
+            if (!outputInDb) {
+                return mag;
+            }
+            return mag > value_type(0) ? value_type(20) * std::log10(mag) : std::numeric_limits<value_type>::lowest();
+        });
+        std::ranges::fill(_powerSum, value_type(0));
+        _nAccumulated = 0UZ;
+
+        // time of the centre of the last frame
+        _rowTimes[_rowWriteIndex] = (static_cast<double>(_nSamplesTotal) - 0.5 * static_cast<double>(N)) / static_cast<double>(sample_rate);
+
+        _rowWriteIndex = (_rowWriteIndex + 1UZ) % _rowTimes.size();
+        _nRowsFilled   = std::min(_nRowsFilled + 1UZ, _rowTimes.size());
+        _nNewRows++;
+    }
+};
+
+template<typename T>
+using DefaultSTFT = STFT<T, typename OutputDataSet<T>::type, gr::algorithm::FFT>;
+
+} // namespace gr::blocks::fft
+
+inline static auto registerSTFT = gr::registerBlock<gr::blocks::fft::DefaultSTFT, float, double>(gr::globalBlockRegistry());
+
+#endif // GNURADIO_STFT_HPP
@@ -97,8 +97,9 @@ On the choice of window (mathematically aka. apodisation) functions
     PortOut<U, RequiredSamples<1, 1>> out{};
 
     FourierAlgorithm<T, std::complex<typename U::value_type>> _fftImpl{};
-    gr::algorithm::window::Type                               _windowType = gr::algorithm::window::Type::Hann;
-    std::vector<value_type>                                   _window     = gr::algorithm::window::create<value_type>(_windowType, 1024U);
+    gr::algorithm::window::Type                               _windowType    = gr::algorithm::window::Type::Hann;
+    std::shared_ptr<const std::vector<value_type>>            _windowStorage = gr::algorithm::window::cached<value_type>(_windowType, 1024U); // shared across blocks
+    std::span<const value_type>                               _window        = *_windowStorage;
 
     // settings
     const std::string                                                                algorithm = gr::meta::type_name<decltype(_fftImpl)>();
@@ -107,13 +108,16 @@ On the choice of window (mathematically aka. apodisation) functions
     Annotated<bool, "output in dB", Doc<"calculate output in decibels">>             outputInDb{false};
     Annotated<bool, "output in deg", Doc<"calculate phase in degrees">>              outputInDeg{false};
     Annotated<bool, "unwrap phase", Doc<"calculate unwrapped phase">>                unwrapPhase{false};
+    Annotated<bool, "output Re/Im", Doc<"publish real and imaginary spectrum">>      outputReIm{true};
+    Annotated<bool, "output magnitude", Doc<"compute magnitude spectrum">>           outputMagnitude{true};
+    Annotated<bool, "output phase", Doc<"compute phase spectrum">>                   outputPhase{true};
     Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>           sample_rate = 1.f;
     Annotated<std::string, "signal name", Visible>                                   signal_name = "unknown signal";
     Annotated<std::string, "signal unit", Visible, Doc<"signal's physical SI unit">> signal_unit = "a.u.";
     Annotated<float, "signal min", Doc<"signal physical min. (e.g. DAQ) limit">>     signal_min  = -std::numeric_limits<float>::max();
     Annotated<float, "signal max", Doc<"signal physical max. (e.g. DAQ) limit">>     signal_max  = +std::numeric_limits<float>::max();
 
-    GR_MAKE_REFLECTABLE(FFT, in, out, algorithm, fftSize, window, outputInDb, outputInDeg, unwrapPhase, sample_rate, signal_name, signal_unit, signal_min, signal_max);
+    GR_MAKE_REFLECTABLE(FFT, in, out, algorithm, fftSize, window, outputInDb, outputInDeg, unwrapPhase, outputReIm, outputMagnitude, outputPhase, sample_rate, signal_name, signal_unit, signal_min, signal_max);
 
     // semi-private caching vectors (need to be public for unit-test) -> TODO: move to FFT implementations, casting from T -> U::value_type should be done there
     std::vector<InDataType>  _inData             = std::vector<InDataType>(fftSize, 0);
@@ -122,7 +126,15 @@ On the choice of window (mathematically aka. apodisation) functions
     std::vector<value_type>  _phaseSpectrum      = std::vector<value_type>(gr::meta::complex_like<T> ? fftSize.value : (1U + fftSize.value / 2U), 0);
     constexpr static bool    computeFullSpectrum = gr::meta::complex_like<T>;
 
+    // cached DataSet layout (names, units, meta-information) -> only re-generated on settings changes rather than per frame
+    bool                             _dataSetLayoutValid = false;
+    std::vector<std::string>         _dataSetAxisNames{};
+    std::vector<std::string>         _dataSetNames{};
+    std::vector<std::string>         _dataSetUnits{};
+    std::vector<typename U::pmt_map> _dataSetMetaInformation{};
+
     void settingsChanged(const property_map& /*old_settings*/, const property_map& newSettings) noexcept {
+        _dataSetLayoutValid = false; // names, units and meta-information may depend on any of the settings
         if (!newSettings.contains("fftSize") && !newSettings.contains("window")) {
             // do need to only handle interdependent settings -> can early return
             return;
@@ -132,90 +144,265 @@ On the choice of window (mathematically aka. apodisation) functions
         in.max_samples            = newSize;
         in.min_samples            = newSize;
         this->input_chunk_size    = newSize;
-        _window.resize(newSize, 0);
 
-        _windowType = magic_enum::enum_cast<gr::algorithm::window::Type>(window, magic_enum::case_insensitive).value_or(_windowType);
-        gr::algorithm::window::create(_window, _windowType);
+        _windowType    = magic_enum::enum_cast<gr::algorithm::window::Type>(window, magic_enum::case_insensitive).value_or(_windowType);
+        _windowStorage = gr::algorithm::window::cached<value_type>(_windowType, newSize);
+        _window        = *_windowStorage;
 
         // N.B. this should become part of the Fourier transform implementation
         _inData.resize(fftSize, 0);
-        _outData.resize(computeFullSpectrum ? newSize : (1U + newSize / 2), 0);
+        _outData.resize(newSize, 0); // N.B. the FFT implementations always provide the full (mirrored) spectrum
         _magnitudeSpectrum.resize(computeFullSpectrum ? newSize : (newSize / 2), 0);
         _phaseSpectrum.resize(computeFullSpectrum ? newSize : (newSize / 2), 0);
     }
 
     [[nodiscard]] constexpr work::Status processBulk(std::span<const T> input, std::span<U> output) {
-        if constexpr (std::is_same_v<T, InDataType>) {
-            std::copy_n(input.begin(), fftSize, _inData.begin());
+        // fused type-conversion and window function application
+        const auto inputFrame = input.first(std::min(input.size(), _inData.size()));
+        if constexpr (gr::meta::complex_like<T>) {
+            std::ranges::transform(inputFrame, _window, _inData.begin(), [](const T c, const value_type w) { return InDataType(static_cast<value_type>(c.real()) * w, static_cast<value_type>(c.imag()) * w); });
         } else {
-            std::ranges::transform(input.begin(), input.end(), _inData.begin(), [](const T c) { return static_cast<InDataType>(c); });
+            std::ranges::transform(inputFrame, _window, _inData.begin(), [](const T c, const value_type w) { return static_cast<InDataType>(c) * w; });
         }
 
-        // apply window function
-        for (std::size_t i = 0U; i < fftSize; i++) {
-            if constexpr (gr::meta::complex_like<T>) {
-                _inData[i].real(_inData[i].real() * _window[i]);
-                _inData[i].imag(_inData[i].imag() * _window[i]);
-            } else {
-                _inData[i] *= _window[i];
-            }
+        // all intermediate results are computed in-place into pre-allocated buffers
+        std::ignore = _fftImpl.compute(_inData, _outData);
+        if (outputMagnitude) {
+            std::ignore = gr::algorithm::fft::computeMagnitudeSpectrum(_outData, _magnitudeSpectrum, algorithm::fft::ConfigMagnitude{.computeHalfSpectrum = !computeFullSpectrum, .outputInDb = outputInDb});
+        }
+        if (outputPhase) {
+            std::ignore = gr::algorithm::fft::computePhaseSpectrum(_outData, _phaseSpectrum, algorithm::fft::ConfigPhase{.computeHalfSpectrum = !computeFullSpectrum, .outputInDeg = outputInDeg, .unwrapPhase = unwrapPhase});
         }
 
-        _outData           = _fftImpl.compute(_inData);
-        _magnitudeSpectrum = gr::algorithm::fft::computeMagnitudeSpectrum(_outData, _magnitudeSpectrum, algorithm::fft::ConfigMagnitude{.computeHalfSpectrum = !computeFullSpectrum, .outputInDb = outputInDb});
-        _phaseSpectrum     = gr::algorithm::fft::computePhaseSpectrum(_outData, _phaseSpectrum, algorithm::fft::ConfigPhase{.computeHalfSpectrum = !computeFullSpectrum, .outputInDeg = outputInDeg, .unwrapPhase = unwrapPhase});
-
-        output[0] = createDataset();
+        // N.B. the output buffer slot is recycled: after the first wrap-around its previous DataSet already holds storage of
+        // the matching size that is re-used rather than re-allocated
+        fillDataSet(output[0]);
 
         return work::Status::OK;
     }
 
     constexpr U createDataset() {
         U ds{};
+        fillDataSet(ds);
+        return ds;
+    }
+
+    /**
+     * @brief (re-)populates a DataSet in-place, re-using its existing storage if the dimensions did not change.
+     */
+    constexpr void fillDataSet(U& ds) {
+        if (!_dataSetLayoutValid) {
+            updateDataSetLayout();
+        }
         ds.timestamp = 0;
         const std::size_t N{_magnitudeSpectrum.size()};
-        const std::size_t dim = 5;
+        const std::size_t dim = _dataSetNames.size();
 
-        ds.axis_names   = {"Frequency", "Re(FFT)", "Im(FFT)", "Magnitude", "Phase"};
-        ds.axis_units   = {"Hz", signal_unit, fmt::format("i{}", signal_unit), fmt::format("{}/√Hz", signal_unit), "rad"};
-        ds.extents      = {dim, static_cast<int32_t>(N)};
+        ds.axis_names = _dataSetAxisNames;
+        ds.axis_units = _dataSetUnits;
+        ds.extents.assign({static_cast<int32_t>(dim), static_cast<int32_t>(N)});
         ds.layout       = gr::LayoutRight{};
-        ds.signal_names = {signal_name, fmt::format("Re(FFT({}))", signal_name), fmt::format("Im(FFT({}))", signal_name), fmt::format("Magnitude({})", signal_name), fmt::format("Phase({})", signal_name)};
-        ds.signal_units = {"Hz", signal_unit, fmt::format("i{}", signal_unit), fmt::format("{}/√Hz", signal_unit), "rad"};
+        ds.signal_names = _dataSetNames; // N.B. copy-assignment re-uses the existing string capacities
+        ds.signal_units = _dataSetUnits;
 
         ds.signal_values.resize(dim * N);
-        auto const freqWidth = static_cast<value_type>(sample_rate) / static_cast<value_type>(fftSize);
+        auto signalSpan = [&ds, N](std::size_t index) { return std::span(ds.signal_values).subspan(index * N, N); };
+
+        std::size_t signalIndex = 0UZ;
+        auto const  freqWidth   = static_cast<value_type>(sample_rate) / static_cast<value_type>(fftSize);
         if constexpr (gr::meta::complex_like<T>) {
             auto const freqOffset = static_cast<value_type>(N / 2) * freqWidth;
-            std::ranges::transform(std::views::iota(0UL, N), std::ranges::begin(ds.signal_values), [freqWidth, freqOffset](const auto i) { return static_cast<value_type>(i) * freqWidth - freqOffset; });
+            std::ranges::transform(std::views::iota(0UL, N), signalSpan(signalIndex++).begin(), [freqWidth, freqOffset](const auto i) { return static_cast<value_type>(i) * freqWidth - freqOffset; });
         } else {
-            std::ranges::transform(std::views::iota(0UL, N), std::ranges::begin(ds.signal_values), [freqWidth](const auto i) { return static_cast<value_type>(i) * freqWidth; });
+            std::ranges::transform(std::views::iota(0UL, N), signalSpan(signalIndex++).begin(), [freqWidth](const auto i) { return static_cast<value_type>(i) * freqWidth; });
+        }
+        const auto spectrum = std::span(_outData).first(N);
+        if (outputReIm) {
+            std::ranges::transform(spectrum, signalSpan(signalIndex++).begin(), [](const auto& c) { return c.real(); });
+            std::ranges::transform(spectrum, signalSpan(signalIndex++).begin(), [](const auto& c) { return c.imag(); });
+        }
+        if (outputMagnitude) {
+            std::ranges::copy_n(_magnitudeSpectrum.begin(), static_cast<std::ptrdiff_t>(N), signalSpan(signalIndex++).begin());
+        }
+        if (outputPhase) {
+            std::ranges::copy_n(_phaseSpectrum.begin(), static_cast<std::ptrdiff_t>(N), signalSpan(signalIndex++).begin());
         }
-        std::ranges::transform(_outData.begin(), _outData.end(), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(N)), [](const auto& c) { return c.real(); });
-        std::ranges::transform(_outData.begin(), _outData.end(), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(2U * N)), [](const auto& c) { return c.imag(); });
-        std::copy_n(_magnitudeSpectrum.begin(), N, std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(3U * N)));
-        std::copy_n(_phaseSpectrum.begin(), N, std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(4U * N)));
 
         ds.signal_ranges.resize(dim);
         for (std::size_t i = 0; i < dim; i++) {
-            const auto mm       = std::minmax_element(std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(i * N)), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>((i + 1U) * N)));
-            ds.signal_ranges[i] = {*mm.first, *mm.second};
+            const auto [min, max] = std::ranges::minmax(signalSpan(i));
+            ds.signal_ranges[i].assign({min, max});
         }
 
-        ds.signal_errors    = {};
-        ds.meta_information = {{{"sample_rate", sample_rate}, {"signal_name", signal_name}, {"signal_unit", signal_unit}, {"signal_min", signal_min}, {"signal_max", signal_max}, //
-            {"fft_size", fftSize}, {"window", window}, {"output_in_db", outputInDb}, {"output_in_deg", outputInDeg}, {"unwrap_phase", unwrapPhase},                               //
-            {"input_chunk_size", this->input_chunk_size}, {"output_chunk_size", this->output_chunk_size}, {"stride", this->stride}}};
+        ds.signal_errors.clear();
+        ds.meta_information = _dataSetMetaInformation; // N.B. std::map copy-assignment re-uses existing nodes
+    }
 
-        return ds;
+private:
+    void updateDataSetLayout() {
+        const std::string unit = signal_unit;
+        const std::string name = signal_name;
+        _dataSetAxisNames.assign({"Frequency"});
+        _dataSetNames.assign({name});
+        _dataSetUnits.assign({"Hz"});
+        if (outputReIm) {
+            _dataSetAxisNames.insert(_dataSetAxisNames.end(), {"Re(FFT)", "Im(FFT)"});
+            _dataSetNames.insert(_dataSetNames.end(), {fmt::format("Re(FFT({}))", name), fmt::format("Im(FFT({}))", name)});
+            _dataSetUnits.insert(_dataSetUnits.end(), {unit, fmt::format("i{}", unit)});
+        }
+        if (outputMagnitude) {
+            _dataSetAxisNames.emplace_back("Magnitude");
+            _dataSetNames.push_back(fmt::format("Magnitude({})", name));
+            _dataSetUnits.push_back(fmt::format("{}/√Hz", unit));
+        }
+        if (outputPhase) {
+            _dataSetAxisNames.emplace_back("Phase");
+            _dataSetNames.push_back(fmt::format("Phase({})", name));
+            _dataSetUnits.emplace_back("rad");
+        }
+
+        _dataSetMetaInformation = {{{"sample_rate", sample_rate}, {"signal_name", signal_name}, {"signal_unit", signal_unit}, {"signal_min", signal_min}, {"signal_max", signal_max}, //
+            {"fft_size", fftSize}, {"window", window}, {"output_in_db", outputInDb}, {"output_in_deg", outputInDeg}, {"unwrap_phase", unwrapPhase},                                  //
+            {"input_chunk_size", this->input_chunk_size}, {"output_chunk_size", this->output_chunk_size}, {"stride", this->stride}}};
+        _dataSetLayoutValid = true;
     }
 };
 
 template<typename T>
 using DefaultFFT = FFT<T, typename OutputDataSet<T>::type, gr::algorithm::FFT>;
 
+template<typename T, typename U = OutputDataSet<T>::type, template<typename, typename> typename FourierAlgorithm = gr::algorithm::FFT>
+requires((gr::meta::complex_like<T> || std::floating_point<T>) && (std::is_same_v<U, DataSet<float>> || std::is_same_v<U, DataSet<double>>))
+struct MultiChannelFFT : public Block<MultiChannelFFT<T, U, FourierAlgorithm>, Resampling<1024LU, 1LU>> {
+    using Description = Doc<R""(
+@brief Performs (Fast) Fourier Transforms on a variable number of synchronous input channels.
+
+All channels are windowed and transformed in a single batched call of the Fourier algorithm
+(see `FFT::computeBatch(...)`/`FFTw::computeBatch(...)`) and published as one DataSet containing
+the magnitude spectra of all channels (extents: [n_inputs, N], shared frequency axis in `axis_values[0]`).
+
+@tparam T type of the input signal.
+@tparam U type of the output data (presently limited to DataSet<float> and DataSet<double>)
+@tparam FourierAlgorithm the specific algorithm used to perform the Fourier Transform (can be FFT, FFTW).
+)"">;
+    using value_type  = U::value_type;
+    using InDataType  = std::conditional_t<gr::meta::complex_like<T>, std::complex<value_type>, value_type>;
+    using OutDataType = std::complex<value_type>;
+
+    std::vector<PortIn<T>>            in = std::vector<PortIn<T>>(1UZ); // N.B. matches the default 'n_inputs'
+    PortOut<U, RequiredSamples<1, 1>> out{};
+
+    FourierAlgorithm<T, std::complex<typename U::value_type>> _fftImpl{};
+    gr::algorithm::window::Type                               _windowType    = gr::algorithm::window::Type::Hann;
+    std::shared_ptr<const std::vector<value_type>>            _windowStorage = gr::algorithm::window::cached<value_type>(_windowType, 1024U); // shared across blocks
+    std::span<const value_type>                               _window        = *_windowStorage;
+
+    // settings
+    const std::string                                                                             algorithm = gr::meta::type_name<decltype(_fftImpl)>();
+    Annotated<gr::Size_t, "n_inputs", Visible, Doc<"number of input channels">, Limits<1U, 256U>> n_inputs  = 1U;
+    Annotated<gr::Size_t, "FFT size", Doc<"FFT size">>                                            fftSize{1024U};
+    Annotated<std::string, "window type", Doc<gr::algorithm::window::TypeNames>>                  window = std::string(magic_enum::enum_name(_windowType));
+    Annotated<bool, "output in dB", Doc<"calculate output in decibels">>                          outputInDb{false};
+    Annotated<float, "sample rate", Doc<"signal sample rate">, Unit<"Hz">>                        sample_rate = 1.f;
+    Annotated<std::string, "signal name", Visible>                                                signal_name = "unknown signal";
+    Annotated<std::string, "signal unit", Visible, Doc<"signal's physical SI unit">>              signal_unit = "a.u.";
+
+    GR_MAKE_REFLECTABLE(MultiChannelFFT, in, out, algorithm, n_inputs, fftSize, window, outputInDb, sample_rate, signal_name, signal_unit);
+
+    // semi-private caching vectors (need to be public for unit-test), channel-frames are stored back-to-back
+    std::vector<InDataType>  _inData{};
+    std::vector<OutDataType> _outData{};
+    std::vector<std::string> _signalNames{};
+    std::vector<std::string> _signalUnits{};
+    constexpr static bool    computeFullSpectrum = gr::meta::complex_like<T>;
+
+    void settingsChanged(const property_map& oldSettings, const property_map& newSettings) {
+        if (newSettings.contains("n_inputs") && oldSettings.at("n_inputs") != newSettings.at("n_inputs")) {
+            in.resize(n_inputs);
+        }
+
+        const std::size_t newSize = fftSize;
+        for (auto& port : in) {
+            port.max_samples = newSize;
+            port.min_samples = newSize;
+        }
+        this->input_chunk_size = newSize;
+
+        _windowType    = magic_enum::enum_cast<gr::algorithm::window::Type>(window, magic_enum::case_insensitive).value_or(_windowType);
+        _windowStorage = gr::algorithm::window::cached<value_type>(_windowType, newSize);
+        _window        = *_windowStorage;
+
+        _inData.resize(newSize * in.size(), 0);
+        _outData.resize(newSize * in.size(), 0);
+
+        _signalNames.resize(in.size());
+        _signalUnits.resize(in.size());
+        for (std::size_t ch = 0UZ; ch < in.size(); ch++) {
+            _signalNames[ch] = fmt::format("Magnitude({}#{})", signal_name.value, ch);
+            _signalUnits[ch] = fmt::format("{}/√Hz", signal_unit.value);
+        }
+    }
+
+    template<gr::InputSpanLike TInSpan>
+    gr::work::Status processBulk(const std::span<TInSpan>& ins, gr::OutputSpanLike auto& output) {
+        const std::size_t nChannels = ins.size();
+        const std::size_t N         = fftSize;
+        _inData.resize(N * nChannels); // no-op in steady-state
+        for (std::size_t ch = 0UZ; ch < nChannels; ch++) { // fused type-conversion and window function application
+            const auto channelFrame = std::span(ins[ch]).first(std::min(ins[ch].size(), N));
+            auto       inDataFrame  = std::next(_inData.begin(), static_cast<std::ptrdiff_t>(ch * N));
+            if constexpr (gr::meta::complex_like<T>) {
+                std::ranges::transform(channelFrame, _window, inDataFrame, [](const T c, const value_type w) { return InDataType(static_cast<value_type>(c.real()) * w, static_cast<value_type>(c.imag()) * w); });
+            } else {
+                std::ranges::transform(channelFrame, _window, inDataFrame, [](const T c, const value_type w) { return static_cast<InDataType>(c) * w; });
+            }
+        }
+
+        std::ignore = _fftImpl.computeBatch(_inData, _outData, nChannels);
+
+        fillDataSet(output[0], nChannels);
+        return work::Status::OK;
+    }
+
+    void fillDataSet(U& ds, std::size_t nChannels) {
+        const std::size_t N = computeFullSpectrum ? static_cast<std::size_t>(fftSize) : static_cast<std::size_t>(fftSize) / 2UZ;
+
+        ds.timestamp = 0;
+        ds.axis_names.assign({"Frequency"});
+        ds.axis_units.assign({"Hz"});
+        ds.axis_values.resize(1UZ);
+        ds.axis_values[0].resize(N);
+        auto const freqWidth = static_cast<value_type>(sample_rate) / static_cast<value_type>(fftSize);
+        if constexpr (gr::meta::complex_like<T>) {
+            auto const freqOffset = static_cast<value_type>(N / 2) * freqWidth;
+            std::ranges::transform(std::views::iota(0UZ, N), ds.axis_values[0].begin(), [freqWidth, freqOffset](const auto i) { return static_cast<value_type>(i) * freqWidth - freqOffset; });
+        } else {
+            std::ranges::transform(std::views::iota(0UZ, N), ds.axis_values[0].begin(), [freqWidth](const auto i) { return static_cast<value_type>(i) * freqWidth; });
+        }
+
+        ds.extents.assign({static_cast<int32_t>(nChannels), static_cast<int32_t>(N)});
+        ds.layout = gr::LayoutRight{};
+        ds.signal_names = _signalNames; // N.B. copy-assignment re-uses the existing string capacities
+        ds.signal_units = _signalUnits;
+        ds.signal_values.resize(nChannels * N);
+        ds.signal_ranges.resize(nChannels);
+        for (std::size_t ch = 0UZ; ch < nChannels; ch++) {
+            const auto spectrum  = std::span(_outData).subspan(ch * static_cast<std::size_t>(fftSize), fftSize);
+            auto       magnitude = std::span(ds.signal_values).subspan(ch * N, N);
+            std::ignore          = gr::algorithm::fft::computeMagnitudeSpectrum(spectrum, magnitude, algorithm::fft::ConfigMagnitude{.computeHalfSpectrum = !computeFullSpectrum, .outputInDb = outputInDb});
+
+            const auto [min, max] = std::ranges::minmax(magnitude);
+            ds.signal_ranges[ch].assign({min, max});
+        }
+        ds.signal_errors.clear();
+    }
+};
+
+template<typename T>
+using DefaultMultiChannelFFT = MultiChannelFFT<T, typename OutputDataSet<T>::type, gr::algorithm::FFT>;
+
 } // namespace gr::blocks::fft
 
-auto registerFFT = gr::registerBlock<gr::blocks::fft::DefaultFFT, float, double>(gr::globalBlockRegistry());
+auto registerFFT = gr::registerBlock<gr::blocks::fft::DefaultFFT, float, double>(gr::globalBlockRegistry()) | gr::registerBlock<gr::blocks::fft::DefaultMultiChannelFFT, float, double>(gr::globalBlockRegistry());
 
 #endif // GNURADIO_FFT_HPP
@@ -13,6 +13,7 @@
 
 #include <gnuradio-4.0/testing/TagMonitors.hpp>
 
+#include <gnuradio-4.0/fourier/STFT.hpp>
 #include <gnuradio-4.0/fourier/fft.hpp>
 
 template<typename T>
@@ -117,6 +118,120 @@ const boost::ut::suite<"Fourier Transforms"> fftTests = [] {
         equalDataset(fftBlock, v[0], sample_rate);
     } | AllTypesToTest{};
 
+    "FFT selected spectra and DataSet storage re-use"_test = [] {
+        constexpr gr::Size_t       N{16};
+        FFT<float, DataSet<float>> fftBlock({{"fftSize", N}, {"outputReIm", false}, {"outputPhase", false}});
+        fftBlock.init(fftBlock.progress, fftBlock.ioThreadPool);
+
+        std::vector<float> signal(N);
+        std::iota(signal.begin(), signal.end(), 1.f);
+        std::vector<DataSet<float>> v(1);
+
+        expect(gr::work::Status::OK == fftBlock.processBulk(signal, v));
+        const DataSet<float>& ds = v[0];
+        expect(eq(ds.signal_names.size(), 2UZ)) << "only frequency and magnitude are published";
+        expect(eq(ds.extents.size(), 2UZ));
+        expect(eq(ds.extents[0], 2));
+        expect(eq(ds.extents[1], static_cast<std::int32_t>(N / 2)));
+        expect(eq(ds.signal_values.size(), 2UZ * N / 2UZ));
+        expect(equalVectors<float>(std::vector(std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(N / 2)), ds.signal_values.end()), fftBlock._magnitudeSpectrum));
+
+        const float* valuesStorage = ds.signal_values.data();
+        expect(gr::work::Status::OK == fftBlock.processBulk(signal, v));
+        expect(eq(valuesStorage, v[0].signal_values.data())) << "DataSet storage is re-used across calls";
+    };
+
+    "MultiChannelFFT default settings"_test = [] {
+        using namespace boost::ut;
+        MultiChannelFFT<float> multiFFT({{"fftSize", gr::Size_t(16U)}});
+        multiFFT.init(multiFFT.progress, multiFFT.ioThreadPool);
+        expect(eq(multiFFT.n_inputs.value, gr::Size_t(1U))) << "default within Limits<1, 256>";
+        expect(eq(multiFFT.in.size(), 1UZ));
+        expect(eq(multiFFT._inData.size(), 16UZ));
+    };
+
+    "MultiChannelFFT flow graph"_test = [] {
+        using namespace boost::ut;
+        using namespace gr::testing;
+        using namespace std::string_literals;
+        constexpr gr::Size_t N{16};
+        constexpr gr::Size_t nChannels{3};
+
+        gr::Graph graph;
+        auto&     multiFFT = graph.emplaceBlock<MultiChannelFFT<float>>({{"n_inputs", nChannels}, {"fftSize", N}});
+        for (gr::Size_t i = 0; i < nChannels; ++i) {
+            std::vector<float> values(N);
+            std::iota(values.begin(), values.end(), static_cast<float>(i + 1U));
+            auto& src = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"values", values}, {"n_samples_max", N}, {"mark_tag", false}});
+            expect(eq(gr::ConnectionResult::SUCCESS, graph.connect(src, "out"s, multiFFT, "in#"s + std::to_string(i))));
+        }
+        auto& sink = graph.emplaceBlock<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>>({{"log_samples", true}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(multiFFT).to<"in">(sink)));
+
+        gr::scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(sink._samples.size(), 1UZ));
+        const DataSet<float>& ds = sink._samples[0];
+        expect(eq(ds.extents.size(), 2UZ));
+        expect(eq(ds.extents[0], static_cast<std::int32_t>(nChannels)));
+        expect(eq(ds.extents[1], static_cast<std::int32_t>(N / 2)));
+        expect(eq(ds.signal_names.size(), static_cast<std::size_t>(nChannels)));
+        expect(eq(ds.axis_values.size(), 1UZ));
+
+        // compare against the single-channel FFT block
+        for (gr::Size_t i = 0; i < nChannels; ++i) {
+            FFT<float> fftBlock({{"fftSize", N}});
+            fftBlock.init(fftBlock.progress, fftBlock.ioThreadPool);
+            std::vector<float> signal(N);
+            std::iota(signal.begin(), signal.end(), static_cast<float>(i + 1U));
+            std::vector<DataSet<float>> v(1);
+            expect(gr::work::Status::OK == fftBlock.processBulk(signal, v));
+
+            const auto channel = std::vector(std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>(i * N / 2)), std::next(ds.signal_values.begin(), static_cast<std::ptrdiff_t>((i + 1) * N / 2)));
+            expect(equalVectors<float>(channel, fftBlock._magnitudeSpectrum)) << fmt::format("channel {} magnitude spectrum", i);
+        }
+    };
+
+    "STFT rolling spectrogram"_test = [] {
+        using namespace boost::ut;
+        using namespace gr::testing;
+        constexpr gr::Size_t N{64};
+        constexpr gr::Size_t nRows{8};
+        constexpr float      sampleRate{64.f};
+        constexpr double     frequency{8.};
+
+        gr::Graph graph;
+        auto&     src  = graph.emplaceBlock<TagSource<float, ProcessFunction::USE_PROCESS_BULK>>({{"values", generateSinSample<float>(N, static_cast<double>(sampleRate), frequency, 1.)}, {"n_samples_max", gr::Size_t(32U * N)}, {"mark_tag", false}});
+        auto&     stft = graph.emplaceBlock<STFT<float>>({{"fftSize", N}, {"overlap", 0.75f}, {"n_averages", gr::Size_t(2U)}, {"n_rows", nRows}, {"sample_rate", sampleRate}});
+        auto&     sink = graph.emplaceBlock<TagSink<DataSet<float>, ProcessFunction::USE_PROCESS_BULK>>({{"log_samples", true}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(src).to<"in">(stft)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(stft).to<"in">(sink)));
+
+        gr::scheduler::Simple sched{std::move(graph)};
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(stft._hopSize, static_cast<std::size_t>(N / 4U)));
+        expect(!sink._samples.empty());
+        const DataSet<float>& ds = sink._samples.back();
+        expect(eq(ds.extents.size(), 2UZ));
+        expect(eq(ds.extents[0], static_cast<std::int32_t>(nRows))) << "waterfall depth is bounded by n_rows";
+        expect(eq(ds.extents[1], static_cast<std::int32_t>(N / 2)));
+        expect(eq(ds.signal_values.size(), static_cast<std::size_t>(nRows * N / 2)));
+        expect(eq(ds.axis_values.size(), 2UZ));
+        expect(std::ranges::is_sorted(ds.axis_values[0])) << "rows are ordered from oldest to newest";
+        // (32 * N - N) / hop + 1 = 125 frames -> 62 Welch-averaged rows, the last one ending one hop before the end of the stream
+        expect(approx(ds.axis_values[0].back(), (static_cast<float>(32U * N - N / 4U) - 0.5f * static_cast<float>(N)) / sampleRate, 1e-3f));
+        const std::size_t newestRow = (stft._rowWriteIndex + nRows - 1UZ) % nRows;
+        expect(eq(stft._rowTimes[newestRow], (static_cast<double>(32U * N - N / 4U) - 0.5 * static_cast<double>(N)) / static_cast<double>(sampleRate))) << "row time-stamps are kept in double precision";
+
+        for (std::size_t row = 0; row < nRows; row++) {
+            const auto spectrum = std::span(ds.signal_values).subspan(row * N / 2, N / 2);
+            const auto peak     = static_cast<std::size_t>(std::distance(spectrum.begin(), std::ranges::max_element(spectrum)));
+            expect(approx(ds.axis_values[1][peak], static_cast<float>(frequency), 1e-3f)) << fmt::format("row {} spectral peak", row);
+        }
+    };
+
     "FFT block types tests"_test = [] {
         expect(std::is_same_v<FFT<std::complex<float>>::value_type, float>) << "output type must be float";
         expect(std::is_same_v<FFT<std::complex<double>>::value_type, double>) << "output type must be float";
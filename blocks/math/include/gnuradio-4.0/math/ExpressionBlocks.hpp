@@ -2,11 +2,14 @@
 #define EXPRESSIONBLOCKS_HPP
 
 #include <algorithm>
+#include <cctype>
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 
 #include <exprtk.hpp>
 
+#include <gnuradio-4.0/math/VectorisedExpression.hpp>
+
 namespace gr::blocks::math {
 
 namespace detail {
@@ -48,6 +51,16 @@ inline VectorInfo computeVectorInfo(void* base_ptr, void* end_ptr, std::size_t e
 struct vector_access_rtc : public exprtk::vector_access_runtime_check {
     std::unordered_map<void*, std::string> vector_map;
 
+    void rebase(void* oldBase, void* newBase) { // N.B. re-uses the map node, i.e. does not allocate
+        if (oldBase == newBase) {
+            return;
+        }
+        if (auto node = vector_map.extract(oldBase); !node.empty()) {
+            node.key() = newBase;
+            vector_map.insert(std::move(node));
+        }
+    }
+
     bool handle_runtime_violation(violation_context& context) override {
         auto               itr         = vector_map.find(static_cast<void*>(context.base_ptr));
         const std::string& vector_name = (itr != vector_map.end()) ? itr->second : "Unknown";
@@ -60,6 +73,73 @@ struct vector_access_rtc : public exprtk::vector_access_runtime_check {
     }
 };
 
+struct VectorUsage {
+    bool read        = false;
+    bool written     = false;
+    bool overwritten = false; // assigned as a whole by an unconditional top-level statement, i.e. no stale elements remain
+};
+
+/// conservative scan of how an ExprTk expression uses the vector `name` (N.B. symbols are case-insensitive, comments are treated as code)
+inline VectorUsage vectorUsage(std::string_view expression, std::string_view name) {
+    constexpr auto toLower          = [](char c) { return static_cast<char>(std::tolower(static_cast<unsigned char>(c))); };
+    constexpr auto isIdentifierChar = [](char c) { return std::isalnum(static_cast<unsigned char>(c)) != 0 || c == '_'; };
+    const auto     skipWhitespace   = [&expression](std::size_t pos) {
+        while (pos < expression.size() && std::isspace(static_cast<unsigned char>(expression[pos])) != 0) {
+            ++pos;
+        }
+        return pos;
+    };
+
+    const auto isTopLevelStatement = [&expression](std::size_t pos) { // i.e. not nested in a block, condition or index and preceded by ';'
+        std::ptrdiff_t depth    = 0;
+        char           previous = ';';
+        for (const char c : expression.substr(0UZ, pos)) {
+            depth += (c == '(' || c == '[' || c == '{') ? 1 : ((c == ')' || c == ']' || c == '}') ? -1 : 0);
+            previous = std::isspace(static_cast<unsigned char>(c)) != 0 ? previous : c;
+        }
+        return depth == 0 && previous == ';';
+    };
+
+    VectorUsage usage;
+    for (std::size_t pos = 0UZ; pos + name.size() <= expression.size(); ++pos) {
+        const std::size_t end = pos + name.size();
+        if (!std::ranges::equal(expression.substr(pos, name.size()), name, {}, toLower, toLower) || (pos > 0UZ && isIdentifierChar(expression[pos - 1UZ])) || (end < expression.size() && isIdentifierChar(expression[end]))) {
+            continue;
+        }
+        std::size_t next    = skipWhitespace(end);
+        const bool  indexed = next < expression.size() && expression[next] == '[';
+        if (indexed) { // skip element index, nested occurrences are visited by the outer loop
+            for (std::size_t depth = 0UZ; next < expression.size(); ++next) {
+                if (expression[next] == '[') {
+                    ++depth;
+                } else if (expression[next] == ']' && --depth == 0UZ) {
+                    break;
+                }
+            }
+            next = skipWhitespace(next + 1UZ);
+        }
+        const std::string_view rest         = expression.substr(std::min(next, expression.size()));
+        const bool             isAssignment = rest.starts_with(":=");
+        const bool             isCompound   = rest.size() >= 2UZ && rest[1] == '=' && std::string_view("+-*/%").contains(rest[0]); // reads and writes
+        usage.written |= isAssignment || isCompound;
+        usage.read |= !isAssignment;
+        usage.overwritten |= isAssignment && !indexed && isTopLevelStatement(pos);
+    }
+    if (expression.contains("<=>")) { // swap operator
+        usage.read    = true;
+        usage.written = true;
+    }
+    return usage;
+}
+
+template<typename T, typename TBlock>
+std::optional<VectorisedExpression<T>> compileVectorised(const TBlock& block, std::span<const std::string_view> inputs, std::string_view output) {
+    const std::array parameters{typename VectorisedExpression<T>::Parameter{block.param_a.description(), &block.param_a.value}, //
+        typename VectorisedExpression<T>::Parameter{block.param_b.description(), &block.param_b.value},                       //
+        typename VectorisedExpression<T>::Parameter{block.param_c.description(), &block.param_c.value}};
+    return VectorisedExpression<T>::compile(block.expr_string.value, inputs, output, parameters);
+}
+
 } // namespace detail
 
 template<typename T>
@@ -69,6 +149,8 @@ struct ExpressionSISO : Block<ExpressionSISO<T>> {
 
 This block uses ExprTK to compute a user-defined expression for each input sample.
 The input sample is referenced by the variable `x`, and the output is produced as the evaluated expression.
+Purely arithmetic expressions (no conditionals, loops or recursion) are evaluated in vectorised blocks of samples,
+all others sample-by-sample by the ExprTk interpreter.
 
 Examples:
 - `y := a * x + b`           // (simple linear scaling)
@@ -94,10 +176,11 @@ For full syntax, conditionals, loops, and advanced features:
 
     GR_MAKE_REFLECTABLE(ExpressionSISO, in, out, expr_string, param_a, param_b, param_c);
 
-    exprtk::symbol_table<T> _symbol_table{};
-    exprtk::expression<T>   _expression{};
-    T                       _in;
-    T                       _out;
+    exprtk::symbol_table<T>                         _symbol_table{};
+    exprtk::expression<T>                           _expression{};
+    std::optional<detail::VectorisedExpression<T>> _vectorised{}; // std::nullopt -> ExprTk interpreter fallback
+    T                                               _in;
+    T                                               _out;
 
     void initExpression(std::source_location location = std::source_location::current()) {
         reset();
@@ -115,6 +198,8 @@ For full syntax, conditionals, loops, and advanced features:
         if (exprtk::parser<T> parser; !parser.compile(expr_string, _expression)) {
             throw gr::exception(detail::formatParserError(parser, expr_string), location);
         }
+        constexpr std::array<std::string_view, 1UZ> inputs{"x"};
+        _vectorised = detail::compileVectorised<T>(*this, inputs, "y");
     }
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
@@ -130,10 +215,17 @@ For full syntax, conditionals, loops, and advanced features:
         _out = T(0);
     }
 
-    [[nodiscard]] constexpr T processOne(T input) {
-        _in  = input;
-        _out = _expression.value(); // evaluate expression, _out == 'y' defined to allow for recursion
-        return _out;
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) {
+        if (_vectorised) {
+            _vectorised->evaluate(std::array{input}, output);
+            return work::Status::OK;
+        }
+        for (std::size_t i = 0UZ; i < output.size(); ++i) {
+            _in       = input[i];
+            _out      = _expression.value(); // evaluate expression, _out == 'y' defined to allow for recursion
+            output[i] = _out;
+        }
+        return work::Status::OK;
     }
 };
 static_assert(std::is_constructible_v<ExpressionSISO<float>, property_map>, "Block type ExpressionSISO must be constructible from property_map");
@@ -145,6 +237,8 @@ struct ExpressionDISO : Block<ExpressionDISO<T>> {
 
 This block uses ExprTK to compute a user-defined expression from two input samples.
 The two input samples are referenced by variables `x` and `y`, and the output is `z` (the evaluated expression).
+Purely arithmetic expressions (no conditionals, loops or recursion) are evaluated in vectorised blocks of samples,
+all others sample-by-sample by the ExprTk interpreter.
 
 Examples:
 - `z := a * (x + y)`                     // (combining two inputs linearly)
@@ -171,11 +265,12 @@ For full syntax, conditionals, loops, and advanced features:
 
     GR_MAKE_REFLECTABLE(ExpressionDISO, in0, in1, out, expr_string, param_a, param_b, param_c);
 
-    exprtk::symbol_table<T> _symbol_table{};
-    exprtk::expression<T>   _expression{};
-    T                       _in0;
-    T                       _in1;
-    T                       _out;
+    exprtk::symbol_table<T>                         _symbol_table{};
+    exprtk::expression<T>                           _expression{};
+    std::optional<detail::VectorisedExpression<T>> _vectorised{}; // std::nullopt -> ExprTk interpreter fallback
+    T                                               _in0;
+    T                                               _in1;
+    T                                               _out;
 
     void initExpression(std::source_location location = std::source_location::current()) {
         reset();
@@ -194,6 +289,8 @@ For full syntax, conditionals, loops, and advanced features:
         if (exprtk::parser<T> parser; !parser.compile(expr_string, _expression)) {
             throw gr::exception(detail::formatParserError(parser, expr_string), location);
         }
+        constexpr std::array<std::string_view, 2UZ> inputs{"x", "y"};
+        _vectorised = detail::compileVectorised<T>(*this, inputs, "z");
     }
 
     void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
@@ -210,11 +307,18 @@ For full syntax, conditionals, loops, and advanced features:
         _out = T(0);
     }
 
-    [[nodiscard]] constexpr T processOne(T input0, T input1) {
-        _in0 = input0;
-        _in1 = input1;
-        _out = _expression.value(); // evaluate expression, _out == 'y' defined to allow for recursion
-        return _out;
+    [[nodiscard]] work::Status processBulk(std::span<const T> input0, std::span<const T> input1, std::span<T> output) {
+        if (_vectorised) {
+            _vectorised->evaluate(std::array{input0, input1}, output);
+            return work::Status::OK;
+        }
+        for (std::size_t i = 0UZ; i < output.size(); ++i) {
+            _in0      = input0[i];
+            _in1      = input1[i];
+            _out      = _expression.value(); // evaluate expression, _out == 'z' defined to allow for recursion
+            output[i] = _out;
+        }
+        return work::Status::OK;
     }
 };
 static_assert(std::is_constructible_v<ExpressionDISO<float>, property_map>, "Block type ExpressionDISO must be constructible from property_map");
@@ -226,6 +330,9 @@ struct ExpressionBulk : Block<ExpressionBulk<T>> {
 
 This block uses ExprTK to process arrays of input samples (`vecIn`) and produce arrays of output samples (`vecOut`) per work call.
 The user-defined expression can manipulate entire arrays at once.
+`vecIn` and `vecOut` reference the input/output buffer memory directly (in slices of at most 65536 samples), unless the expression
+writes to `vecIn` or reads `vecOut` (i.e. carries state across calls), for which private copies are kept. Output samples that are not
+written (e.g. `vecOut[0] := vecIn[0]`, or assignments in conditional branches) are zero unless `vecOut` is read.
 
 For example:
 - `vecOut := a * vecIn;`                  (simple scaling of all input samples)
@@ -251,17 +358,18 @@ For full syntax, conditionals, loops, and advanced features:
 
     GR_MAKE_REFLECTABLE(ExpressionBulk, in, out, expr_string, param_a, param_b, param_c, runtime_checks);
 
-    // vector_views that reference _vecInData and _vecOutData
-    // will be registered once and then just rebased as needed.
-    // N.B. _maxBaseSize limits the maximum chunk size and needs
-    // to be defined in-advance due to ExprTk constraints
+    // vector_views are registered once and then rebased onto the input/output buffer memory (or _vecInData/_vecOutData) as needed.
+    // N.B. _maxBaseSize limits the maximum slice size and needs to be defined in-advance due to ExprTk constraints
     std::array<T, 1UZ>           _arrOutDummy{T(0)}; // only needed for initialising
     static constexpr std::size_t _maxBaseSize = 1UZ << 16;
     exprtk::vector_view<T>       _vecIn       = exprtk::make_vector_view<T>(_arrOutDummy.data(), _maxBaseSize);
     exprtk::vector_view<T>       _vecOut      = exprtk::make_vector_view<T>(_arrOutDummy.data(), _maxBaseSize);
 
-    std::vector<T>            _vecInData{};
-    std::vector<T>            _vecOutData{};
+    std::vector<T>            _vecInData{};  // copy of the input, only used if the expression writes to 'vecIn'
+    std::vector<T>            _vecOutData{}; // persistent output, only used if the expression reads 'vecOut'
+    bool                      _copyIn  = false;
+    bool                      _copyOut = false;
+    bool                      _zeroOut = false; // output buffer is zeroed before the evaluation if 'vecOut' may be written only partially
     detail::vector_access_rtc _vec_rtc{};
     exprtk::symbol_table<T>   _symbol_table{};
     exprtk::expression<T>     _expression{};
@@ -277,11 +385,8 @@ For full syntax, conditionals, loops, and advanced features:
             _vecOutData.resize(1UZ);
         }
 
-        // rebase vector views to current data
-        _vecIn.rebase(_vecInData.data());
-        _vecIn.set_size(_vecInData.size());
-        _vecOut.rebase(_vecOutData.data());
-        _vecOut.set_size(_vecOutData.size());
+        // rebase vector views to internal data for compilation
+        rebaseVectors(_vecInData.data(), _vecOutData.data(), std::min(_vecInData.size(), _vecOutData.size()));
 
         _symbol_table.add_vector("vecIn", _vecIn);
         _symbol_table.add_vector("vecOut", _vecOut);
@@ -295,6 +400,7 @@ For full syntax, conditionals, loops, and advanced features:
 
         exprtk::parser<T> parser;
         if (runtime_checks) {
+            _vec_rtc.vector_map.clear();
             _vec_rtc.vector_map[_vecIn.data()]  = "vecIn";
             _vec_rtc.vector_map[_vecOut.data()] = "vecOut";
             parser.register_vector_access_runtime_check(_vec_rtc);
@@ -303,6 +409,21 @@ For full syntax, conditionals, loops, and advanced features:
         if (!parser.compile(expr_string, _expression)) {
             throw gr::exception(detail::formatParserError(parser, expr_string), location);
         }
+        const detail::VectorUsage outUsage = detail::vectorUsage(expr_string.value, "vecOut");
+        _copyIn                            = detail::vectorUsage(expr_string.value, "vecIn").written; // N.B. the input buffer is read-only
+        _copyOut                           = outUsage.read;                                          // N.B. the output buffer does not retain previous results
+        _zeroOut                           = !_copyOut && !outUsage.overwritten;                     // N.B. otherwise stale buffer contents would be published
+    }
+
+    void rebaseVectors(T* vecIn, T* vecOut, std::size_t size) {
+        if (runtime_checks) {
+            _vec_rtc.rebase(_vecIn.data(), vecIn);
+            _vec_rtc.rebase(_vecOut.data(), vecOut);
+        }
+        _vecIn.rebase(vecIn);
+        _vecIn.set_size(size);
+        _vecOut.rebase(vecOut);
+        _vecOut.set_size(size);
     }
 
     void settingsChanged(const gr::property_map& /*oldSettings*/, const gr::property_map& newSettings) {
@@ -314,30 +435,35 @@ For full syntax, conditionals, loops, and advanced features:
     void start() { initExpression(); }
 
     work::Status processBulk(InputSpanLike auto& inputSpan, OutputSpanLike auto& outputSpan) {
-        if (inputSpan.size() != _vecInData.size() || outputSpan.size() != _vecOutData.size()) {
-            _vecInData.resize(std::min(inputSpan.size(), _maxBaseSize));
-            _vecOutData.resize(std::min(outputSpan.size(), _maxBaseSize));
-
-            // rebase vector views to new internal memory storage of backing buffer vectors
-            _vecIn.rebase(_vecInData.data());
-            _vecIn.set_size(_vecInData.size());
-            _vecOut.rebase(_vecOutData.data());
-            _vecOut.set_size(_vecOutData.size());
-
-            if (runtime_checks) {
-                _vec_rtc.vector_map.clear();
-                _vec_rtc.vector_map[_vecIn.data()]  = "vecIn";
-                _vec_rtc.vector_map[_vecOut.data()] = "vecOut";
+        const std::size_t nSamples = std::min(inputSpan.size(), outputSpan.size());
+        const T*          inData   = std::ranges::data(inputSpan);
+        T*                outData  = std::ranges::data(outputSpan);
+
+        for (std::size_t offset = 0UZ; offset < nSamples; offset += _maxBaseSize) {
+            const std::size_t n = std::min(_maxBaseSize, nSamples - offset);
+
+            T* vecIn = const_cast<T*>(inData + offset); // N.B. only if the expression does not write to 'vecIn'
+            if (_copyIn) {
+                _vecInData.assign(inData + offset, inData + offset + n);
+                vecIn = _vecInData.data();
+            }
+            T* vecOut = outData + offset;
+            if (_copyOut) {
+                _vecOutData.resize(n);
+                vecOut = _vecOutData.data();
+            } else if (_zeroOut) {
+                std::fill_n(vecOut, n, T(0));
             }
-        }
 
-        using PtrDiff_t = std::iter_difference_t<decltype(inputSpan.begin())>;
-        std::ranges::copy_n(inputSpan.begin(), static_cast<PtrDiff_t>(_vecInData.size()), _vecInData.begin());
-        _expression.value(); // evaluate expression, exception handled by caller
-        std::ranges::copy_n(_vecOutData.begin(), static_cast<PtrDiff_t>(_vecOutData.size()), outputSpan.begin());
+            rebaseVectors(vecIn, vecOut, n);
+            _expression.value(); // evaluate expression, exception handled by caller
+            if (_copyOut) {
+                std::copy_n(_vecOutData.begin(), n, outData + offset);
+            }
+        }
 
-        std::ignore = inputSpan.consume(_vecInData.size());
-        outputSpan.publish(_vecOutData.size());
+        std::ignore = inputSpan.consume(nSamples);
+        outputSpan.publish(nSamples);
         return work::Status::OK;
     }
 };
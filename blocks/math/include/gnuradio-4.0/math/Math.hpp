@@ -1,9 +1,16 @@
 #ifndef GNURADIO_MATH_HPP
 #define GNURADIO_MATH_HPP
 
+#include <algorithm>
+#include <array>
+#include <complex>
+#include <functional>
+#include <ranges>
+
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/DataSet.hpp>
+#include <gnuradio-4.0/meta/FixedPoint.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
 namespace gr::blocks::math {
@@ -19,18 +26,140 @@ T defaultValue() noexcept {
         return T{};
     }
 }
+
+template<typename Op>
+struct transparent_op {
+    using type = Op;
+};
+template<typename T>
+struct transparent_op<std::plus<T>> {
+    using type = std::plus<>;
+};
+template<typename T>
+struct transparent_op<std::minus<T>> {
+    using type = std::minus<>;
+};
+template<typename T>
+struct transparent_op<std::multiplies<T>> {
+    using type = std::multiplies<>;
+};
+template<typename T>
+struct transparent_op<std::divides<T>> {
+    using type = std::divides<>;
+};
+
+/// out[i] = ((input(0)[i] op input(1)[i]) op input(2)[i]) op ... computed in a single pass, i.e. every SIMD block is folded over all
+/// inputs in registers rather than re-reading and re-writing 'out' once per input
+template<typename Op, typename T, typename FncInput>
+void foldInputs(std::size_t nInputs, FncInput&& input, T* out, std::size_t nSamples) noexcept {
+    using V = vir::stdx::native_simd<T>;
+    constexpr typename transparent_op<Op>::type simdOp{};
+
+    const std::size_t nSimd = nSamples - nSamples % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        V accumulator(input(0UZ) + i, vir::stdx::element_aligned);
+        for (std::size_t k = 1UZ; k < nInputs; ++k) {
+            accumulator = simdOp(accumulator, V(input(k) + i, vir::stdx::element_aligned));
+        }
+        accumulator.copy_to(out + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < nSamples; ++i) {
+        T accumulator = input(0UZ)[i];
+        for (std::size_t k = 1UZ; k < nInputs; ++k) {
+            accumulator = Op{}(accumulator, input(k)[i]);
+        }
+        out[i] = accumulator;
+    }
+}
+
+/// complex variant of foldInputs(...) for std::multiplies, operating on interleaved (re, im) pairs: the SIMD registers hold the
+/// de-interleaved real and imaginary parts, N.B. the NaN/inf recovery of std::complex (C99 Annex G) is only applied to the remainder
+template<std::floating_point T, typename FncInput>
+void foldComplexMultiply(std::size_t nInputs, FncInput&& input, T* out, std::size_t nSamples) noexcept {
+    using V         = vir::stdx::native_simd<T>;
+    const auto load = [](const T* pairs) { return std::pair<V, V>{V([pairs](auto j) { return pairs[2UZ * j]; }), V([pairs](auto j) { return pairs[2UZ * j + 1UZ]; })}; };
+
+    const std::size_t nSimd = nSamples - nSamples % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        auto [re, im] = load(input(0UZ) + 2UZ * i);
+        for (std::size_t k = 1UZ; k < nInputs; ++k) {
+            const auto [otherRe, otherIm] = load(input(k) + 2UZ * i);
+            const V product               = re * otherRe - im * otherIm;
+            im                            = re * otherIm + im * otherRe;
+            re                            = product;
+        }
+        std::array<T, V::size()> reArray;
+        std::array<T, V::size()> imArray;
+        re.copy_to(reArray.data(), vir::stdx::element_aligned);
+        im.copy_to(imArray.data(), vir::stdx::element_aligned);
+        for (std::size_t j = 0UZ; j < V::size(); ++j) {
+            out[2UZ * (i + j)]       = reArray[j];
+            out[2UZ * (i + j) + 1UZ] = imArray[j];
+        }
+    }
+    for (std::size_t i = nSimd; i < nSamples; ++i) {
+        std::complex<T> accumulator(input(0UZ)[2UZ * i], input(0UZ)[2UZ * i + 1UZ]);
+        for (std::size_t k = 1UZ; k < nInputs; ++k) {
+            accumulator *= std::complex<T>(input(k)[2UZ * i], input(k)[2UZ * i + 1UZ]);
+        }
+        out[2UZ * i]       = accumulator.real();
+        out[2UZ * i + 1UZ] = accumulator.imag();
+    }
+}
+
+/// fixed-point variant of foldInputs(...): as every operation saturates (i.e. the result depends on the evaluation order), the inputs
+/// are folded pair-wise with the gr::fixed_point SIMD kernels, chunk-by-chunk to keep 'out' cache-resident across all inputs
+template<typename Op, FixedPointLike T, typename FncInput>
+void foldFixedPoint(std::size_t nInputs, FncInput&& input, std::span<T> out) noexcept {
+    constexpr std::size_t kChunkSize = 4096UZ;
+    const auto            apply      = [](std::span<const T> lhs, std::span<const T> rhs, std::span<T> result) {
+        if constexpr (std::is_same_v<Op, std::plus<T>>) {
+            fixed_point::add(lhs, rhs, result);
+        } else if constexpr (std::is_same_v<Op, std::minus<T>>) {
+            fixed_point::subtract(lhs, rhs, result);
+        } else if constexpr (std::is_same_v<Op, std::multiplies<T>>) {
+            fixed_point::multiply(lhs, rhs, result);
+        } else {
+            std::ranges::transform(lhs, rhs, result.begin(), Op{});
+        }
+    };
+
+    for (std::size_t offset = 0UZ; offset < out.size(); offset += kChunkSize) {
+        const std::size_t n      = std::min(kChunkSize, out.size() - offset);
+        const auto        chunk  = [&input, offset, n](std::size_t k) { return std::span<const T>(input(k) + offset, n); };
+        const auto        result = out.subspan(offset, n);
+        if (nInputs == 1UZ) {
+            std::ranges::copy(chunk(0UZ), result.begin());
+            continue;
+        }
+        apply(chunk(0UZ), chunk(1UZ), result);
+        for (std::size_t k = 2UZ; k < nInputs; ++k) {
+            apply(result, chunk(k), result);
+        }
+    }
+}
 } // namespace detail
 
 template<typename T, char op>
 struct MathOpImpl : public gr::Block<MathOpImpl<T, op>> {
+    using Description = Doc<R""(
+    @brief Math block applying a constant to every sample: out = in <op> value (op: +, -, *, /)
+
+    For fixed-point types (e.g. gr::Q15) 'value' is set as double: gains (*, /) are applied at 32-bit precision (i.e. also values >= 1
+    and the default identity 1.0 are exact, see gr::fixed_point::scale), offsets (+, -) are quantised (and saturated) to T.
+    )"">;
+    using value_type = std::conditional_t<FixedPointLike<T>, double, T>;
+
     PortIn<T>  in;
     PortOut<T> out;
-    T          value = detail::defaultValue<T>();
+    value_type value = detail::defaultValue<value_type>();
 
     GR_MAKE_REFLECTABLE(MathOpImpl, in, out, value);
 
     template<gr::meta::t_or_simd<T> V>
-    [[nodiscard]] constexpr V processOne(const V& a) const noexcept {
+    [[nodiscard]] constexpr V processOne(const V& a) const noexcept
+    requires(not FixedPointLike<T>)
+    {
         if constexpr (op == '*') {
             return a * value;
         } else if constexpr (op == '/') {
@@ -44,6 +173,27 @@ struct MathOpImpl : public gr::Block<MathOpImpl<T, op>> {
             return V{};
         }
     }
+
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) const noexcept
+    requires FixedPointLike<T>
+    {
+        if constexpr (op == '*') {
+            fixed_point::scale(input, value, output);
+        } else if constexpr (op == '/') {
+            if (value != 0.0) {
+                fixed_point::scale(input, 1.0 / value, output);
+            } else { // saturating division-by-zero semantics of T
+                std::ranges::transform(input.first(output.size()), output.begin(), [](T a) { return a / T{}; });
+            }
+        } else if constexpr (op == '+') {
+            fixed_point::add(input, T(value), output);
+        } else if constexpr (op == '-') {
+            fixed_point::subtract(input, T(value), output);
+        } else {
+            static_assert(gr::meta::always_false<T>, "unknown op");
+        }
+        return work::Status::OK;
+    }
 };
 
 template<typename T>
@@ -56,7 +206,7 @@ template<typename T>
 using DivideConst = MathOpImpl<T, '/'>;
 
 template<typename T, typename op>
-requires(std::is_arithmetic_v<T>)
+requires(std::is_arithmetic_v<T> || meta::complex_like<T> || FixedPointLike<T>)
 struct MathOpMultiPortImpl : public gr::Block<MathOpMultiPortImpl<T, op>> {
     using Description = Doc<R""(
     @brief Math block combining multiple inputs into a single output with a given operation
@@ -66,6 +216,9 @@ struct MathOpMultiPortImpl : public gr::Block<MathOpMultiPortImpl<T, op>> {
     - Divide: out = in_1 / in_2 / in_3 / ...
     - Add: out = in_1 + in_2 + in_3 + ...
     - Subtract: out = in_1 - in_2 - in_3 - ...
+
+    All inputs are combined in a single pass (SIMD-vectorised for arithmetic and complex types). Fixed-point types (e.g. gr::Q15)
+    saturate after every operation, i.e. are evaluated in the above order.
     )"">;
 
     // ports
@@ -85,9 +238,29 @@ struct MathOpMultiPortImpl : public gr::Block<MathOpMultiPortImpl<T, op>> {
 
     template<gr::InputSpanLike TInSpan>
     gr::work::Status processBulk(const std::span<TInSpan>& ins, gr::OutputSpanLike auto& sout) const {
-        std::copy(ins[0].begin(), ins[0].end(), sout.begin());
-        for (std::size_t n = 1; n < ins.size(); n++) {
-            std::transform(sout.begin(), sout.end(), ins[n].begin(), sout.begin(), op{});
+        const std::size_t nSamples = sout.size();
+        if constexpr (meta::complex_like<T>) {
+            using value_type = typename T::value_type;
+            // N.B. std::complex<value_type> is layout-compatible with value_type[2]
+            const auto input  = [&ins](std::size_t k) { return reinterpret_cast<const value_type*>(std::ranges::data(ins[k])); };
+            auto*      output = reinterpret_cast<value_type*>(std::ranges::data(sout));
+            if constexpr (std::is_same_v<op, std::plus<T>> || std::is_same_v<op, std::minus<T>>) { // component-wise
+                detail::foldInputs<std::conditional_t<std::is_same_v<op, std::plus<T>>, std::plus<value_type>, std::minus<value_type>>>(ins.size(), input, output, 2UZ * nSamples);
+            } else if constexpr (std::is_same_v<op, std::multiplies<T>>) {
+                detail::foldComplexMultiply(ins.size(), input, output, nSamples);
+            } else { // N.B. keeps the scaled division of std::complex, but still in a single pass over all inputs
+                for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                    T accumulator = ins[0UZ][i];
+                    for (std::size_t k = 1UZ; k < ins.size(); ++k) {
+                        accumulator = op{}(accumulator, ins[k][i]);
+                    }
+                    sout[i] = accumulator;
+                }
+            }
+        } else if constexpr (FixedPointLike<T>) {
+            detail::foldFixedPoint<op>(ins.size(), [&ins](std::size_t k) { return std::ranges::data(ins[k]); }, std::span<T>(std::ranges::data(sout), nSamples));
+        } else {
+            detail::foldInputs<op>(ins.size(), [&ins](std::size_t k) { return std::ranges::data(ins[k]); }, std::ranges::data(sout), nSamples);
         }
         return gr::work::Status::OK;
     }
@@ -105,14 +278,14 @@ using Divide = MathOpMultiPortImpl<T, std::divides<T>>;
 } // namespace gr::blocks::math
 
 // clang-format off
-const inline auto registerConstMath = gr::registerBlock<gr::blocks::math::AddConst,      uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
-                                    | gr::registerBlock<gr::blocks::math::SubtractConst, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
-                                    | gr::registerBlock<gr::blocks::math::MultiplyConst, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
-                                    | gr::registerBlock<gr::blocks::math::DivideConst,   uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry());
-const inline auto registerMultiMath = gr::registerBlock<gr::blocks::math::Add,      uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
-                                    | gr::registerBlock<gr::blocks::math::Subtract, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
-                                    | gr::registerBlock<gr::blocks::math::Multiply, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
-                                    | gr::registerBlock<gr::blocks::math::Divide,   uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry());
+const inline auto registerConstMath = gr::registerBlock<gr::blocks::math::AddConst,      uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
+                                    | gr::registerBlock<gr::blocks::math::SubtractConst, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
+                                    | gr::registerBlock<gr::blocks::math::MultiplyConst, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
+                                    | gr::registerBlock<gr::blocks::math::DivideConst,   uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::complex<float>, std::complex<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry());
+const inline auto registerMultiMath = gr::registerBlock<gr::blocks::math::Add,      uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
+                                    | gr::registerBlock<gr::blocks::math::Subtract, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
+                                    | gr::registerBlock<gr::blocks::math::Multiply, uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry())
+                                    | gr::registerBlock<gr::blocks::math::Divide,   uint8_t, uint16_t, uint32_t, uint64_t, int8_t, int16_t, int32_t, int64_t, float, double, std::complex<float>, std::complex<double>, gr::Q15, gr::Q31 /*, gr::UncertainValue<float>, gr::UncertainValue<double>, std::string, gr::Packet<float>, gr::Packet<double>, gr::Tensor<float>, gr::Tensor<double>, gr::DataSet<float>, gr::DataSet<double> */>(gr::globalBlockRegistry());
 // clang-format on
 
 #endif // GNURADIO_MATH_HPP
@@ -6,6 +6,7 @@
 #include <gnuradio-4.0/Block.hpp>
 #include <gnuradio-4.0/BlockRegistry.hpp>
 #include <gnuradio-4.0/Port.hpp>
+#include <gnuradio-4.0/algorithm/NCO.hpp>
 #include <gnuradio-4.0/annotated.hpp>
 #include <gnuradio-4.0/meta/utils.hpp>
 #include <numbers>
@@ -21,6 +22,7 @@ struct Rotator : gr::Block<Rotator<T>> {
 
 This block supports either `phase_increment` in radians per sample (x) or relative `frequency_shift` in Hz for a
 given 'sample_rate' in Hz (N.B sample_rate is normalised to '1' by default).
+The phase is tracked by a 64-bit integer phase accumulator (see gr::algorithm::NCO), i.e. it does not drift over long runs.
  )"">;
 
     PortIn<T>  in;
@@ -31,7 +33,7 @@ given 'sample_rate' in Hz (N.B sample_rate is normalised to '1' by default).
     Annotated<value_type, "phase_increment", Unit<"rad">, Doc<"how many radians to add per sample">> phase_increment{0};
     Annotated<value_type, "initial_phase", Unit<"rad">, Doc<"starting offset for each new chunk">>   initial_phase{0};
 
-    value_type _accumulated_phase{0};
+    gr::algorithm::NCO<value_type> _nco;
 
     GR_MAKE_REFLECTABLE(Rotator, in, out, sample_rate, frequency_shift, initial_phase, phase_increment);
 
@@ -43,19 +45,13 @@ given 'sample_rate' in Hz (N.B sample_rate is normalised to '1' by default).
         } else if (newSettings.contains("frequency_shift") && newSettings.contains("phase_increment")) {
             throw gr::exception(fmt::format("cannot set both 'frequency_shift' and 'phase_increment' in new setting (XOR): {}", newSettings));
         }
-        _accumulated_phase = initial_phase;
+        _nco.setPhaseIncrement(static_cast<double>(phase_increment));
+        _nco.setPhase(static_cast<double>(initial_phase) + static_cast<double>(phase_increment)); // first output sample is already advanced by one increment
     }
 
-    [[nodiscard]] constexpr T processOne(const T& inSample) noexcept {
-        _accumulated_phase += phase_increment;
-        // optional: wrap angle if too large
-        if (_accumulated_phase > value_type(2) * std::numbers::pi_v<value_type>) {
-            _accumulated_phase -= value_type(2) * std::numbers::pi_v<value_type>;
-        } else if (_accumulated_phase < value_type(0)) {
-            _accumulated_phase += value_type(2) * std::numbers::pi_v<value_type>;
-        }
-
-        return inSample * std::complex<value_type>(std::cos(_accumulated_phase), std::sin(_accumulated_phase));
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) noexcept {
+        _nco.mix(input, output);
+        return work::Status::OK;
     }
 };
 
@@ -0,0 +1,124 @@
+#ifndef GNURADIO_SLIDINGSTATISTICS_HPP
+#define GNURADIO_SLIDINGSTATISTICS_HPP
+
+#include <concepts>
+#include <span>
+#include <type_traits>
+
+#include <gnuradio-4.0/Block.hpp>
+#include <gnuradio-4.0/BlockRegistry.hpp>
+#include <gnuradio-4.0/annotated.hpp>
+#include <gnuradio-4.0/algorithm/SlidingWindowStatistics.hpp>
+
+namespace gr::blocks::math {
+
+enum class Statistic { Mean, Rms, Variance, StdDev, Min, Max, Quantile };
+
+template<typename T, Statistic statistic>
+requires std::floating_point<T>
+struct SlidingStatisticImpl : Block<SlidingStatisticImpl<T, statistic>, Resampling<1UZ, 1UZ, false>> {
+    using Description = Doc<R""(
+@brief Running statistic (mean, RMS, variance, standard deviation, minimum, maximum or quantile) over the last 'window_size' samples.
+
+The statistic is updated incrementally rather than re-computed over the whole window for every sample (see gr::algorithm):
+ * mean, RMS, variance and standard deviation: sliding Welford/Chan moments with SIMD block updates, O(1) per sample,
+ * minimum and maximum: monotonic deque, amortised O(1) per sample,
+ * quantile: exact two-multiset partition of the window, O(log(window_size)) per sample.
+One output sample is published at the end of every 'decimation' input samples. Until the window is filled, the statistic
+covers all samples received so far. N.B. the variance is the population variance of the window.
+ )"">;
+
+    PortIn<T>  in;
+    PortOut<T> out;
+
+    Annotated<gr::Size_t, "window size", Doc<"number of samples the statistic is computed over">, Visible>  window_size = 1024U;
+    Annotated<gr::Size_t, "decimation", Doc<"one output sample every 'decimation' input samples">, Visible> decimation  = 1U;
+    Annotated<float, "quantile", Doc<"quantile in [0, 1] (N.B. Quantile only), e.g. 0.5 for the median">>   quantile    = 0.5f;
+
+    GR_MAKE_REFLECTABLE(SlidingStatisticImpl, in, out, window_size, decimation, quantile);
+
+    using Estimator = std::conditional_t<statistic == Statistic::Min, gr::algorithm::SlidingMinimum<T>, //
+        std::conditional_t<statistic == Statistic::Max, gr::algorithm::SlidingMaximum<T>,              //
+            std::conditional_t<statistic == Statistic::Quantile, gr::algorithm::SlidingQuantile<T>, gr::algorithm::SlidingMoments<T>>>>;
+
+    Estimator _estimator{1UZ};
+
+    void settingsChanged(const property_map& /*oldSettings*/, const property_map& newSettings) {
+        if (window_size == 0U || decimation == 0U) {
+            throw gr::exception(fmt::format("window_size ({}) and decimation ({}) must be > 0", window_size, decimation));
+        }
+        if constexpr (statistic == Statistic::Quantile) {
+            if (!(quantile >= 0.f && quantile <= 1.f)) {
+                throw gr::exception(fmt::format("quantile {} is outside [0, 1]", quantile));
+            }
+        }
+        // N.B. re-creating the estimator discards the window, i.e. only if its definition changed (e.g. not for 'decimation')
+        if (newSettings.contains("window_size") || newSettings.contains("quantile") || _estimator.windowSize() != static_cast<std::size_t>(window_size)) {
+            if constexpr (statistic == Statistic::Quantile) {
+                _estimator = Estimator(static_cast<std::size_t>(window_size), static_cast<T>(quantile));
+            } else {
+                _estimator = Estimator(static_cast<std::size_t>(window_size));
+            }
+        }
+        this->input_chunk_size = decimation;
+    }
+
+    void reset() { _estimator.reset(); }
+
+    [[nodiscard]] T value() const noexcept {
+        if constexpr (statistic == Statistic::Mean) {
+            return _estimator.mean();
+        } else if constexpr (statistic == Statistic::Rms) {
+            return _estimator.rms();
+        } else if constexpr (statistic == Statistic::Variance) {
+            return _estimator.variance();
+        } else if constexpr (statistic == Statistic::StdDev) {
+            return _estimator.stddev();
+        } else {
+            return _estimator.value();
+        }
+    }
+
+    [[nodiscard]] work::Status processBulk(std::span<const T> input, std::span<T> output) {
+        const std::size_t decimate = static_cast<std::size_t>(decimation);
+        const std::size_t nOutputs = std::min(input.size() / decimate, output.size());
+        for (std::size_t i = 0UZ; i < nOutputs; ++i) {
+            if (decimate == 1UZ) {
+                _estimator.push_back(input[i]);
+            } else {
+                _estimator.push_back_bulk(input.subspan(i * decimate, decimate));
+            }
+            output[i] = value();
+        }
+        return work::Status::OK;
+    }
+};
+
+template<typename T>
+using MovingAverage = SlidingStatisticImpl<T, Statistic::Mean>;
+template<typename T>
+using MovingRms = SlidingStatisticImpl<T, Statistic::Rms>;
+template<typename T>
+using MovingVariance = SlidingStatisticImpl<T, Statistic::Variance>;
+template<typename T>
+using MovingStdDev = SlidingStatisticImpl<T, Statistic::StdDev>;
+template<typename T>
+using MovingMin = SlidingStatisticImpl<T, Statistic::Min>;
+template<typename T>
+using MovingMax = SlidingStatisticImpl<T, Statistic::Max>;
+template<typename T>
+using MovingQuantile = SlidingStatisticImpl<T, Statistic::Quantile>;
+
+} // namespace gr::blocks::math
+
+// clang-format off
+const inline auto registerSlidingStatistics = gr::registerBlock<gr::blocks::math::MovingAverage,  float, double>(gr::globalBlockRegistry())
+                                            | gr::registerBlock<gr::blocks::math::MovingRms,      float, double>(gr::globalBlockRegistry())
+                                            | gr::registerBlock<gr::blocks::math::MovingVariance, float, double>(gr::globalBlockRegistry())
+                                            | gr::registerBlock<gr::blocks::math::MovingStdDev,   float, double>(gr::globalBlockRegistry())
+                                            | gr::registerBlock<gr::blocks::math::MovingMin,      float, double>(gr::globalBlockRegistry())
+                                            | gr::registerBlock<gr::blocks::math::MovingMax,      float, double>(gr::globalBlockRegistry())
+                                            | gr::registerBlock<gr::blocks::math::MovingQuantile, float, double>(gr::globalBlockRegistry());
+// clang-format on
+
+#endif // GNURADIO_SLIDINGSTATISTICS_HPP
@@ -0,0 +1,527 @@
+#ifndef GNURADIO_VECTORISEDEXPRESSION_HPP
+#define GNURADIO_VECTORISEDEXPRESSION_HPP
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <charconv>
+#include <cmath>
+#include <concepts>
+#include <cstdint>
+#include <initializer_list>
+#include <limits>
+#include <numbers>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <vector>
+
+#include <vir/simd.h>
+
+namespace gr::blocks::math::detail {
+
+/**
+ * @brief vectorised evaluator for the arithmetic subset of ExprTk expressions, e.g. calibration curves such as `a*x^2 + b*x + c`.
+ *
+ * The expression is parsed into a small constant-folded AST and lowered to register instructions that each process a block of
+ * up to `kBlockSize` samples: the interpretation overhead is paid once per block rather than once per sample and node (as for
+ * `exprtk::expression<T>::value()`), and the arithmetic is computed in SIMD lanes.
+ *
+ * Supported are numbers, inputs, parameters, the constants `pi`, `epsilon` and `inf`, unary `+`/`-`, `+ - * / ^` (with ExprTk's
+ * precedence, i.e. `-x^2 == -(x^2)` and right-associative `^`), and the functions abs, sqrt, exp, log, log10, log2, sin, cos,
+ * tan, asin, acos, atan, sinh, cosh, tanh, floor, ceil, pow, atan2, min, max (two arguments) and clamp. Identifiers are
+ * case-insensitive, and an optional leading `<output> :=` and trailing `;` are accepted. `compile(..)` returns std::nullopt for
+ * anything else (conditionals, loops, multiple statements, references to the output, i.e. recursion, ...): callers fall back
+ * to ExprTk, which should also be used to validate the expression beforehand.
+ */
+template<std::floating_point T>
+class VectorisedExpression {
+public:
+    static constexpr std::size_t kBlockSize = 256UZ;
+
+    struct Parameter {
+        std::string_view name;
+        const T*         value; // N.B. read at each `evaluate(..)` call
+    };
+
+private:
+    using simd_type                    = vir::stdx::native_simd<T>;
+    static constexpr std::size_t kLane = simd_type::size();
+    static_assert(kBlockSize % kLane == 0UZ);
+
+    enum class Op : std::uint8_t { Constant, Input, Parameter, Neg, Add, Sub, Mul, Div, IPow, Pow, Min, Max, Clamp, Atan2, Abs, Sqrt, Exp, Log, Log10, Log2, Sin, Cos, Tan, Asin, Acos, Atan, Sinh, Cosh, Tanh, Floor, Ceil };
+    enum class Source : std::uint8_t { Register, Input, Scalar };
+
+    struct Operand {
+        Source      source = Source::Scalar;
+        std::size_t index  = 0UZ; // register, input or scalar index
+    };
+
+    struct Instruction {
+        Op                     op;
+        std::size_t            dst      = 0UZ;
+        std::array<Operand, 3> args     = {};
+        int                    exponent = 0; // Op::IPow
+    };
+
+    struct Node {
+        Op                         op;
+        T                          value = T(0); // Op::Constant, and the exponent of Op::IPow
+        std::size_t                index = 0UZ;  // Op::Input and Op::Parameter
+        std::array<std::size_t, 3> args  = {};
+        std::size_t                nArgs = 0UZ;
+    };
+
+    struct Function {
+        std::string_view name;
+        Op               op;
+        std::size_t      nArgs;
+    };
+
+    static constexpr std::array kFunctions{Function{"abs", Op::Abs, 1UZ}, Function{"sqrt", Op::Sqrt, 1UZ}, Function{"exp", Op::Exp, 1UZ}, Function{"log", Op::Log, 1UZ}, Function{"log10", Op::Log10, 1UZ}, //
+        Function{"log2", Op::Log2, 1UZ}, Function{"sin", Op::Sin, 1UZ}, Function{"cos", Op::Cos, 1UZ}, Function{"tan", Op::Tan, 1UZ}, Function{"asin", Op::Asin, 1UZ}, Function{"acos", Op::Acos, 1UZ},    //
+        Function{"atan", Op::Atan, 1UZ}, Function{"sinh", Op::Sinh, 1UZ}, Function{"cosh", Op::Cosh, 1UZ}, Function{"tanh", Op::Tanh, 1UZ}, Function{"floor", Op::Floor, 1UZ},                           //
+        Function{"ceil", Op::Ceil, 1UZ}, Function{"pow", Op::Pow, 2UZ}, Function{"atan2", Op::Atan2, 2UZ}, Function{"min", Op::Min, 2UZ}, Function{"max", Op::Max, 2UZ}, Function{"clamp", Op::Clamp, 3UZ}};
+
+    static constexpr int kMaxIntegerExponent = 60; // same limit as ExprTk's fast integer power
+
+    std::vector<Instruction> _program;
+    std::size_t              _result  = 0UZ;
+    std::size_t              _nInputs = 0UZ;
+    std::vector<const T*>    _parameters;
+    std::vector<T>           _scalars;   // parameters followed by literals
+    std::vector<T>           _registers; // nRegisters x kBlockSize
+    std::vector<T>           _inputTail; // padded inputs of the last partial block
+
+public:
+    [[nodiscard]] static std::optional<VectorisedExpression> compile(std::string_view expression, std::span<const std::string_view> inputs, std::string_view output, std::span<const Parameter> parameters) {
+        Parser                           parser{.text = expression, .inputs = inputs, .output = output, .parameters = parameters};
+        const std::optional<std::size_t> root = parser.parse();
+        if (!root) {
+            return std::nullopt;
+        }
+        VectorisedExpression compiled;
+        compiled._nInputs = inputs.size();
+        for (const auto& parameter : parameters) {
+            compiled._parameters.push_back(parameter.value);
+            compiled._scalars.push_back(*parameter.value);
+        }
+        compiled.lower(parser.nodes, *root);
+        return compiled;
+    }
+
+    [[nodiscard]] std::size_t nInstructions() const noexcept { return _program.size(); }
+
+    template<std::size_t N>
+    void evaluate(const std::array<std::span<const T>, N>& inputs, std::span<T> output) {
+        assert(N == _nInputs);
+        std::ranges::transform(_parameters, _scalars.begin(), [](const T* value) { return *value; });
+
+        std::array<const T*, std::max(N, 1UZ)> blockInputs{};
+        for (std::size_t offset = 0UZ; offset < output.size(); offset += kBlockSize) {
+            const std::size_t n = std::min(kBlockSize, output.size() - offset);
+            for (std::size_t i = 0UZ; i < N; ++i) {
+                assert(inputs[i].size() >= output.size());
+                if (n == kBlockSize) {
+                    blockInputs[i] = inputs[i].data() + offset;
+                } else { // partial block: SIMD loads must not read beyond the input spans
+                    T* tail = _inputTail.data() + i * kBlockSize;
+                    std::copy_n(inputs[i].data() + offset, n, tail);
+                    blockInputs[i] = tail;
+                }
+            }
+
+            const std::size_t nPadded = (n + kLane - 1UZ) / kLane * kLane;
+            for (const Instruction& instruction : _program) {
+                execute(instruction, blockInputs.data(), nPadded);
+            }
+            std::copy_n(_registers.data() + _result * kBlockSize, n, output.data() + offset);
+        }
+    }
+
+private:
+    [[nodiscard]] const T* operandData(const Operand& operand, const T* const* inputs) const noexcept {
+        switch (operand.source) {
+        case Source::Register: return _registers.data() + operand.index * kBlockSize;
+        case Source::Input: return inputs[operand.index];
+        default: return nullptr; // scalars are broadcast
+        }
+    }
+
+    [[nodiscard]] simd_type loadSimd(const Operand& operand, const T* data, std::size_t i) const noexcept { return operand.source == Source::Scalar ? simd_type(_scalars[operand.index]) : simd_type(data + i, vir::stdx::element_aligned); }
+
+    [[nodiscard]] T loadScalar(const Operand& operand, const T* data, std::size_t i) const noexcept { return operand.source == Source::Scalar ? _scalars[operand.index] : data[i]; }
+
+    template<std::size_t nArgs, bool vectorised, typename Fnc>
+    void apply(const Instruction& instruction, const T* const* inputs, std::size_t n, Fnc&& fnc) {
+        T*                          dst = _registers.data() + instruction.dst * kBlockSize;
+        std::array<const T*, nArgs> src;
+        for (std::size_t k = 0UZ; k < nArgs; ++k) {
+            src[k] = operandData(instruction.args[k], inputs);
+        }
+        auto invoke = [&](auto load, std::size_t i) {
+            if constexpr (nArgs == 1UZ) {
+                return fnc(load(instruction.args[0], src[0], i));
+            } else if constexpr (nArgs == 2UZ) {
+                return fnc(load(instruction.args[0], src[0], i), load(instruction.args[1], src[1], i));
+            } else {
+                return fnc(load(instruction.args[0], src[0], i), load(instruction.args[1], src[1], i), load(instruction.args[2], src[2], i));
+            }
+        };
+        if constexpr (vectorised) {
+            for (std::size_t i = 0UZ; i < n; i += kLane) {
+                invoke([this](const Operand& op, const T* data, std::size_t j) { return loadSimd(op, data, j); }, i).copy_to(dst + i, vir::stdx::element_aligned);
+            }
+        } else { // transcendental functions: per-lane std:: calls
+            for (std::size_t i = 0UZ; i < n; ++i) {
+                dst[i] = invoke([this](const Operand& op, const T* data, std::size_t j) { return loadScalar(op, data, j); }, i);
+            }
+        }
+    }
+
+    template<typename U>
+    static U integerPower(U value, int exponent) noexcept { // same evaluation order as ExprTk's fast_exp
+        const bool negative = exponent < 0;
+        unsigned   k        = static_cast<unsigned>(negative ? -exponent : exponent);
+        U          result(T(1));
+        while (k != 0U) {
+            if ((k & 1U) != 0U) {
+                result *= value;
+                --k;
+            }
+            value *= value;
+            k >>= 1U;
+        }
+        return negative ? U(T(1)) / result : result;
+    }
+
+    template<typename U>
+    static U minimum(U a, U b) noexcept { // same NaN semantics as std::min
+        if constexpr (std::same_as<U, T>) {
+            return std::min(a, b);
+        } else {
+            vir::stdx::where(b < a, a) = b;
+            return a;
+        }
+    }
+
+    template<typename U>
+    static U maximum(U a, U b) noexcept { // same NaN semantics as std::max
+        if constexpr (std::same_as<U, T>) {
+            return std::max(a, b);
+        } else {
+            vir::stdx::where(a < b, a) = b;
+            return a;
+        }
+    }
+
+    template<typename U>
+    static U clamp(U lower, U x, U upper) noexcept { // ExprTk: x < lower ? lower : (x > upper ? upper : x)
+        if constexpr (std::same_as<U, T>) {
+            return x < lower ? lower : (x > upper ? upper : x);
+        } else {
+            U result                            = x;
+            vir::stdx::where(x > upper, result) = upper;
+            vir::stdx::where(x < lower, result) = lower;
+            return result;
+        }
+    }
+
+    template<typename U>
+    static U absolute(U a) noexcept {
+        if constexpr (std::same_as<U, T>) {
+            return std::abs(a);
+        } else {
+            vir::stdx::where(a < T(0), a) = -a;
+            return a;
+        }
+    }
+
+    [[nodiscard]] static T evaluateScalar(Op op, T a, T b, T c) noexcept {
+        switch (op) {
+        case Op::Neg: return -a;
+        case Op::Add: return a + b;
+        case Op::Sub: return a - b;
+        case Op::Mul: return a * b;
+        case Op::Div: return a / b;
+        case Op::IPow: return integerPower(a, static_cast<int>(b));
+        case Op::Pow: return std::pow(a, b);
+        case Op::Min: return minimum(a, b);
+        case Op::Max: return maximum(a, b);
+        case Op::Clamp: return clamp(a, b, c);
+        case Op::Atan2: return std::atan2(a, b);
+        case Op::Abs: return absolute(a);
+        case Op::Sqrt: return std::sqrt(a);
+        case Op::Exp: return std::exp(a);
+        case Op::Log: return std::log(a);
+        case Op::Log10: return std::log10(a);
+        case Op::Log2: return std::log2(a);
+        case Op::Sin: return std::sin(a);
+        case Op::Cos: return std::cos(a);
+        case Op::Tan: return std::tan(a);
+        case Op::Asin: return std::asin(a);
+        case Op::Acos: return std::acos(a);
+        case Op::Atan: return std::atan(a);
+        case Op::Sinh: return std::sinh(a);
+        case Op::Cosh: return std::cosh(a);
+        case Op::Tanh: return std::tanh(a);
+        case Op::Floor: return std::floor(a);
+        case Op::Ceil: return std::ceil(a);
+        default: return std::numeric_limits<T>::quiet_NaN();
+        }
+    }
+
+    void execute(const Instruction& instruction, const T* const* inputs, std::size_t n) {
+        switch (instruction.op) {
+        case Op::Neg: return apply<1, true>(instruction, inputs, n, [](auto a) { return -a; });
+        case Op::Add: return apply<2, true>(instruction, inputs, n, [](auto a, auto b) { return a + b; });
+        case Op::Sub: return apply<2, true>(instruction, inputs, n, [](auto a, auto b) { return a - b; });
+        case Op::Mul: return apply<2, true>(instruction, inputs, n, [](auto a, auto b) { return a * b; });
+        case Op::Div: return apply<2, true>(instruction, inputs, n, [](auto a, auto b) { return a / b; });
+        case Op::IPow: return apply<1, true>(instruction, inputs, n, [exponent = instruction.exponent](auto a) { return integerPower(a, exponent); });
+        case Op::Min: return apply<2, true>(instruction, inputs, n, [](auto a, auto b) { return minimum(a, b); });
+        case Op::Max: return apply<2, true>(instruction, inputs, n, [](auto a, auto b) { return maximum(a, b); });
+        case Op::Clamp: return apply<3, true>(instruction, inputs, n, [](auto lower, auto x, auto upper) { return clamp(lower, x, upper); });
+        case Op::Abs: return apply<1, true>(instruction, inputs, n, [](auto a) { return absolute(a); });
+        case Op::Pow:
+        case Op::Atan2: return apply<2, false>(instruction, inputs, n, [op = instruction.op](T a, T b) { return evaluateScalar(op, a, b, T(0)); });
+        default: return apply<1, false>(instruction, inputs, n, [op = instruction.op](T a) { return evaluateScalar(op, a, T(0), T(0)); });
+        }
+    }
+
+    /// leaves become operands of their parent's instruction, registers are recycled once consumed
+    void lower(const std::vector<Node>& nodes, std::size_t root) {
+        std::vector<std::size_t> freeRegisters;
+        std::size_t              nRegisters = 0UZ;
+        auto                     literal    = [this](T value) -> Operand {
+            _scalars.push_back(value);
+            return {Source::Scalar, _scalars.size() - 1UZ};
+        };
+
+        auto emit = [&](auto& self, std::size_t nodeIndex) -> Operand {
+            const Node& node = nodes[nodeIndex];
+            switch (node.op) {
+            case Op::Constant: return literal(node.value);
+            case Op::Input: return {Source::Input, node.index};
+            case Op::Parameter: return {Source::Scalar, node.index};
+            default: break;
+            }
+
+            Instruction instruction{.op = node.op, .exponent = static_cast<int>(node.value)};
+            for (std::size_t k = 0UZ; k < node.nArgs; ++k) {
+                instruction.args[k] = self(self, node.args[k]);
+            }
+            for (std::size_t k = 0UZ; k < node.nArgs; ++k) { // N.B. element-wise instructions may write in-place
+                if (instruction.args[k].source == Source::Register) {
+                    freeRegisters.push_back(instruction.args[k].index);
+                }
+            }
+            if (freeRegisters.empty()) {
+                instruction.dst = nRegisters++;
+            } else {
+                instruction.dst = freeRegisters.back();
+                freeRegisters.pop_back();
+            }
+            _program.push_back(instruction);
+            return {Source::Register, instruction.dst};
+        };
+
+        Operand result = emit(emit, root);
+        if (result.source != Source::Register) { // trivial expression, e.g. 'x' or 'a'
+            _program.push_back(Instruction{.op = Op::Add, .dst = 0UZ, .args = {result, literal(T(0)), Operand{}}});
+            result     = {Source::Register, 0UZ};
+            nRegisters = 1UZ;
+        }
+        _result = result.index;
+        _registers.resize(nRegisters * kBlockSize);
+        _inputTail.resize(_nInputs * kBlockSize);
+    }
+
+    struct Parser {
+        std::string_view                  text;
+        std::span<const std::string_view> inputs;
+        std::string_view                  output;
+        std::span<const Parameter>        parameters;
+        std::size_t                       pos = 0UZ;
+        std::vector<Node>                 nodes{};
+
+        std::optional<std::size_t> parse() {
+            const std::size_t start = pos;
+            if (!(equalsIgnoreCase(identifier(), output) && consumeAssignment())) { // optional '<output> :='
+                pos = start;
+            }
+
+            const std::optional<std::size_t> root = expression();
+            consume(';');
+            skipWhitespace();
+            return pos == text.size() ? root : std::nullopt;
+        }
+
+        static constexpr char toLower(char c) noexcept { return (c >= 'A' && c <= 'Z') ? static_cast<char>(c - 'A' + 'a') : c; }
+        static constexpr bool isAlpha(char c) noexcept { return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z') || c == '_'; }
+        static constexpr bool isDigit(char c) noexcept { return c >= '0' && c <= '9'; }
+
+        static bool equalsIgnoreCase(std::string_view lhs, std::string_view rhs) noexcept { //
+            return !lhs.empty() && std::ranges::equal(lhs, rhs, [](char a, char b) { return toLower(a) == toLower(b); });
+        }
+
+        void skipWhitespace() noexcept {
+            while (pos < text.size() && (text[pos] == ' ' || text[pos] == '\t' || text[pos] == '\n' || text[pos] == '\r')) {
+                ++pos;
+            }
+        }
+
+        bool peek(char c) noexcept {
+            skipWhitespace();
+            return pos < text.size() && text[pos] == c;
+        }
+
+        bool consume(char c) noexcept {
+            if (peek(c)) {
+                ++pos;
+                return true;
+            }
+            return false;
+        }
+
+        bool consumeAssignment() noexcept {
+            skipWhitespace();
+            if (text.substr(pos).starts_with(":=")) {
+                pos += 2UZ;
+                return true;
+            }
+            return false;
+        }
+
+        std::string_view identifier() noexcept {
+            skipWhitespace();
+            const std::size_t start = pos;
+            if (pos < text.size() && isAlpha(text[pos])) {
+                while (pos < text.size() && (isAlpha(text[pos]) || isDigit(text[pos]))) {
+                    ++pos;
+                }
+            }
+            return text.substr(start, pos - start);
+        }
+
+        std::size_t add(Node node) {
+            const bool isLeaf = node.op == Op::Constant || node.op == Op::Input || node.op == Op::Parameter;
+            if (!isLeaf && std::ranges::all_of(std::span(node.args).first(node.nArgs), [this](std::size_t i) { return nodes[i].op == Op::Constant; })) { // constant folding
+                const auto arg = [&](std::size_t k) { return k < node.nArgs ? nodes[node.args[k]].value : T(0); };
+                node           = Node{.op = Op::Constant, .value = evaluateScalar(node.op, arg(0UZ), node.op == Op::IPow ? node.value : arg(1UZ), arg(2UZ))};
+            }
+            nodes.push_back(node);
+            return nodes.size() - 1UZ;
+        }
+
+        std::size_t add(Op op, std::initializer_list<std::size_t> args) {
+            Node node{.op = op, .nArgs = args.size()};
+            std::ranges::copy(args, node.args.begin());
+            return add(node);
+        }
+
+        std::optional<std::size_t> expression() { // term (('+'|'-') term)*
+            std::optional<std::size_t> lhs = term();
+            while (lhs && (peek('+') || peek('-'))) {
+                const Op                         op  = text[pos++] == '+' ? Op::Add : Op::Sub;
+                const std::optional<std::size_t> rhs = term();
+                lhs                                  = rhs ? std::optional(add(op, {*lhs, *rhs})) : std::nullopt;
+            }
+            return lhs;
+        }
+
+        std::optional<std::size_t> term() { // unary (('*'|'/') unary)*
+            std::optional<std::size_t> lhs = unary();
+            while (lhs && (peek('*') || peek('/'))) {
+                const Op                         op  = text[pos++] == '*' ? Op::Mul : Op::Div;
+                const std::optional<std::size_t> rhs = unary();
+                lhs                                  = rhs ? std::optional(add(op, {*lhs, *rhs})) : std::nullopt;
+            }
+            return lhs;
+        }
+
+        std::optional<std::size_t> unary() { // ('+'|'-') unary | power
+            if (consume('+')) {
+                return unary();
+            }
+            if (consume('-')) {
+                const std::optional<std::size_t> operand = unary();
+                return operand ? std::optional(add(Op::Neg, {*operand})) : std::nullopt;
+            }
+            return power();
+        }
+
+        std::optional<std::size_t> power() { // primary ('^' unary)?, i.e. right-associative and binding tighter than unary minus
+            const std::optional<std::size_t> base = primary();
+            if (!base || !consume('^')) {
+                return base;
+            }
+            const std::optional<std::size_t> exponent = unary();
+            if (!exponent) {
+                return std::nullopt;
+            }
+            if (const Node& e = nodes[*exponent]; e.op == Op::Constant && e.value == std::trunc(e.value) && std::abs(e.value) <= T(kMaxIntegerExponent)) {
+                Node node{.op = Op::IPow, .value = e.value, .nArgs = 1UZ};
+                node.args[0] = *base;
+                return add(node);
+            }
+            return add(Op::Pow, {*base, *exponent});
+        }
+
+        std::optional<std::size_t> primary() {
+            if (consume('(')) {
+                const std::optional<std::size_t> inner = expression();
+                return inner && consume(')') ? inner : std::nullopt;
+            }
+            if (pos < text.size() && (isDigit(text[pos]) || text[pos] == '.')) {
+                T value{};
+                const auto [end, ec] = std::from_chars(text.data() + pos, text.data() + text.size(), value, std::chars_format::general);
+                if (ec != std::errc{}) {
+                    return std::nullopt;
+                }
+                pos = static_cast<std::size_t>(end - text.data());
+                return add(Node{.op = Op::Constant, .value = value});
+            }
+
+            const std::string_view name = identifier();
+            if (name.empty()) {
+                return std::nullopt;
+            }
+            if (consume('(')) {
+                const auto function = std::ranges::find_if(kFunctions, [name](const Function& f) { return equalsIgnoreCase(f.name, name); });
+                if (function == kFunctions.end()) {
+                    return std::nullopt;
+                }
+                Node node{.op = function->op, .nArgs = function->nArgs};
+                for (std::size_t k = 0UZ; k < node.nArgs; ++k) {
+                    const std::optional<std::size_t> arg = (k == 0UZ || consume(',')) ? expression() : std::nullopt;
+                    if (!arg) {
+                        return std::nullopt;
+                    }
+                    node.args[k] = *arg;
+                }
+                return consume(')') ? std::optional(add(node)) : std::nullopt;
+            }
+            if (const auto it = std::ranges::find_if(inputs, [name](std::string_view input) { return equalsIgnoreCase(input, name); }); it != inputs.end()) {
+                return add(Node{.op = Op::Input, .index = static_cast<std::size_t>(std::distance(inputs.begin(), it))});
+            }
+            if (const auto it = std::ranges::find_if(parameters, [name](const Parameter& p) { return equalsIgnoreCase(p.name, name); }); it != parameters.end()) {
+                return add(Node{.op = Op::Parameter, .index = static_cast<std::size_t>(std::distance(parameters.begin(), it))});
+            }
+            if (equalsIgnoreCase(name, "pi")) {
+                return add(Node{.op = Op::Constant, .value = std::numbers::pi_v<T>});
+            }
+            if (equalsIgnoreCase(name, "epsilon")) {
+                return add(Node{.op = Op::Constant, .value = std::numeric_limits<T>::epsilon()});
+            }
+            if (equalsIgnoreCase(name, "inf")) {
+                return add(Node{.op = Op::Constant, .value = std::numeric_limits<T>::infinity()});
+            }
+            return std::nullopt; // unknown symbol, or reference to the output (i.e. recursion)
+        }
+    };
+};
+
+} // namespace gr::blocks::math::detail
+
+#endif // GNURADIO_VECTORISEDEXPRESSION_HPP
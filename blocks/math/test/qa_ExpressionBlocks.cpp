@@ -53,6 +53,66 @@ const boost::ut::suite<"basic expression block tests"> basicMath = [] {
         expect(approx(tagSink._samples[0], T(42), T(1e-3f)));
     } | std::tuple<float, double>{};
 
+    "ExpressionSISO/DISO - vectorised vs. interpreted"_test = []<typename T>(const T&) {
+        constexpr std::size_t nSamples = 1003UZ; // N.B. not a multiple of the vectorised block size
+        std::vector<T>        in0(nSamples);
+        std::vector<T>        in1(nSamples);
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            in0[i] = T(-3) + T(6) * static_cast<T>(i) / static_cast<T>(nSamples);
+            in1[i] = std::sin(static_cast<T>(i));
+        }
+
+        auto compare = [](std::span<const T> vectorised, std::span<const T> interpreted, std::string_view expression) {
+            for (std::size_t i = 0UZ; i < vectorised.size(); ++i) {
+                const T tolerance = T(1e-5f) * std::max(T(1), std::abs(interpreted[i]));
+                if (!(std::isnan(vectorised[i]) && std::isnan(interpreted[i])) && std::abs(vectorised[i] - interpreted[i]) > tolerance) {
+                    expect(false) << fmt::format("'{}': vectorised[{}] = {} vs. interpreted {}", expression, i, vectorised[i], interpreted[i]);
+                    return;
+                }
+            }
+        };
+
+        for (const auto& [expression, isVectorised] : std::vector<std::pair<std::string, bool>>{{"y := a*x^2 + b*x + c", true}, {"-x^2 + 2^3^2", true}, {"Y := clamp(-1.0, sin(2 * pi * x) + cos(x / 2 * pi), +1.0)", true}, //
+                 {"y := exp(-x^2/2) / sqrt(2*pi) + min(x, a) - max(abs(x), b)", true}, {"y := pow(abs(x), 1.5) + x^-2 + atan2(x, c);", true},                                                         //
+                 {"y := y + 0.1*x", false}, {"y := x > 0 ? x : -x", false}, {"var t := 2*x; y := t", false}}) {
+            ExpressionSISO<T> block({{"expr_string", expression}, {"param_a", T(2)}, {"param_b", T(-0.5)}, {"param_c", T(3)}});
+            ExpressionSISO<T> reference({{"expr_string", expression}, {"param_a", T(2)}, {"param_b", T(-0.5)}, {"param_c", T(3)}});
+            std::ignore = block.settings().applyStagedParameters();
+            std::ignore = reference.settings().applyStagedParameters();
+            block.start();
+            reference.start();
+            expect(eq(block._vectorised.has_value(), isVectorised)) << expression;
+            reference._vectorised.reset(); // force the ExprTk interpreter
+
+            for (const T a : {T(2), T(-1)}) { // parameters are picked up without recompilation
+                block.param_a     = a;
+                reference.param_a = a;
+                std::vector<T> vectorised(nSamples);
+                std::vector<T> interpreted(nSamples);
+                expect(block.processBulk(in0, vectorised) == work::Status::OK);
+                expect(reference.processBulk(in0, interpreted) == work::Status::OK);
+                compare(vectorised, interpreted, expression);
+            }
+        }
+
+        for (const auto& [expression, isVectorised] : std::vector<std::pair<std::string, bool>>{{"z := a * (x + y + 2)", true}, {"sin(x) * cos(y) - floor(x) + ceil(y)", true}, {"z := z + (x - y)", false}}) {
+            ExpressionDISO<T> block({{"expr_string", expression}, {"param_a", T(3)}});
+            ExpressionDISO<T> reference({{"expr_string", expression}, {"param_a", T(3)}});
+            std::ignore = block.settings().applyStagedParameters();
+            std::ignore = reference.settings().applyStagedParameters();
+            block.start();
+            reference.start();
+            expect(eq(block._vectorised.has_value(), isVectorised)) << expression;
+            reference._vectorised.reset();
+
+            std::vector<T> vectorised(nSamples);
+            std::vector<T> interpreted(nSamples);
+            expect(block.processBulk(in0, in1, vectorised) == work::Status::OK);
+            expect(reference.processBulk(in0, in1, interpreted) == work::Status::OK);
+            compare(vectorised, interpreted, expression);
+        }
+    } | std::tuple<float, double>{};
+
     "ExpressionBulk"_test = []<typename T>(const T&) {
         Graph graph;
 
@@ -74,6 +134,53 @@ const boost::ut::suite<"basic expression block tests"> basicMath = [] {
         }
     } | std::tuple<float, double>{};
 
+    "ExpressionBulk - zero-copy and stateful expressions"_test = [] {
+        for (const auto& [expression, copyIn, copyOut, zeroOut] : std::vector<std::tuple<std::string, bool, bool, bool>>{{"vecOut := a * vecIn", false, false, false}, {"vecIn := 2 * vecIn; VECOUT := vecIn + c", true, false, false}, //
+                 {"vecOut := vecOut + a * vecIn", false, true, false}, {"for (var i := 0; i < vecIn[]; i += 1) { vecOut[i] := vecIn[i]; }", false, false, true}, {"vecOut[0] += vecIn[0]", false, true, false}, //
+                 {"if (vecIn[0] > 0) vecOut := vecIn;", false, false, true}, {"vecOut[0] := vecIn[0]", false, false, true}}) {
+            ExpressionBulk<float> block({{"expr_string", expression}});
+            std::ignore = block.settings().applyStagedParameters();
+            block.start();
+            expect(eq(block._copyIn, copyIn)) << expression;
+            expect(eq(block._copyOut, copyOut)) << expression;
+            expect(eq(block._zeroOut, zeroOut)) << expression;
+        }
+
+        Graph graph;
+        auto& source    = graph.emplaceBlock<testing::CountingSource<float>>({{"n_samples_max", 100'000U}});
+        auto& exprBlock = graph.emplaceBlock<ExpressionBulk<float>>({{"expr_string", "vecIn := 2 * vecIn; vecOut := vecIn + c"}, {"param_c", 1.f}});
+        auto& tagSink   = graph.emplaceBlock<testing::TagSink<float, USE_PROCESS_ONE>>({{"log_samples", true}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(source).template to<"in">(exprBlock)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(exprBlock).template to<"in">(tagSink)));
+
+        auto sched = gr::scheduler::Simple<>(std::move(graph));
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(tagSink._samples.size(), source.n_samples_max));
+        for (std::size_t i = 0; i < tagSink._samples.size(); ++i) {
+            if (tagSink._samples[i] != 2.f * static_cast<float>(1 + i) + 1.f) {
+                expect(false) << fmt::format("output[{}] = {} vs. expected {}", i, tagSink._samples[i], 2.f * static_cast<float>(1 + i) + 1.f);
+                break;
+            }
+        }
+    };
+
+    "ExpressionBulk - partially written output"_test = [] {
+        // N.B. more samples than the buffer holds, i.e. the (zero-copy) output buffer wraps around and contains previously published samples
+        Graph graph;
+        auto& source    = graph.emplaceBlock<testing::CountingSource<float>>({{"n_samples_max", 100'000U}});
+        auto& exprBlock = graph.emplaceBlock<ExpressionBulk<float>>({{"expr_string", "if (vecIn[0] < 0) vecOut := vecIn;"}}); // never written
+        auto& tagSink   = graph.emplaceBlock<testing::TagSink<float, USE_PROCESS_ONE>>({{"log_samples", true}});
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(source).template to<"in">(exprBlock)));
+        expect(eq(gr::ConnectionResult::SUCCESS, graph.connect<"out">(exprBlock).template to<"in">(tagSink)));
+
+        auto sched = gr::scheduler::Simple<>(std::move(graph));
+        expect(sched.runAndWait().has_value());
+
+        expect(eq(tagSink._samples.size(), source.n_samples_max));
+        expect(std::ranges::all_of(tagSink._samples, [](float sample) { return sample == 0.f; })) << "unwritten output samples should be zero rather than stale buffer contents";
+    };
+
     "ExpressionBulk - exceptions"_test = [](const bool enableERuntimeChecks) {
         Graph graph;
 
@@ -7,6 +7,8 @@
 #include <gnuradio-4.0/Scheduler.hpp>
 #include <gnuradio-4.0/testing/TagMonitors.hpp>
 
+#include <numeric>
+
 template<typename T>
 struct TestParameters {
     std::vector<std::vector<T>> inputs;
@@ -113,6 +115,47 @@ std::complex<float>, std::complex<double>*/>();
             .output = { 0,  1,  2,  2}});
     } | kArithmeticTypes;
 
+    "complex"_test = []<typename T>(const T&) {
+        test_block<T, Add<T>>({.inputs = {{T(1, 2), T(3, -4), T(0.5, 0)}, {T(-1, 1), T(2, 2), T(0, 0.25)}, {T(0, 1), T(1, 0), T(-0.5, 1)}}, .output = {T(0, 4), T(6, -2), T(0, 1.25)}});
+        test_block<T, Subtract<T>>({.inputs = {{T(1, 2), T(3, -4), T(0.5, 0)}, {T(-1, 1), T(2, 2), T(0, 0.25)}}, .output = {T(2, 1), T(1, -6), T(0.5, -0.25)}});
+        test_block<T, Multiply<T>>({.inputs = {{T(1, 2), T(3, -4), T(0.5, 0)}, {T(-1, 1), T(2, 2), T(0, 0.25)}, {T(0, 1), T(1, 0), T(2, 0)}}, .output = {T(1, -3), T(14, -2), T(0, 0.25)}});
+        test_block<T, Divide<T>>({.inputs = {{T(1, -3), T(14, -2), T(0, 0.25)}, {T(0, 1), T(1, 0), T(2, 0)}}, .output = {T(-3, -1), T(14, -2), T(0, 0.125)}});
+    } | std::tuple<std::complex<float>, std::complex<double>>();
+
+    "many inputs, non-SIMD-multiple length"_test = []<typename T>(const T&) {
+        constexpr std::size_t       nInputs  = 32UZ;
+        constexpr std::size_t       nSamples = 101UZ; // N.B. covers the vectorised part and the scalar remainder
+        std::vector<std::vector<T>> inputs(nInputs, std::vector<T>(nSamples));
+        std::vector<T>              expectedSum(nSamples, T(0));
+        for (std::size_t k = 0UZ; k < nInputs; ++k) {
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                inputs[k][i] = static_cast<T>((i + 3UZ * k) % 4UZ);
+                expectedSum[i] += inputs[k][i];
+            }
+        }
+        test_block<T, Add<T>>({.inputs = inputs, .output = expectedSum});
+    } | std::tuple<std::int16_t, std::int32_t, float, double>();
+
+    "complex, many inputs, non-SIMD-multiple length"_test = []<typename T>(const T&) {
+        using value_type = typename T::value_type;
+
+        constexpr std::size_t nInputs  = 5UZ;
+        constexpr std::size_t nSamples = 37UZ; // N.B. > native_simd width and not a multiple of it: covers the vectorised part and the scalar remainder
+        static_assert(nSamples > vir::stdx::native_simd<value_type>::size() && nSamples % vir::stdx::native_simd<value_type>::size() != 0UZ);
+        std::vector<std::vector<T>> inputs(nInputs, std::vector<T>(nSamples));
+        std::vector<T>              expectedSum(nSamples);
+        std::vector<T>              expectedProduct(nSamples);
+        for (std::size_t i = 0UZ; i < nSamples; ++i) {
+            for (std::size_t k = 0UZ; k < nInputs; ++k) { // N.B. small dyadic values -> exact products, i.e. SIMD and scalar results are bit-identical
+                inputs[k][i] = T(static_cast<value_type>((i + 2UZ * k) % 5UZ) - value_type(2), value_type(0.5) * static_cast<value_type>((3UZ * i + k) % 3UZ) - value_type(0.25));
+            }
+            expectedSum[i]     = std::accumulate(std::next(inputs.begin()), inputs.end(), inputs[0][i], [i](const T& acc, const std::vector<T>& in) { return acc + in[i]; });
+            expectedProduct[i] = std::accumulate(std::next(inputs.begin()), inputs.end(), inputs[0][i], [i](const T& acc, const std::vector<T>& in) { return acc * in[i]; });
+        }
+        test_block<T, Add<T>>({.inputs = inputs, .output = expectedSum});
+        test_block<T, Multiply<T>>({.inputs = inputs, .output = expectedProduct});
+    } | std::tuple<std::complex<float>, std::complex<double>>();
+
     // clang-format on
 
     "AddConst"_test = []<typename T>(const T&) {
@@ -142,6 +185,26 @@ std::complex<float>, std::complex<double>*/>();
         block.init(block.progress, block.ioThreadPool);
         expect(eq(block.processOne(T(4)), T(4) / T(2))) << fmt::format("SubtractConst(2) test for type {}\n", meta::type_name<T>());
     } | kArithmeticTypes;
+
+    "fixed-point Const ops"_test = []<typename T>(const T&) {
+        const std::vector<T> input{T(0.5), T(-0.25), T(0.75), T(-1.0), T(0.125)};
+        std::vector<T>       output(input.size());
+        const auto           check = [&input, &output]<typename TBlock>(TBlock block, const std::vector<T>& expected) {
+            block.init(block.progress, block.ioThreadPool);
+            expect(block.processBulk(input, output) == work::Status::OK);
+            expect(std::ranges::equal(output, expected)) << fmt::format("{} for type {}: expected {} but got {}", meta::type_name<TBlock>(), meta::type_name<T>(), expected, output);
+        };
+        // N.B. constants are set as double and results saturate instead of wrapping around
+        check(AddConst<T>(property_map{{"value", 0.5}}), {T::max(), T(0.25), T::max(), T(-0.5), T(0.625)});
+        check(SubtractConst<T>(property_map{{"value", 0.5}}), {T(0.0), T(-0.75), T(0.25), T::lowest(), T(-0.375)});
+        check(MultiplyConst<T>(property_map{{"value", 0.5}}), {T(0.25), T(-0.125), T(0.375), T(-0.5), T(0.0625)});
+        check(DivideConst<T>(property_map{{"value", 0.5}}), {T::max(), T(-0.5), T::max(), T::lowest(), T(0.25)});
+        // gains are kept at 32-bit precision, i.e. the defaults (1.0) are exact identities and gains >= 1 are expressible
+        check(MultiplyConst<T>(property_map{}), input);
+        check(DivideConst<T>(property_map{}), input);
+        check(MultiplyConst<T>(property_map{{"value", 1.5}}), {T(0.75), T(-0.375), T::max(), T::lowest(), T(0.1875)});
+        check(DivideConst<T>(property_map{{"value", 4.0}}), {T(0.125), T(-0.0625), T(0.1875), T(-0.25), T(0.03125)});
+    } | std::tuple<gr::Q15, gr::Q31>();
 };
 
 int main() { /* not needed for UT */ }
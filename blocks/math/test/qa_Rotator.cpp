@@ -16,9 +16,7 @@ std::vector<std::complex<T>> execRotator(const std::vector<std::complex<T>>& inp
     std::ignore = rot.settings().applyStagedParameters(); // needed for unit-test only when executed outside a Scheduler/Graph
 
     std::vector<std::complex<T>> output(input.size());
-    for (std::size_t i = 0; i < input.size(); i++) {
-        output[i] = rot.processOne(input[i]);
-    }
+    boost::ut::expect(rot.processBulk(input, output) == gr::work::Status::OK);
     return output;
 }
 
@@ -75,10 +73,9 @@ const boost::ut::suite<"basic math tests"> basicMath = [] {
         expect(approx(rot.frequency_shift, 0.25f, 1e-3f));
         expect(approx(rot.initial_phase, value_t(0), value_t(1e-3f)));
 
-        std::vector<T> output(8UZ);
-        for (std::size_t i = 0; i < 8; i++) {
-            output[i] = rot.processOne(std::complex<value_t>(1, 0));
-        }
+        const std::vector<T> input(8UZ, std::complex<value_t>(1, 0));
+        std::vector<T>       output(8UZ);
+        expect(rot.processBulk(input, output) == gr::work::Status::OK);
 
         for (std::size_t i = 0; i < 8; i++) {
             value_t wantAngle = value_t(i + 1) * phase_shift;
@@ -0,0 +1,130 @@
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <vector>
+
+#include <gnuradio-4.0/math/SlidingStatistics.hpp>
+
+namespace {
+
+template<typename TBlock, typename T>
+std::vector<T> execBlock(const std::vector<T>& input, const gr::property_map& initSettings) {
+    TBlock block(initSettings);
+    block.settings().init();
+    std::ignore = block.settings().applyStagedParameters(); // needed for unit-test only when executed outside a Scheduler/Graph
+
+    std::vector<T> output(input.size() / static_cast<std::size_t>(block.decimation));
+    boost::ut::expect(block.processBulk(input, output) == gr::work::Status::OK);
+    return output;
+}
+
+// naive reference: statistic of the last min(end, windowSize) samples ending at (excl.) 'end'
+template<typename T, typename Fnc>
+std::vector<T> naive(const std::vector<T>& input, std::size_t windowSize, std::size_t decimation, Fnc&& statistic) {
+    std::vector<T> output;
+    for (std::size_t end = decimation; end <= input.size(); end += decimation) {
+        const std::size_t begin = end > windowSize ? end - windowSize : 0UZ;
+        std::vector<T>    window(input.begin() + static_cast<std::ptrdiff_t>(begin), input.begin() + static_cast<std::ptrdiff_t>(end));
+        output.push_back(statistic(window));
+    }
+    return output;
+}
+
+template<typename T>
+T mean(const std::vector<T>& x) {
+    return std::accumulate(x.begin(), x.end(), T(0)) / static_cast<T>(x.size());
+}
+
+template<typename T>
+T variance(const std::vector<T>& x) {
+    const T mu = mean(x);
+    return std::accumulate(x.begin(), x.end(), T(0), [mu](T sum, T xi) { return sum + (xi - mu) * (xi - mu); }) / static_cast<T>(x.size());
+}
+
+} // namespace
+
+const boost::ut::suite<"sliding-window statistics blocks"> slidingStatistics = [] {
+    using namespace boost::ut;
+    using namespace gr::blocks::math;
+
+    constexpr auto kFloatingPointTypes = std::tuple<float, double>{};
+
+    "sliding statistics vs. naive recomputation"_test = []<typename T>(const T&) {
+        constexpr gr::Size_t kWindow = 64U;
+        std::mt19937         rng(42); // fixed seed for reproducibility
+        std::normal_distribution<T> dist(T(3), T(2));
+        std::vector<T>              input(1200UZ);
+        std::ranges::generate(input, [&] { return dist(rng); });
+        const T tolerance = std::same_as<T, float> ? T(1e-4f) : T(1e-10);
+
+        for (const gr::Size_t decimation : {1U, 7U, 64U, 100U}) {
+            const gr::property_map settings{{"window_size", kWindow}, {"decimation", decimation}};
+            const auto             check = [&]<typename TBlock>(std::string_view name, auto&& reference) {
+                const std::vector<T> result   = execBlock<TBlock>(input, settings);
+                const std::vector<T> expected = naive(input, kWindow, decimation, reference);
+                expect(eq(result.size(), expected.size())) << fmt::format("{} decimation {}", name, decimation);
+                for (std::size_t i = 0UZ; i < std::min(result.size(), expected.size()); ++i) {
+                    expect(approx(result[i], expected[i], tolerance)) << fmt::format("{} decimation {} @{}", name, decimation, i);
+                }
+            };
+
+            check.template operator()<MovingAverage<T>>("mean", [](const std::vector<T>& x) { return mean(x); });
+            check.template operator()<MovingVariance<T>>("variance", [](const std::vector<T>& x) { return variance(x); });
+            check.template operator()<MovingStdDev<T>>("stddev", [](const std::vector<T>& x) { return std::sqrt(variance(x)); });
+            check.template operator()<MovingRms<T>>("rms", [](const std::vector<T>& x) { return std::sqrt(mean(x) * mean(x) + variance(x)); });
+            check.template operator()<MovingMin<T>>("min", [](const std::vector<T>& x) { return std::ranges::min(x); });
+            check.template operator()<MovingMax<T>>("max", [](const std::vector<T>& x) { return std::ranges::max(x); });
+            check.template operator()<MovingQuantile<T>>("median", [](std::vector<T> x) {
+                std::ranges::sort(x);
+                const std::size_t mid = (x.size() - 1UZ) / 2UZ;
+                return x.size() % 2UZ == 0UZ ? (x[mid] + x[mid + 1UZ]) / T(2) : x[mid];
+            });
+        }
+    } | kFloatingPointTypes;
+
+    "sliding statistics settings"_test = [] {
+        MovingQuantile<float> block({{"window_size", gr::Size_t(16U)}, {"decimation", gr::Size_t(4U)}, {"quantile", 0.9f}});
+        block.settings().init();
+        std::ignore = block.settings().applyStagedParameters();
+        expect(eq(block.input_chunk_size, gr::Size_t(4U)));
+        expect(eq(block._estimator.windowSize(), 16UZ));
+        expect(approx(block._estimator.quantile(), 0.9f, 1e-6f));
+
+        std::vector<float> input(16UZ);
+        std::iota(input.begin(), input.end(), 0.f);
+        std::vector<float> output(4UZ);
+        expect(block.processBulk(input, output) == gr::work::Status::OK);
+        expect(approx(output.back(), 13.5f, 1e-5f)); // type-7 quantile of 0 … 15: 0.9 * 15 = 13.5
+    };
+
+    "sliding statistics keep the window across decimation changes"_test = [] {
+        MovingAverage<float> block({{"window_size", gr::Size_t(16U)}});
+        block.settings().init();
+        std::ignore = block.settings().applyStagedParameters();
+
+        std::vector<float> input(20UZ);
+        std::iota(input.begin(), input.end(), 0.f);
+        std::vector<float> output(16UZ);
+        expect(block.processBulk(std::span(input).first(16UZ), output) == gr::work::Status::OK);
+        expect(approx(output.back(), 7.5f, 1e-5f)); // mean of 0 … 15
+
+        expect(block.settings().set({{"decimation", gr::Size_t(4U)}}).empty());
+        expect(block.settings().activateContext() != std::nullopt);
+        std::ignore = block.settings().applyStagedParameters();
+        expect(eq(block.input_chunk_size, gr::Size_t(4U)));
+
+        expect(block.processBulk(std::span(input).last(4UZ), std::span(output).first(1UZ)) == gr::work::Status::OK);
+        expect(approx(output[0], 11.5f, 1e-5f)) << "window retained: mean of 4 … 19"; // a reset window would yield 17.5
+
+        expect(block.settings().set({{"window_size", gr::Size_t(8U)}}).empty());
+        expect(block.settings().activateContext() != std::nullopt);
+        std::ignore = block.settings().applyStagedParameters();
+        expect(eq(block._estimator.windowSize(), 8UZ));
+        expect(eq(block._estimator.size(), 0UZ)) << "window re-created for a new window_size";
+    };
+};
+
+int main() { /* not needed for UT */ }
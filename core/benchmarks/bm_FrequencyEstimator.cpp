@@ -0,0 +1,74 @@
+#include <benchmark.hpp>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/filter/FrequencyEstimator.hpp>
+
+#include <cmath>
+#include <numbers>
+#include <span>
+#include <vector>
+
+inline constexpr float       kSampleRate = 1000.f;
+inline constexpr gr::Size_t  kFFTSize    = 4096U;
+inline constexpr std::size_t kNChunks    = 10UZ;
+inline constexpr std::size_t kNSamples   = 1024UZ; // N.B. processOne with 'FFT' computes a full FFT per sample
+inline constexpr int         kNRepeats   = 10;
+
+template<typename T>
+std::vector<T> mainsSignal(std::size_t nSamples, T frequency) {
+    std::vector<T> signal(nSamples);
+    for (std::size_t i = 0UZ; i < nSamples; ++i) {
+        signal[i] = std::sin(T(2) * std::numbers::pi_v<T> * frequency * static_cast<T>(i) / static_cast<T>(kSampleRate));
+    }
+    return signal;
+}
+
+template<typename TEstimator>
+void configure(TEstimator& estimator, std::string_view method) {
+    estimator.sample_rate  = kSampleRate;
+    estimator.f_min        = 45.f;
+    estimator.f_expected   = 50.f;
+    estimator.f_max        = 55.f;
+    estimator.min_fft_size = kFFTSize;
+    estimator.method       = std::string(method);
+    estimator.reset();
+}
+
+template<typename T>
+void testFrequencyDomain(std::string_view method) {
+    using namespace gr::filter;
+
+    const std::vector<T> input = mainsSignal<T>(kNChunks * kFFTSize, T(50.2));
+
+    FrequencyEstimatorFrequencyDomain<T> estimator;
+    configure(estimator, method);
+    T result{};
+    for (std::size_t i = 0UZ; i < kFFTSize; ++i) { // fill history, i.e. skip the settling period
+        result = estimator.processOne(input[i]);
+    }
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - processOne", fmt::format("FrequencyEstimatorFrequencyDomain<{}> {}", gr::meta::type_name<T>(), method)), kNSamples) = [&] {
+        for (std::size_t i = kFFTSize; i < kFFTSize + kNSamples; ++i) {
+            result = estimator.processOne(input[i]);
+        }
+    };
+
+    FrequencyEstimatorFrequencyDomainDecimating<T> decimating;
+    configure(decimating, method);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - processBulk", fmt::format("FrequencyEstimatorFrequencyDomain<{}> {}", gr::meta::type_name<T>(), method)), input.size()) = [&] {
+        for (std::size_t chunk = 0UZ; chunk < kNChunks; ++chunk) {
+            std::span<T> output(&result, 1UZ);
+            std::ignore = decimating.processBulk(std::span(input).subspan(chunk * kFFTSize, kFFTSize), output);
+        }
+    };
+}
+
+inline const boost::ut::suite _frequency_estimator_bm_tests = [] {
+    testFrequencyDomain<float>("FFT");
+    testFrequencyDomain<float>("Goertzel");
+    ::benchmark::results::add_separator();
+    testFrequencyDomain<double>("FFT");
+    testFrequencyDomain<double>("Goertzel");
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,102 @@
+#include <benchmark.hpp>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/algorithm/SlidingWindowStatistics.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <random>
+#include <span>
+#include <vector>
+
+inline constexpr std::size_t kNSamples      = 100'000UZ;
+inline constexpr std::size_t kNNaiveSamples = 10'000UZ; // N.B. the naive re-computation is O(window size) per sample
+inline constexpr std::size_t kDecimation    = 64UZ;
+inline constexpr int         kNRepeats      = 10;
+
+template<typename T>
+std::vector<T> noiseSignal(std::size_t nSamples) {
+    std::mt19937                rng(42);
+    std::normal_distribution<T> dist(T(1), T(0.5));
+    std::vector<T>              signal(nSamples);
+    std::ranges::generate(signal, [&] { return dist(rng); });
+    return signal;
+}
+
+template<typename T>
+void testSlidingStatistics(std::size_t windowSize) {
+    using namespace gr::algorithm;
+
+    const std::vector<T> input = noiseSignal<T>(kNSamples);
+    const auto           name  = [windowSize](std::string_view statistic) { return fmt::format("{}<{}>, window {}", statistic, gr::meta::type_name<T>(), windowSize); };
+    T                    result{};
+
+    // naive: re-compute the statistic over the full window for every output sample
+    const auto naiveWindow = [&input, windowSize](std::size_t end) { return std::span(input).subspan(end - windowSize, windowSize); };
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - naive", name("mean/variance")), kNNaiveSamples) = [&] {
+        for (std::size_t end = windowSize; end < windowSize + kNNaiveSamples; ++end) {
+            const auto window = naiveWindow(end);
+            const T    mean   = std::accumulate(window.begin(), window.end(), T(0)) / static_cast<T>(windowSize);
+            result            = std::accumulate(window.begin(), window.end(), T(0), [mean](T sum, T x) { return sum + (x - mean) * (x - mean); }) / static_cast<T>(windowSize);
+        }
+    };
+
+    SlidingMoments<T> moments(windowSize);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - incremental", name("mean/variance")), kNSamples) = [&] {
+        for (const T& x : input) {
+            moments.push_back(x);
+            result = moments.variance();
+        }
+    };
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - incremental, SIMD bulk (decim {})", name("mean/variance"), kDecimation), kNSamples) = [&] {
+        for (std::size_t i = 0UZ; i + kDecimation <= kNSamples; i += kDecimation) {
+            moments.push_back_bulk(std::span(input).subspan(i, kDecimation));
+            result = moments.variance();
+        }
+    };
+
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - naive", name("max")), kNNaiveSamples) = [&] {
+        for (std::size_t end = windowSize; end < windowSize + kNNaiveSamples; ++end) {
+            result = std::ranges::max(naiveWindow(end));
+        }
+    };
+
+    SlidingMaximum<T> maximum(windowSize);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - incremental", name("max")), kNSamples) = [&] {
+        for (const T& x : input) {
+            maximum.push_back(x);
+            result = maximum.value();
+        }
+    };
+
+    std::vector<T> sorted(windowSize);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - naive", name("median")), kNNaiveSamples / 10UZ) = [&] {
+        for (std::size_t end = windowSize; end < windowSize + kNNaiveSamples / 10UZ; ++end) {
+            const auto window = naiveWindow(end);
+            std::ranges::copy(window, sorted.begin());
+            std::ranges::nth_element(sorted, sorted.begin() + static_cast<std::ptrdiff_t>(windowSize / 2UZ));
+            result = sorted[windowSize / 2UZ];
+        }
+    };
+
+    SlidingQuantile<T> median(windowSize, T(0.5));
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:45} - incremental", name("median")), kNSamples) = [&] {
+        for (const T& x : input) {
+            median.push_back(x);
+            result = median.value();
+        }
+    };
+    std::ignore = result;
+}
+
+inline const boost::ut::suite _sliding_window_statistics_bm_tests = [] {
+    testSlidingStatistics<float>(256UZ);
+    testSlidingStatistics<float>(4096UZ);
+    ::benchmark::results::add_separator();
+    testSlidingStatistics<double>(256UZ);
+    testSlidingStatistics<double>(4096UZ);
+};
+
+int main() { /* not needed by the UT framework */ }
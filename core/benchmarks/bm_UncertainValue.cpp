@@ -0,0 +1,125 @@
+#include <benchmark.hpp>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/filter/time_domain_filter.hpp>
+#include <gnuradio-4.0/meta/UncertainValue.hpp>
+
+#include <cmath>
+#include <span>
+#include <vector>
+
+inline constexpr std::size_t kNSamples       = 1'000'000UZ;
+inline constexpr std::size_t kNFilterSamples = 100'000UZ; // N.B. the filters are sample-by-sample recursive
+inline constexpr int         kNRepeats       = 10;
+
+template<typename T>
+std::vector<gr::UncertainValue<T>> uncertainSignal(std::size_t nSamples, T offset) {
+    std::vector<gr::UncertainValue<T>> signal(nSamples);
+    for (std::size_t i = 0UZ; i < nSamples; ++i) {
+        signal[i] = {offset + std::sin(T(0.001) * static_cast<T>(i)), T(0.01) + T(0.005) * std::cos(T(0.0003) * static_cast<T>(i))};
+    }
+    return signal;
+}
+
+template<typename T, typename FncScalar, typename FncLane>
+void benchmarkPropagation(std::string_view name, FncScalar&& scalarOp, FncLane&& laneOp) {
+    using V = vir::stdx::native_simd<T>;
+
+    const std::string                        description = fmt::format("{}, UncertainValue<{}>", name, gr::meta::type_name<T>());
+    const std::vector<gr::UncertainValue<T>> a           = uncertainSignal<T>(kNSamples, T(1.5));
+    const std::vector<gr::UncertainValue<T>> b           = uncertainSignal<T>(kNSamples, T(-2.5));
+    std::vector<gr::UncertainValue<T>>       out(kNSamples);
+
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - scalar AoS", description), kNSamples) = [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            out[i] = scalarOp(a[i], b[i]);
+        }
+    };
+
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - SIMD lanes, AoS I/O", description), kNSamples) = [&] {
+        std::size_t i = 0UZ;
+        for (; i + V::size() <= kNSamples; i += V::size()) {
+            gr::storeUncertainValues(laneOp(gr::loadUncertainValues<V>(std::span(a), i), gr::loadUncertainValues<V>(std::span(b), i)), std::span(out), i);
+        }
+        for (; i < kNSamples; ++i) {
+            out[i] = scalarOp(a[i], b[i]);
+        }
+    };
+
+    std::vector<T> aValue(kNSamples);
+    std::vector<T> aUncertainty(kNSamples);
+    std::vector<T> bValue(kNSamples);
+    std::vector<T> bUncertainty(kNSamples);
+    std::vector<T> outValue(kNSamples);
+    std::vector<T> outUncertainty(kNSamples);
+    for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+        aValue[i]       = a[i].value;
+        aUncertainty[i] = a[i].uncertainty;
+        bValue[i]       = b[i].value;
+        bUncertainty[i] = b[i].uncertainty;
+    }
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - SIMD lanes, SoA I/O", description), kNSamples) = [&] {
+        for (std::size_t i = 0UZ; i + V::size() <= kNSamples; i += V::size()) { // N.B. kNSamples is a multiple of the SIMD width
+            const auto lhs = gr::loadUncertainValues<V>(std::span<const T>(aValue), std::span<const T>(aUncertainty), i);
+            const auto rhs = gr::loadUncertainValues<V>(std::span<const T>(bValue), std::span<const T>(bUncertainty), i);
+            gr::storeUncertainValues(laneOp(lhs, rhs), std::span(outValue), std::span(outUncertainty), i);
+        }
+    };
+    ::benchmark::results::add_separator();
+}
+
+template<typename T>
+void testPropagation() {
+    const auto arithmetic = [](const auto& a, const auto& b) { return (a * b + a) / b; };
+    benchmarkPropagation<T>("(a * b + a) / b", arithmetic, arithmetic);
+    const auto trigonometric = [](const auto& a, const auto& b) { return gr::math::sin(a) * gr::math::cos(b); };
+    benchmarkPropagation<T>("sin(a) * cos(b)", trigonometric, trigonometric);
+    const auto root = [](const auto& a, const auto&) { return gr::math::sqrt(a); };
+    benchmarkPropagation<T>("sqrt(a)", root, root);
+}
+
+template<typename T>
+void testBasicFilter(std::string_view filterType) {
+    using namespace gr::filter;
+    const auto configure = [filterType](auto& filter) {
+        filter.filter_type       = std::string(filterType);
+        filter.filter_response   = "LOWPASS";
+        filter.filter_order      = 4U;
+        filter.f_low             = 0.1;
+        filter.sample_rate       = 1.0;
+        filter.iir_design_method = "BUTTERWORTH";
+        filter.fir_design_method = "Hamming";
+        filter.designFilter();
+    };
+
+    const std::vector<gr::UncertainValue<T>> input = uncertainSignal<T>(kNFilterSamples, T(0));
+    std::vector<gr::UncertainValue<T>>       output(kNFilterSamples);
+
+    BasicFilter<T> reference;
+    configure(reference);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - value only", fmt::format("BasicFilter<{}> {}", gr::meta::type_name<T>(), filterType)), kNFilterSamples) = [&] {
+        for (std::size_t i = 0UZ; i < kNFilterSamples; ++i) {
+            output[i].value = reference.processOne(input[i].value);
+        }
+    };
+
+    BasicFilter<gr::UncertainValue<T>> filter;
+    configure(filter);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - with propagation", fmt::format("BasicFilter<UncertainValue<{}>> {}", gr::meta::type_name<T>(), filterType)), kNFilterSamples) = [&] {
+        for (std::size_t i = 0UZ; i < kNFilterSamples; ++i) {
+            output[i] = filter.processOne(input[i]);
+        }
+    };
+    ::benchmark::results::add_separator();
+}
+
+inline const boost::ut::suite _uncertain_value_bm_tests = [] {
+    testPropagation<float>();
+    testPropagation<double>();
+
+    testBasicFilter<float>("FIR");
+    testBasicFilter<float>("IIR");
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,71 @@
+#include <benchmark.hpp>
+
+#include <fmt/format.h>
+#include <magic_enum.hpp>
+
+#include <gnuradio-4.0/basic/SignalGenerator.hpp>
+#include <gnuradio-4.0/fileio/Compression.hpp>
+
+#include <cmath>
+#include <cstring>
+#include <ranges>
+
+inline constexpr std::size_t kNSamples   = 1UZ << 20UZ; // per frame
+inline constexpr int         kNRepeats   = 20;
+inline constexpr float       kSampleRate = 1'000'000.f;
+
+template<typename T>
+std::vector<T> generateSignal(std::string_view signalType, float frequency) {
+    gr::basic::SignalGenerator<float> generator({{"sample_rate", kSampleRate}, {"signal_type", std::string(signalType)}, {"frequency", frequency}, {"amplitude", 1.f}});
+    std::ignore = generator.settings().applyStagedParameters();
+
+    std::vector<float> values(kNSamples);
+    std::ignore = generator.processBulk(std::vector<std::uint8_t>(kNSamples), values);
+
+    std::vector<T> signal(kNSamples);
+    for (auto&& [sample, value] : std::views::zip(signal, values)) {
+        if constexpr (std::is_integral_v<T>) { // emulates a 14-bit ADC
+            sample = static_cast<T>(std::lround(value * 8191.f));
+        } else {
+            sample = static_cast<T>(value);
+        }
+    }
+    return signal;
+}
+
+template<typename T>
+void testCodec(std::string_view signalType, gr::blocks::fileio::compression::Codec codec) {
+    using namespace boost::ut;
+    using namespace gr::blocks::fileio;
+
+    const std::vector<T> signal   = generateSignal<T>(signalType, 1'234.5f);
+    const std::size_t    rawBytes = signal.size() * sizeof(T);
+
+    std::vector<std::byte>   frame = compression::compressFrame<T>(signal, codec);
+    compression::FrameHeader header;
+    std::memcpy(&header, frame.data(), sizeof(header));
+    const double ratio = static_cast<double>(rawBytes) / static_cast<double>(frame.size());
+
+    // N.B. 'ops/s' corresponds to bytes/s of uncompressed data
+    const std::string name = fmt::format("{:8} {:8} {:13} (ratio {:5.2f})", gr::meta::type_name<T>(), signalType, magic_enum::enum_name(header.codec), ratio);
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{} - compress", name), rawBytes) = [&signal, &frame, codec] { frame = compression::compressFrame<T>(signal, codec); };
+
+    std::vector<T> decoded(signal.size());
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{} - decompress", name), rawBytes) = [&frame, &header, &decoded] { //
+        compression::decompressFrame(header, std::span(frame).subspan(sizeof(header)), std::as_writable_bytes(std::span(decoded)));
+    };
+    expect(std::ranges::equal(signal, decoded)) << name;
+}
+
+inline const boost::ut::suite _compression_bm_tests = [] {
+    using enum gr::blocks::fileio::compression::Codec;
+    for (const std::string_view signalType : {"Sin", "Saw", "Square"}) {
+        testCodec<std::int16_t>(signalType, delta_bitpack);
+        testCodec<std::int16_t>(signalType, shuffle_lz);
+        testCodec<float>(signalType, shuffle_lz);
+        testCodec<double>(signalType, shuffle_lz);
+        ::benchmark::results::add_separator();
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
@@ -0,0 +1,142 @@
+#include <benchmark.hpp>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/basic/ConverterBlocks.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+#include <cmath>
+#include <complex>
+
+inline constexpr std::size_t kNSamples = 1'000'000UZ; // per work call
+inline constexpr int         kNRepeats = 10;
+
+template<typename T>
+std::vector<std::complex<T>> complexSignal(std::size_t nSamples) {
+    std::vector<std::complex<T>> signal(nSamples);
+    for (std::size_t i = 0UZ; i < nSamples; ++i) {
+        signal[i] = std::polar(T(1) + T(0.5) * std::sin(T(0.0001) * static_cast<T>(i)), T(0.001) * static_cast<T>(i));
+    }
+    return signal;
+}
+
+template<typename TBlock, typename Fnc>
+void benchmarkBlock(std::string_view name, Fnc&& workFunction) {
+    TBlock block;
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - vectorised", name), kNSamples) = [&] { boost::ut::expect(workFunction(block) == gr::work::Status::OK); };
+}
+
+template<typename Fnc>
+void benchmarkReference(std::string_view name, Fnc&& referenceFunction) {
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - std:: reference", name), kNSamples) = referenceFunction;
+}
+
+template<typename T>
+void testConverters() {
+    using namespace gr::blocks::type::converter;
+    const auto                   signal = complexSignal<T>(kNSamples);
+    std::vector<T>               first(kNSamples);
+    std::vector<T>               second(kNSamples);
+    std::vector<std::complex<T>> complexOut(kNSamples);
+
+    const std::string typeName(gr::meta::type_name<T>());
+    benchmarkReference(fmt::format("ToRealImag<complex<{}>>", typeName), [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            first[i]  = signal[i].real();
+            second[i] = signal[i].imag();
+        }
+    });
+    benchmarkBlock<ToRealImag<std::complex<T>>>(fmt::format("ToRealImag<complex<{}>>", typeName), [&](auto& block) { return block.processBulk(signal, first, second); });
+
+    benchmarkReference(fmt::format("RealImagToComplex<{}>", typeName), [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            complexOut[i] = {first[i], second[i]};
+        }
+    });
+    benchmarkBlock<RealImagToComplex<T>>(fmt::format("RealImagToComplex<{}>", typeName), [&](auto& block) { return block.processBulk(first, second, complexOut); });
+
+    benchmarkReference(fmt::format("ToMagPhase<complex<{}>>", typeName), [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            first[i]  = std::abs(signal[i]);
+            second[i] = std::arg(signal[i]);
+        }
+    });
+    benchmarkBlock<ToMagPhase<std::complex<T>>>(fmt::format("ToMagPhase<complex<{}>>", typeName), [&](auto& block) { return block.processBulk(signal, first, second); });
+
+    benchmarkReference(fmt::format("MagPhaseToComplex<{}>", typeName), [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            complexOut[i] = std::polar(first[i], second[i]);
+        }
+    });
+    benchmarkBlock<MagPhaseToComplex<T>>(fmt::format("MagPhaseToComplex<{}>", typeName), [&](auto& block) { return block.processBulk(first, second, complexOut); });
+    ::benchmark::results::add_separator();
+}
+
+template<typename TRaw, typename T>
+void testInterleaved() {
+    using namespace gr::blocks::type::converter;
+    std::vector<TRaw> raw(2UZ * kNSamples);
+    for (std::size_t i = 0UZ; i < raw.size(); ++i) {
+        raw[i] = static_cast<TRaw>(static_cast<T>(std::numeric_limits<TRaw>::max()) * std::sin(T(0.001) * static_cast<T>(i)));
+    }
+    std::vector<std::complex<T>> complexOut(kNSamples);
+    const T                      scale = T(1) / static_cast<T>(std::numeric_limits<TRaw>::max());
+
+    const std::string name = fmt::format("{} IQ <-> complex<{}> (scaled)", gr::meta::type_name<TRaw>(), gr::meta::type_name<T>());
+    benchmarkReference(fmt::format("InterleavedToComplex: {}", name), [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            complexOut[i] = {static_cast<T>(raw[2UZ * i]) * scale, static_cast<T>(raw[2UZ * i + 1UZ]) * scale};
+        }
+    });
+    InterleavedToComplex<TRaw, std::complex<T>> toComplex;
+    toComplex.scale = scale;
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - vectorised", fmt::format("InterleavedToComplex: {}", name)), kNSamples) = [&] { boost::ut::expect(toComplex.processBulk(raw, complexOut) == gr::work::Status::OK); };
+
+    benchmarkReference(fmt::format("ComplexToInterleaved: {}", name), [&] {
+        for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+            raw[2UZ * i]       = static_cast<TRaw>(complexOut[i].real() / scale);
+            raw[2UZ * i + 1UZ] = static_cast<TRaw>(complexOut[i].imag() / scale);
+        }
+    });
+    ComplexToInterleaved<std::complex<T>, TRaw> toInterleaved;
+    toInterleaved.scale = T(1) / scale;
+    ::benchmark::benchmark<kNRepeats>(fmt::format("{:55} - vectorised", fmt::format("ComplexToInterleaved: {}", name)), kNSamples) = [&] { boost::ut::expect(toInterleaved.processBulk(complexOut, raw) == gr::work::Status::OK); };
+    ::benchmark::results::add_separator();
+}
+
+void testGraph(gr::Size_t nSamples) {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::testing;
+    using namespace gr::blocks::type::converter;
+
+    Graph graph;
+    auto& source    = graph.emplaceBlock<ConstantSource<std::int16_t>>({{"n_samples_max", 2U * nSamples}, {"default_value", std::int16_t(1024)}});
+    auto& converter = graph.emplaceBlock<InterleavedToComplex<std::int16_t, std::complex<float>>>({{"scale", 1.f / 32768.f}});
+    auto& sink      = graph.emplaceBlock<CountingSink<std::complex<float>>>();
+    expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(source).template to<"interleaved">(converter)));
+    expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(converter).template to<"in">(sink)));
+
+    scheduler::Simple sched{std::move(graph)};
+    ::benchmark::benchmark<1>(fmt::format("src->InterleavedToComplex<int16, complex<float>>->sink ({} M samples)", nSamples / 1'000'000U), nSamples) = [&] {
+        expect(sched.runAndWait().has_value());
+        expect(eq(sink.count.value, nSamples));
+    };
+}
+
+inline const boost::ut::suite _converter_bm_tests = [] {
+    testConverters<float>();
+    testConverters<double>();
+
+    testInterleaved<std::int8_t, float>();
+    testInterleaved<std::int16_t, float>();
+    testInterleaved<std::int16_t, double>();
+
+    for (const gr::Size_t nSamples : {1'000'000U, 10'000'000U, 100'000'000U}) {
+        testGraph(nSamples);
+    }
+};
+
+int main() { /* not needed by the UT framework */ }
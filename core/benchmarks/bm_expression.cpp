@@ -0,0 +1,74 @@
+#include <benchmark.hpp>
+
+#include <fmt/format.h>
+
+#include <gnuradio-4.0/Graph.hpp>
+#include <gnuradio-4.0/Scheduler.hpp>
+#include <gnuradio-4.0/math/ExpressionBlocks.hpp>
+#include <gnuradio-4.0/testing/NullSources.hpp>
+
+#include <cmath>
+
+inline constexpr std::size_t kNSamples = 1UZ << 16UZ; // per work call
+inline constexpr int         kNRepeats = 100;
+
+template<typename T>
+void testExpressionSISO(std::string_view expression) {
+    using namespace boost::ut;
+    using namespace gr::blocks::math;
+
+    std::vector<T> input(kNSamples);
+    for (std::size_t i = 0UZ; i < kNSamples; ++i) {
+        input[i] = std::sin(T(0.001) * static_cast<T>(i));
+    }
+    std::vector<T> output(kNSamples);
+    std::vector<T> reference(kNSamples);
+
+    for (const bool vectorised : {false, true}) {
+        ExpressionSISO<T> block({{"expr_string", std::string(expression)}, {"param_a", T(0.5)}, {"param_b", T(2)}, {"param_c", T(-1)}});
+        std::ignore = block.settings().applyStagedParameters();
+        block.start();
+        if (!vectorised) {
+            block._vectorised.reset(); // force the ExprTk interpreter
+        }
+        ::benchmark::benchmark<kNRepeats>(fmt::format("ExpressionSISO<{:6}> {:11} '{}'", gr::meta::type_name<T>(), vectorised ? "vectorised" : "interpreted", expression), kNSamples) = [&] { std::ignore = block.processBulk(input, vectorised ? output : reference); };
+    }
+    expect(std::ranges::equal(output, reference, [](T a, T b) { return std::abs(a - b) <= T(1e-5f) * std::max(T(1), std::abs(b)); })) << expression;
+}
+
+template<typename TBlock>
+void testGraph(std::string_view name, gr::property_map blockProperties, gr::Size_t nSamples) {
+    using namespace boost::ut;
+    using namespace gr;
+    using namespace gr::testing;
+
+    Graph graph;
+    auto& source = graph.emplaceBlock<ConstantSource<float>>({{"n_samples_max", nSamples}, {"default_value", 1.f}});
+    auto& block  = graph.emplaceBlock<TBlock>(std::move(blockProperties));
+    auto& sink   = graph.emplaceBlock<CountingSink<float>>();
+    expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(source).template to<"in">(block)));
+    expect(eq(ConnectionResult::SUCCESS, graph.connect<"out">(block).template to<"in">(sink)));
+
+    scheduler::Simple sched{std::move(graph)};
+    ::benchmark::benchmark<1>(fmt::format("src->{}->sink", name), nSamples) = [&] {
+        expect(sched.runAndWait().has_value());
+        expect(eq(sink.count.value, nSamples));
+    };
+}
+
+inline const boost::ut::suite _expression_bm_tests = [] {
+    for (const std::string_view expression : {"y := a*x^2 + b*x + c", "clamp(-1.0, sin(2 * pi * x) + cos(x / 2 * pi), +1.0)"}) {
+        testExpressionSISO<float>(expression);
+        testExpressionSISO<double>(expression);
+        ::benchmark::results::add_separator();
+    }
+
+    // ExpressionBulk: 'vecIn'/'vecOut' reference the buffer memory directly, unless the expression writes to 'vecIn' or reads 'vecOut'
+    constexpr gr::Size_t nSamples = 100'000'000U;
+    testGraph<gr::testing::Copy<float>>("copy (reference)", {}, nSamples);
+    testGraph<gr::blocks::math::ExpressionBulk<float>>("ExpressionBulk zero-copy 'vecOut := a * vecIn'", {{"expr_string", "vecOut := a * vecIn"}, {"param_a", 2.f}}, nSamples);
+    testGraph<gr::blocks::math::ExpressionBulk<float>>("ExpressionBulk copy-in   'vecIn := a * vecIn; vecOut := vecIn'", {{"expr_string", "vecIn := a * vecIn; vecOut := vecIn"}, {"param_a", 2.f}}, nSamples);
+    testGraph<gr::blocks::math::ExpressionBulk<float>>("ExpressionBulk copy-out  'vecOut := vecOut + a * vecIn'", {{"expr_string", "vecOut := vecOut + a * vecIn"}, {"param_a", 2.f}}, nSamples);
+};
+
+int main() { /* not needed by the UT framework */ }
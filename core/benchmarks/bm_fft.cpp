@@ -111,12 +111,50 @@ void testFFT() {
     ::benchmark::results::add_separator();
 }
 
+template<typename T, template<typename, typename> typename TAlgo>
+void testBatchFFT() {
+    using namespace benchmark;
+    using namespace boost::ut::reflection;
+    using namespace gr::algorithm;
+
+    constexpr std::size_t N{1024U}; // must be power of 2
+    constexpr std::size_t nChannels{64U};
+    constexpr int         nRepetitions{100};
+
+    using PrecisionType = FFTAlgoPrecision<T>::type;
+    using OutType       = std::complex<PrecisionType>;
+
+    std::vector<T> signal;
+    signal.reserve(N * nChannels);
+    for (std::size_t i = 0; i < nChannels; i++) {
+        const auto channel = generateSinSample<T>(N, 256., 10. + static_cast<double>(i), 1.);
+        signal.insert(signal.end(), channel.begin(), channel.end());
+    }
+    std::vector<OutType> result(N * nChannels);
+
+    {
+        TAlgo<T, OutType> fft;
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - {} x single {}", type_name<T>(), nChannels, type_name<decltype(fft)>())) = [&fft, &signal, &result] {
+            for (std::size_t i = 0; i < nChannels; i++) {
+                std::ignore = fft.compute(std::span(signal).subspan(i * N, N), std::span(result).subspan(i * N, N));
+            }
+        };
+    }
+    {
+        TAlgo<T, OutType> fft;
+        ::benchmark::benchmark<nRepetitions>(fmt::format("{} - batched({}) {}", type_name<T>(), nChannels, type_name<decltype(fft)>())) = [&fft, &signal, &result] { std::ignore = fft.computeBatch(signal, result, nChannels); };
+    }
+}
+
 inline const boost::ut::suite _fft_bm_tests = [] {
     std::tuple<std::complex<float>, std::complex<double>> complexTypesToTest{};
     std::tuple<float, double>                             realTypesToTest{};
 
     std::apply([]<class... TArgs>(TArgs... /*args*/) { (testFFT<TArgs>(), ...); }, complexTypesToTest);
     std::apply([]<class... TArgs>(TArgs... /*args*/) { (testFFT<TArgs>(), ...); }, realTypesToTest);
+
+    std::apply([]<class... TArgs>(TArgs... /*args*/) { ((testBatchFFT<TArgs, gr::algorithm::FFT>(), testBatchFFT<TArgs, gr::algorithm::FFTw>()), ...); }, complexTypesToTest);
+    ::benchmark::results::add_separator();
 };
 
 int main() { /* not needed by the UT framework */ }
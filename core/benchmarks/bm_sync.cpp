@@ -11,15 +11,13 @@
 #include <gnuradio-4.0/testing/TagMonitors.hpp>
 
 inline constexpr std::size_t nRepeats = 1; // must be 1 at the moment
-inline constexpr gr::Size_t  nPorts   = 2U;
-inline constexpr gr::Size_t  nSamples = 4'000'000'000;
 
 gr::Tag genSyncTag(std::size_t index, std::uint64_t triggerTime, std::string triggerName = "TriggerName") { //
     return {index, {{gr::tag::TRIGGER_NAME.shortKey(), triggerName}, {gr::tag::TRIGGER_TIME.shortKey(), triggerTime}}};
 };
 
 template<typename TBlock>
-void runTest() {
+void runTest(gr::Size_t nPorts, gr::Size_t nSamples, std::size_t nTags = 1UZ) { // N.B. we need at least 1 tag to synchronize samples
     using namespace boost::ut;
     using namespace benchmark;
     using namespace gr;
@@ -28,8 +26,6 @@ void runTest() {
 
     gr::Graph graph;
 
-    const std::size_t nTags = 1; // we need at least 1 tag to synchronize samples
-
     property_map perfBlockProperties;
     if constexpr (std::is_same_v<TBlock, gr::basic::SyncBlock<int>>) {
         perfBlockProperties = {{"n_ports", nPorts}};
@@ -64,13 +60,13 @@ void runTest() {
     }
 
     gr::scheduler::Simple sched{std::move(graph)};
-    ::benchmark::benchmark<nRepeats>(fmt::format("src->{}->sink", gr::meta::type_name<TBlock>()), nSamples) = [&]() {
+    ::benchmark::benchmark<nRepeats>(fmt::format("src->{}->sink ({} ports, {} tags)", gr::meta::type_name<TBlock>(), nPorts, nTags), nSamples) = [&]() {
         sched.runAndWait();
         expect(eq(sinks[0]->_nSamplesProduced, nSamples));
     };
 }
 
-void runTestPureCopy() {
+void runTestPureCopy(gr::Size_t nPorts, gr::Size_t nSamples) {
     using namespace boost::ut;
     using namespace benchmark;
     using namespace gr;
@@ -95,16 +91,22 @@ void runTestPureCopy() {
     }
 
     gr::scheduler::Simple sched{std::move(graph)};
-    ::benchmark::benchmark<nRepeats>("src->copy->sink", nSamples) = [&]() {
+    ::benchmark::benchmark<nRepeats>(fmt::format("src->copy->sink ({} ports)", nPorts), nSamples) = [&]() {
         sched.runAndWait();
         expect(eq(sinks[0]->_nSamplesProduced, nSamples));
     };
 }
 
 inline const boost::ut::suite _constexpr_bm = [] {
-    runTest<gr::basic::SyncBlock<int>>();
-    runTest<gr::basic::Selector<int>>();
-    runTestPureCopy();
+    runTest<gr::basic::SyncBlock<int>>(2U, 4'000'000'000U);
+    runTest<gr::basic::Selector<int>>(2U, 4'000'000'000U);
+    runTestPureCopy(2U, 4'000'000'000U);
+    ::benchmark::results::add_separator();
+
+    // many ports with dense sync tags (one every 1024 samples) -> dominated by the sync-tag matching
+    runTest<gr::basic::SyncBlock<int>>(32U, 100'000'000U, 100'000'000UZ / 1024UZ);
+    runTest<gr::basic::Selector<int>>(32U, 100'000'000U);
+    runTestPureCopy(32U, 100'000'000U);
 };
 
 int main() { /* not needed by the UT framework */ }
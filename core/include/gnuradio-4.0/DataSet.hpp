@@ -111,6 +111,76 @@ static_assert(DataSetLike<DataSet<std::byte>>, "DataSet<std::byte> concept confo
 static_assert(DataSetLike<DataSet<float>>, "DataSet<float> concept conformity");
 static_assert(DataSetLike<DataSet<double>>, "DataSet<double> concept conformity");
 
+/**
+ * @brief clears the content of a DataSet while keeping the storage of all its (nested) vectors for re-use.
+ */
+template<typename T>
+constexpr void clearKeepingCapacity(DataSet<T>& dataSet) {
+    dataSet.timestamp = 0;
+    dataSet.axis_names.clear();
+    dataSet.axis_units.clear();
+    for (auto& axis : dataSet.axis_values) {
+        axis.clear();
+    }
+    dataSet.extents.clear();
+    dataSet.layout = {};
+    dataSet.signal_names.clear();
+    dataSet.signal_quantities.clear();
+    dataSet.signal_units.clear();
+    dataSet.signal_values.clear();
+    dataSet.signal_errors.clear();
+    for (auto& range : dataSet.signal_ranges) {
+        range.clear();
+    }
+    dataSet.meta_information.clear();
+    for (auto& events : dataSet.timing_events) {
+        events.clear();
+    }
+}
+
+/**
+ * @brief bounded per-producer free-list of cleared DataSets whose storage is recycled rather than re-allocated.
+ *
+ * A producer `acquire()`s a DataSet, fills it and swaps it with the (already consumed) output buffer slot. The slot's previous
+ * DataSet is handed back via `recycle(..)`. Once the buffer has wrapped around, the DataSets circulating between the pool and
+ * the buffer slots already hold storage of the required size, i.e. steady-state streaming does not allocate.
+ *
+ * N.B. the pool is not thread-safe and meant to be owned by a single producer.
+ */
+template<typename T, std::size_t kMaxSize = 4UZ>
+class DataSetPool {
+    std::vector<DataSet<T>> _pool;
+
+public:
+    [[nodiscard]] DataSet<T> acquire() {
+        if (_pool.empty()) {
+            return {};
+        }
+        DataSet<T> dataSet = std::move(_pool.back());
+        _pool.pop_back();
+        return dataSet;
+    }
+
+    void recycle(DataSet<T>&& dataSet) {
+        if (_pool.size() >= kMaxSize || dataSet.signal_values.capacity() == 0UZ) {
+            return; // nothing worth recycling
+        }
+        clearKeepingCapacity(dataSet);
+        _pool.push_back(std::move(dataSet));
+    }
+
+    /**
+     * @brief moves `dataSet` into the output buffer `slot` and recycles the slot's previous content.
+     */
+    void publish(DataSet<T>& slot, DataSet<T>&& dataSet) {
+        std::swap(slot, dataSet);
+        recycle(std::move(dataSet));
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept { return _pool.size(); }
+    void                      clear() noexcept { _pool.clear(); }
+};
+
 template<typename T>
 struct Tensor {
     using value_type         = T;
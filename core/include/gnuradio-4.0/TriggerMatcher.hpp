@@ -5,6 +5,11 @@
 #include "gnuradio-4.0/Tag.hpp"
 #include "gnuradio-4.0/meta/formatter.hpp"
 
+#include <algorithm>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
 namespace gr::trigger {
 
 constexpr inline std::string_view SEPARATOR = "/";
@@ -289,6 +294,291 @@ struct Filter {
 
 static_assert(Matcher<Filter>);
 
+/**
+ * @brief filter definition parsed once into plain members, avoiding the per-tag parsing and `property_map` look-ups of `filter(..)`.
+ * Semantics are identical to `filter(..)`, @see match(..).
+ */
+struct CompiledFilter {
+    struct Trigger {
+        std::string name; // empty: any trigger name
+        std::string ctx;  // empty: any context
+        bool        nameEnds = false;
+        bool        ctxEnds  = false;
+    };
+
+    std::string definition;
+    bool        startDefined    = false;
+    bool        stopDefined     = false;
+    bool        isSingleTrigger = false;
+    Trigger     start;
+    Trigger     stop;
+
+    [[nodiscard]] static CompiledFilter compile(std::string_view filterDefinition) {
+        property_map state;
+        verifyFilterState(filterDefinition, state); // N.B. re-uses the reference parser
+        const auto flag = [&state](const char* key) { return std::get<bool>(state.at(key)); };
+        const auto str  = [&state](const char* key) { return std::get<std::string>(state.at(key)); };
+
+        CompiledFilter compiled;
+        compiled.definition      = std::string(filterDefinition);
+        compiled.startDefined    = flag(key::kStartDefined);
+        compiled.stopDefined     = flag(key::kStopDefined);
+        compiled.isSingleTrigger = compiled.startDefined xor compiled.stopDefined;
+        compiled.start           = {str(key::kStartTriggerName), str(key::kStartCtx), flag(key::kStartTriggerNameEnds), flag(key::kStartCtxEnds)};
+        compiled.stop            = {str(key::kStopTriggerName), str(key::kStopCtx), flag(key::kStopTriggerNameEnds), flag(key::kStopCtxEnds)};
+        return compiled;
+    }
+
+    /// true if the filter needs to evaluate tags with arbitrary trigger names (wildcard names or '^' end-markers)
+    [[nodiscard]] bool needsAllTags() const noexcept {
+        const bool wildcardName = (startDefined && start.name.empty()) || (stopDefined && stop.name.empty());
+        return wildcardName || start.nameEnds || start.ctxEnds || stop.nameEnds || stop.ctxEnds;
+    }
+};
+
+struct CompiledState {
+    bool triggerActive           = false;
+    bool waitingForStartNonMatch = false;
+    bool waitingForStopNonMatch  = false;
+};
+
+/**
+ * @brief trigger name and context of a tag, extracted once and shared by all filters evaluating the tag.
+ * N.B. views into the tag's map, i.e. must not outlive the tag.
+ */
+struct TriggerInfo {
+    bool             empty = true;
+    std::string_view name;
+    std::string_view ctx;
+
+    [[nodiscard]] static TriggerInfo fromTag(const Tag& tag) {
+        TriggerInfo info;
+        info.empty = tag.map.empty();
+        if (auto it = tag.map.find(tag::TRIGGER_NAME.shortKey()); it != tag.map.end()) {
+            info.name = std::get<std::string>(it->second);
+        }
+        if (auto it = tag.map.find(tag::TRIGGER_META_INFO.shortKey()); it != tag.map.end()) {
+            if (auto meta = std::get_if<property_map>(&it->second); meta && meta->contains(tag::CONTEXT.shortKey())) {
+                info.ctx = std::get<std::string>(meta->at(tag::CONTEXT.shortKey()));
+            }
+        }
+        return info;
+    }
+};
+
+[[nodiscard]] inline trigger::MatchResult match(const CompiledFilter& filter, const TriggerInfo& tag, CompiledState& state) noexcept {
+    if ((!filter.startDefined && !filter.stopDefined) || tag.empty) {
+        return trigger::MatchResult::Ignore;
+    }
+
+    if (filter.isSingleTrigger) {
+        const bool triggerMatch = filter.start.name.empty() || tag.name == filter.start.name;
+        const bool contextMatch = filter.start.ctx.empty() || filter.start.ctx.contains(tag.ctx); // N.B. same containment direction as `filter(..)`
+        if (triggerMatch && contextMatch) {
+            state.waitingForStartNonMatch = filter.start.nameEnds || filter.start.ctxEnds;
+            return MatchResult::Matching;
+        }
+    }
+
+    if (filter.startDefined && filter.stopDefined) {
+        if (!state.triggerActive || state.waitingForStartNonMatch) {
+            const bool triggerMatch = filter.start.name.empty() || tag.name == filter.start.name;
+            const bool contextMatch = filter.start.ctx.empty() || tag.ctx.contains(filter.start.ctx);
+
+            if (triggerMatch && contextMatch) {
+                state.triggerActive           = true;
+                state.waitingForStartNonMatch = filter.start.nameEnds || filter.start.ctxEnds;
+                return state.waitingForStartNonMatch ? MatchResult::Ignore : MatchResult::Matching;
+            } else if (state.waitingForStartNonMatch) {
+                state.waitingForStartNonMatch = false;
+                return MatchResult::Matching;
+            }
+        } else {
+            const bool triggerMatch = filter.stop.name.empty() || tag.name == filter.stop.name;
+            const bool contextMatch = filter.stop.ctx.empty() || tag.ctx.contains(filter.stop.ctx);
+
+            if ((triggerMatch && contextMatch) || state.waitingForStopNonMatch) {
+                state.waitingForStopNonMatch = filter.stop.nameEnds || filter.stop.ctxEnds;
+                if (!state.waitingForStopNonMatch || !triggerMatch || !contextMatch) {
+                    state = CompiledState{};
+                    return MatchResult::NotMatching;
+                }
+                return MatchResult::Ignore;
+            }
+        }
+    }
+
+    return trigger::MatchResult::Ignore;
+}
+
+/**
+ * @brief drop-in replacement for `Filter` that compiles the filter definition once (and again only if it changes).
+ * The definition may also be bound at construction for callers that do not provide one (e.g. DataSink listeners). Sinks may
+ * register `Compiled` matchers with their `Dispatcher` rather than evaluating them individually.
+ * N.B. the matcher state is kept in the matcher object rather than in `filterState`.
+ */
+struct Compiled {
+    std::string    definition; // used if the caller provides an empty filter definition
+    CompiledFilter compiledFilter;
+    CompiledState  state;
+    bool           compiled = false;
+
+    Compiled() = default;
+    explicit Compiled(std::string_view definition_) : definition(definition_) {}
+
+    [[nodiscard]] trigger::MatchResult operator()(std::string_view filterDefinition, const Tag& tag, const property_map& /*filterState*/) {
+        if (filterDefinition.empty()) {
+            filterDefinition = definition;
+        }
+        if (!compiled || filterDefinition != compiledFilter.definition) {
+            compiledFilter = CompiledFilter::compile(filterDefinition);
+            state          = CompiledState{};
+            compiled       = true;
+        }
+        return match(compiledFilter, TriggerInfo::fromTag(tag), state);
+    }
+};
+
+static_assert(Matcher<Compiled>);
+
+namespace detail {
+struct StringHash {
+    using is_transparent = void;
+    [[nodiscard]] std::size_t operator()(std::string_view str) const noexcept { return std::hash<std::string_view>{}(str); }
+};
+} // namespace detail
+
+/**
+ * @brief dispatch table evaluating many compiled filters against the same tag stream (e.g. many listeners on one sink).
+ *
+ * Trigger names referenced by the filters are interned into IDs, and each tag is evaluated only by the filters referring to its
+ * trigger name plus those that need all tags (wildcard names or '^' end-markers), i.e. the per-tag cost is independent of the
+ * number of filters not interested in the tag. Results are queried per subscription via `result(id)` until the next `dispatch(..)`.
+ */
+class Dispatcher {
+    struct Entry {
+        CompiledFilter filter;
+        CompiledState  state;
+        MatchResult    result = MatchResult::Ignore;
+        bool           used   = false;
+    };
+
+    std::vector<Entry>                                                                  _entries;
+    std::vector<std::size_t>                                                            _freeEntries;
+    std::unordered_map<std::string, std::size_t, detail::StringHash, std::equal_to<>> _nameIds;       // interned trigger names
+    std::vector<std::vector<std::size_t>>                                               _entriesByName; // trigger-name ID -> entries
+    std::vector<std::size_t>                                                            _entriesForAllTags;
+    std::vector<std::size_t>                                                            _evaluated; // entries evaluated by the last `dispatch(..)`
+
+    std::size_t internName(std::string_view name) {
+        if (auto it = _nameIds.find(name); it != _nameIds.end()) {
+            return it->second;
+        }
+        _entriesByName.emplace_back();
+        return _nameIds.emplace(std::string(name), _entriesByName.size() - 1UZ).first->second;
+    }
+
+public:
+    [[nodiscard]] std::size_t subscribe(std::string_view filterDefinition) {
+        Entry entry;
+        entry.filter = CompiledFilter::compile(filterDefinition);
+        entry.used   = true;
+        std::size_t id;
+        if (_freeEntries.empty()) {
+            id = _entries.size();
+            _entries.push_back(std::move(entry));
+        } else {
+            id = _freeEntries.back();
+            _freeEntries.pop_back();
+            _entries[id] = std::move(entry);
+        }
+
+        const CompiledFilter& filter = _entries[id].filter;
+        if (filter.needsAllTags()) {
+            _entriesForAllTags.push_back(id);
+        } else {
+            if (filter.startDefined) {
+                _entriesByName[internName(filter.start.name)].push_back(id);
+            }
+            if (filter.stopDefined && !(filter.startDefined && filter.stop.name == filter.start.name)) {
+                _entriesByName[internName(filter.stop.name)].push_back(id);
+            }
+        }
+        return id;
+    }
+
+    void unsubscribe(std::size_t id) {
+        if (id >= _entries.size() || !_entries[id].used) {
+            return;
+        }
+        std::erase(_entriesForAllTags, id);
+        for (auto& entries : _entriesByName) {
+            std::erase(entries, id);
+        }
+        std::erase(_evaluated, id);
+        _entries[id] = Entry{};
+        _freeEntries.push_back(id);
+    }
+
+    void dispatch(const Tag& tag) {
+        for (const std::size_t id : _evaluated) {
+            _entries[id].result = MatchResult::Ignore;
+        }
+        _evaluated.clear();
+
+        const TriggerInfo info     = TriggerInfo::fromTag(tag);
+        const auto        evaluate = [this, &info](std::size_t id) {
+            Entry& entry = _entries[id];
+            entry.result = match(entry.filter, info, entry.state);
+            _evaluated.push_back(id);
+        };
+        if (auto it = _nameIds.find(info.name); it != _nameIds.end()) {
+            std::ranges::for_each(_entriesByName[it->second], evaluate);
+        }
+        std::ranges::for_each(_entriesForAllTags, evaluate);
+    }
+
+    [[nodiscard]] MatchResult result(std::size_t id) const noexcept { return id < _entries.size() ? _entries[id].result : MatchResult::Ignore; }
+    [[nodiscard]] std::size_t size() const noexcept { return _entries.size() - _freeEntries.size(); }
+};
+
+/**
+ * @brief matcher returning the result of its `Dispatcher` entry for the last dispatched tag; unsubscribes on destruction.
+ * N.B. `Dispatcher::dispatch(..)` must be called with the same tag before invoking the matcher, and the dispatcher must outlive the subscription.
+ */
+class Subscription {
+    Dispatcher* _dispatcher = nullptr;
+    std::size_t _id         = 0UZ;
+
+public:
+    Subscription() = default;
+    Subscription(Dispatcher& dispatcher, std::string_view filterDefinition) : _dispatcher(&dispatcher), _id(dispatcher.subscribe(filterDefinition)) {}
+    Subscription(const Subscription&)            = delete;
+    Subscription& operator=(const Subscription&) = delete;
+    Subscription(Subscription&& other) noexcept : _dispatcher(std::exchange(other._dispatcher, nullptr)), _id(other._id) {}
+
+    Subscription& operator=(Subscription&& other) noexcept {
+        if (this != &other) {
+            reset();
+            _dispatcher = std::exchange(other._dispatcher, nullptr);
+            _id         = other._id;
+        }
+        return *this;
+    }
+
+    ~Subscription() { reset(); }
+
+    void reset() {
+        if (_dispatcher != nullptr) {
+            std::exchange(_dispatcher, nullptr)->unsubscribe(_id);
+        }
+    }
+
+    [[nodiscard]] trigger::MatchResult operator()(std::string_view /*filterDefinition*/, const Tag& /*tag*/, const property_map& /*filterState*/) const noexcept { return _dispatcher != nullptr ? _dispatcher->result(_id) : MatchResult::Ignore; }
+};
+
+static_assert(Matcher<Subscription>);
+
 } // namespace BasicTriggerNameCtxMatcher
 
 } // namespace gr::trigger
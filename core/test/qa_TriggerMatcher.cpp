@@ -253,6 +253,50 @@ const boost::ut::suite<"BasicTriggerNameCtxMatcher"> triggerTest = [] {
             expect(eq(matcher(filter, createTag("alarm", "room1"), state), Matching));
         };
     };
+
+    "compiled matcher and dispatcher vs. reference filter"_test = [] {
+        using namespace trigger::BasicTriggerNameCtxMatcher;
+        constexpr auto createTag = [](std::string triggerName, std::string cxt) noexcept {
+            auto meta = property_map{{tag::CONTEXT.shortKey(), cxt}};
+            return Tag(0, {{tag::TRIGGER_NAME.shortKey(), triggerName}, {tag::TRIGGER_META_INFO.shortKey(), meta}});
+        };
+
+        const std::vector<std::string> filters{"[alarm/room1, alarm/room3]", "[alarm/room1, alarm/^room3]", "[alarm/^room1, alarm/^room3]", "[^alarm/room1, alarm/room3]", "[alarm/room1]", "[, alarm/room1]", "[alarm/room1, alarm/room1]", "[alarm, info]", "/room2", "[/room1, /room3]", ""};
+        const std::vector<std::string> names{"alarm", "info", "other"};
+        const std::vector<std::string> contexts{"room1", "room2", "room3", "room4"};
+
+        std::vector<Tag> tags{Tag{}};
+        for (std::size_t i = 0UZ; i < 500UZ; ++i) { // deterministic pseudo-random tag sequence
+            tags.push_back(createTag(names[(i * 7UZ + i / 5UZ) % names.size()], contexts[(i * 3UZ + i / 7UZ) % contexts.size()]));
+        }
+
+        Dispatcher                dispatcher;
+        std::vector<property_map> referenceStates(filters.size());
+        std::vector<Compiled>     compiledMatchers(filters.size());
+        std::vector<Subscription> subscriptions;
+        for (const auto& filterDefinition : filters) {
+            subscriptions.emplace_back(dispatcher, filterDefinition);
+        }
+        expect(eq(dispatcher.size(), filters.size()));
+
+        for (const auto& tag : tags) {
+            dispatcher.dispatch(tag);
+            for (std::size_t i = 0UZ; i < filters.size(); ++i) {
+                const auto expected = filter(filters[i], tag, referenceStates[i]);
+                expect(eq(compiledMatchers[i](filters[i], tag, {}), expected)) << "compiled:" << filters[i];
+                expect(eq(subscriptions[i](filters[i], tag, {}), expected)) << "dispatched:" << filters[i];
+            }
+        }
+
+        expect(eq(CompiledFilter::compile("[, alarm/room1]").isSingleTrigger, true));
+        expect(eq(CompiledFilter::compile("[alarm, info]").needsAllTags(), false));
+        expect(eq(CompiledFilter::compile("[alarm/^room1, info]").needsAllTags(), true));
+
+        subscriptions.pop_back();
+        expect(eq(dispatcher.size(), filters.size() - 1UZ)) << "unsubscribed on destruction";
+        Compiled bound("[alarm/room1]");
+        expect(eq(bound("", createTag("alarm", "room1"), {}), trigger::MatchResult::Matching)) << "definition bound at construction";
+    };
 };
 
 int main() { /* not needed for UT */ }
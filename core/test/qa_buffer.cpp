@@ -13,6 +13,7 @@
 #include <gnuradio-4.0/Buffer.hpp>
 #include <gnuradio-4.0/BufferSkeleton.hpp>
 #include <gnuradio-4.0/CircularBuffer.hpp>
+#include <gnuradio-4.0/DataSet.hpp>
 #include <gnuradio-4.0/HistoryBuffer.hpp>
 #include <gnuradio-4.0/Sequence.hpp>
 #include <gnuradio-4.0/WaitStrategy.hpp>
@@ -694,6 +695,39 @@ const boost::ut::suite NonPowerTwoTests = [] {
         genSamples();
         readSamples();
     };
+
+    "DataSet<T> move-through with DataSetPool"_test = [] {
+        constexpr std::size_t kNSamples = 1024UZ;
+        BufferLike auto       buffer    = CircularBuffer<DataSet<float>>(16);
+        BufferWriterLike auto writer    = buffer.new_writer();
+        BufferReaderLike auto reader    = buffer.new_reader();
+        DataSetPool<float>    pool;
+
+        std::size_t nRecycled = 0UZ;
+        for (std::size_t i = 0UZ; i < 3UZ * buffer.size(); i++) {
+            DataSet<float> dataSet = pool.acquire();
+            if (dataSet.signal_values.capacity() >= kNSamples) {
+                nRecycled++;
+            }
+            dataSet.signal_names.assign({"signal"});
+            dataSet.signal_values.resize(kNSamples, static_cast<float>(i));
+
+            {
+                WriterSpanLike auto pSpan = writer.tryReserve<SpanReleasePolicy::ProcessAll>(1);
+                expect(eq(pSpan.size(), 1UZ));
+                pool.publish(pSpan[0], std::move(dataSet));
+            }
+
+            ReaderSpanLike auto cSpan = reader.get(1UZ);
+            expect(eq(cSpan[0].signal_values.size(), kNSamples));
+            expect(eq(cSpan[0].signal_values[0], static_cast<float>(i)));
+            expect(eq(cSpan[0].signal_names.size(), 1UZ));
+            expect(cSpan.consume(1UZ));
+        }
+        // N.B. after the first wrap-around the consumed slots hand back their storage -> no further allocations
+        expect(eq(nRecycled, 2UZ * buffer.size() - 1UZ));
+        expect(le(pool.size(), 1UZ));
+    };
 };
 
 const boost::ut::suite HistoryBufferTest = [] {
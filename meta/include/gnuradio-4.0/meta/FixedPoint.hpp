@@ -0,0 +1,455 @@
+#ifndef GNURADIO_FIXEDPOINT_HPP
+#define GNURADIO_FIXEDPOINT_HPP
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <compare>
+#include <concepts>
+#include <cstdint>
+#include <functional>
+#include <limits>
+#include <span>
+#include <type_traits>
+
+#include <vir/simd.h>
+
+namespace gr {
+
+namespace fixed_point {
+enum class Rounding : std::uint8_t {
+    Truncate, /// towards -inf, i.e. a plain arithmetic right-shift
+    Nearest   /// round-half-up, i.e. add 1/2 LSB before the shift (same as e.g. the 'mulhrs' family of SIMD instructions)
+};
+
+enum class Overflow : std::uint8_t {
+    Saturate, /// clamp to [lowest, max]
+    Wrap      /// two's complement modulo arithmetic
+};
+} // namespace fixed_point
+
+/**
+ * @brief signed fixed-point sample type 'Qm.n' with a compile-time rounding and overflow policy
+ *
+ * The value is 'raw / 2^nFractionalBits', e.g. Q15 (int16_t, 15 fractional bits) spans [-1, 1 - 2^-15] and is bit-identical to the
+ * raw int16 samples delivered by most ADCs/FPGA front-ends, i.e. these can be forwarded without conversion (see 'fromRaw(...)').
+ * Products are computed in the next-wider integer type, rounded and narrowed according to the policies. Conversions from
+ * floating-point always saturate (NaN -> 0) and follow the rounding policy.
+ *
+ * Usage:
+ * @code
+ * gr::Q15 a(0.5f);
+ * gr::Q15 b(0.75);
+ * gr::Q15 c = a * b;              // 0.375
+ * float   d = static_cast<float>(a + b); // saturates at 1 - 2^-15
+ * gr::fixed_point::multiply(std::span<const Q15>(x), std::span<const Q15>(y), std::span<Q15>(z)); // SIMD bulk variant
+ * @endcode
+ */
+template<std::signed_integral TRaw, std::size_t nFractionalBits = std::numeric_limits<TRaw>::digits, fixed_point::Rounding rounding = fixed_point::Rounding::Nearest, fixed_point::Overflow overflow = fixed_point::Overflow::Saturate>
+requires(sizeof(TRaw) <= sizeof(std::int32_t) && nFractionalBits <= std::numeric_limits<TRaw>::digits)
+struct FixedPoint {
+    using raw_type  = TRaw;
+    using wide_type = std::conditional_t<sizeof(TRaw) <= sizeof(std::int16_t), std::int32_t, std::int64_t>; // holds any product w/o overflow
+
+    static constexpr std::size_t           kFractionalBits = nFractionalBits;
+    static constexpr fixed_point::Rounding kRounding       = rounding;
+    static constexpr fixed_point::Overflow kOverflow       = overflow;
+    static constexpr wide_type             kOne            = wide_type(1) << nFractionalBits; // N.B. not representable for nFractionalBits == digits
+
+    raw_type raw = 0;
+
+    constexpr FixedPoint() noexcept = default;
+
+    template<std::floating_point F>
+    explicit constexpr FixedPoint(F value) noexcept : raw(fromFloating(value)) {}
+
+    [[nodiscard]] static constexpr FixedPoint fromRaw(raw_type value) noexcept {
+        FixedPoint result;
+        result.raw = value;
+        return result;
+    }
+
+    template<std::floating_point F>
+    [[nodiscard]] explicit constexpr operator F() const noexcept {
+        return static_cast<F>(raw) * (F(1) / static_cast<F>(kOne));
+    }
+
+    [[nodiscard]] static constexpr FixedPoint lowest() noexcept { return fromRaw(std::numeric_limits<raw_type>::lowest()); }
+    [[nodiscard]] static constexpr FixedPoint max() noexcept { return fromRaw(std::numeric_limits<raw_type>::max()); }
+    [[nodiscard]] static constexpr FixedPoint epsilon() noexcept { return fromRaw(raw_type(1)); }
+
+    /// rounds a wide product (2 * kFractionalBits fractional bits) or accumulator back to kFractionalBits fractional bits
+    template<typename W>
+    [[nodiscard]] static constexpr W roundShift(W product) noexcept {
+        if constexpr (nFractionalBits == 0UZ) {
+            return product;
+        } else if constexpr (rounding == fixed_point::Rounding::Nearest) {
+            return (product + W(wide_type(1) << (nFractionalBits - 1UZ))) >> static_cast<int>(nFractionalBits);
+        } else {
+            return product >> static_cast<int>(nFractionalBits);
+        }
+    }
+
+    template<typename W>
+    [[nodiscard]] static constexpr raw_type narrow(W value) noexcept {
+        if constexpr (overflow == fixed_point::Overflow::Saturate) {
+            constexpr W kLowest = static_cast<W>(std::numeric_limits<raw_type>::lowest());
+            constexpr W kMax    = static_cast<W>(std::numeric_limits<raw_type>::max());
+            return static_cast<raw_type>(value < kLowest ? kLowest : (value > kMax ? kMax : value));
+        } else {
+            return static_cast<raw_type>(value); // N.B. modulo 2^N since C++20
+        }
+    }
+
+    template<std::floating_point F>
+    [[nodiscard]] static constexpr raw_type fromFloating(F value) noexcept {
+        F scaled = value * static_cast<F>(kOne) + (rounding == fixed_point::Rounding::Nearest ? F(0.5) : F(0));
+        if (!(scaled == scaled)) { // NaN
+            return raw_type(0);
+        }
+        // N.B. clamp to [lowest, max + 1] first, which are exact in F (unlike e.g. 2^31 - 1 in float), and saturate again after rounding
+        scaled = scaled < floatingLowest<F>() ? floatingLowest<F>() : (scaled > floatingUpper<F>() ? floatingUpper<F>() : scaled);
+        // floor(..) w/o <cmath> to remain constexpr: the truncating cast rounds towards zero
+        const auto truncated = static_cast<wide_type>(scaled);
+        const auto floored   = static_cast<F>(truncated) > scaled ? truncated - 1 : truncated;
+        return static_cast<raw_type>(floored > wide_type(std::numeric_limits<raw_type>::max()) ? wide_type(std::numeric_limits<raw_type>::max()) : floored);
+    }
+
+    template<std::floating_point F>
+    [[nodiscard]] static constexpr F floatingLowest() noexcept {
+        return static_cast<F>(std::numeric_limits<raw_type>::lowest());
+    }
+
+    template<std::floating_point F>
+    [[nodiscard]] static constexpr F floatingUpper() noexcept {
+        return -floatingLowest<F>();
+    }
+
+    constexpr FixedPoint& operator+=(FixedPoint other) noexcept { return *this = *this + other; }
+    constexpr FixedPoint& operator-=(FixedPoint other) noexcept { return *this = *this - other; }
+    constexpr FixedPoint& operator*=(FixedPoint other) noexcept { return *this = *this * other; }
+    constexpr FixedPoint& operator/=(FixedPoint other) noexcept { return *this = *this / other; }
+
+    [[nodiscard]] friend constexpr FixedPoint operator+(FixedPoint lhs, FixedPoint rhs) noexcept { return fromRaw(narrow(wide_type(lhs.raw) + wide_type(rhs.raw))); }
+    [[nodiscard]] friend constexpr FixedPoint operator-(FixedPoint lhs, FixedPoint rhs) noexcept { return fromRaw(narrow(wide_type(lhs.raw) - wide_type(rhs.raw))); }
+    [[nodiscard]] friend constexpr FixedPoint operator-(FixedPoint value) noexcept { return fromRaw(narrow(-wide_type(value.raw))); }
+    [[nodiscard]] friend constexpr FixedPoint operator*(FixedPoint lhs, FixedPoint rhs) noexcept { return fromRaw(narrow(roundShift(wide_type(lhs.raw) * wide_type(rhs.raw)))); }
+
+    /// N.B. division by zero saturates towards the sign of the dividend (0/0 -> 0)
+    [[nodiscard]] friend constexpr FixedPoint operator/(FixedPoint lhs, FixedPoint rhs) noexcept {
+        if (rhs.raw == 0) [[unlikely]] {
+            return lhs.raw == 0 ? FixedPoint{} : (lhs.raw > 0 ? max() : lowest());
+        }
+        using div_type                  = std::int64_t; // N.B. a Q31 dividend needs 62 bits before the division
+        const div_type numerator        = div_type(lhs.raw) * div_type(kOne);
+        div_type       quotient         = numerator / div_type(rhs.raw);
+        const div_type remainder        = numerator % div_type(rhs.raw);
+        const bool     negativeQuotient = (numerator < 0) != (rhs.raw < 0);
+        if constexpr (rounding == fixed_point::Rounding::Nearest) { // round-half-up on the exact quotient
+            const div_type twiceRemainder = 2 * (remainder < 0 ? -remainder : remainder);
+            const div_type absDivisor     = rhs.raw < 0 ? -div_type(rhs.raw) : div_type(rhs.raw);
+            if (twiceRemainder > absDivisor || (twiceRemainder == absDivisor && !negativeQuotient)) {
+                quotient += negativeQuotient ? -1 : 1;
+            }
+        } else if (remainder != 0 && negativeQuotient) { // floor, consistent with the shift-based truncation
+            quotient -= 1;
+        }
+        return fromRaw(narrow(quotient));
+    }
+
+    [[nodiscard]] friend constexpr auto operator<=>(FixedPoint, FixedPoint) noexcept = default;
+    [[nodiscard]] friend constexpr bool operator==(FixedPoint, FixedPoint) noexcept  = default;
+};
+
+using Q15 = FixedPoint<std::int16_t>; /// [-1, 1 - 2^-15], bit-compatible with raw int16 ADC samples
+using Q31 = FixedPoint<std::int32_t>; /// [-1, 1 - 2^-31]
+
+namespace fixed_point::detail {
+template<typename T>
+struct is_fixed_point : std::false_type {};
+
+template<typename TRaw, std::size_t nFractionalBits, Rounding rounding, Overflow overflow>
+struct is_fixed_point<FixedPoint<TRaw, nFractionalBits, rounding, overflow>> : std::true_type {};
+} // namespace fixed_point::detail
+
+template<typename T>
+concept FixedPointLike = fixed_point::detail::is_fixed_point<std::remove_cvref_t<T>>::value;
+
+/**
+ * SIMD bulk kernels operating directly on the raw integer lanes: the inputs are widened to 'wide_type' (e.g. int16 -> int32),
+ * multiplied, rounded and shifted ('multiply-high'), and narrowed again with saturation. N.B. in-place use (out == in) is allowed.
+ */
+namespace fixed_point {
+
+namespace detail {
+template<FixedPointLike T>
+using simd_type = vir::stdx::native_simd<typename T::raw_type>;
+
+template<FixedPointLike T>
+using wide_simd_type = vir::stdx::rebind_simd_t<typename T::wide_type, simd_type<T>>;
+
+template<FixedPointLike T>
+[[nodiscard]] inline const typename T::raw_type* rawData(std::span<const T> values) noexcept {
+    static_assert(sizeof(T) == sizeof(typename T::raw_type) && std::is_standard_layout_v<T>);
+    return reinterpret_cast<const typename T::raw_type*>(values.data());
+}
+
+template<FixedPointLike T>
+[[nodiscard]] inline typename T::raw_type* rawData(std::span<T> values) noexcept {
+    static_assert(sizeof(T) == sizeof(typename T::raw_type) && std::is_standard_layout_v<T>);
+    return reinterpret_cast<typename T::raw_type*>(values.data());
+}
+
+template<FixedPointLike T, typename W>
+[[nodiscard]] inline W narrow(const W& value) noexcept {
+    if constexpr (T::kOverflow == Overflow::Saturate) {
+        return vir::stdx::max(W(typename T::wide_type(std::numeric_limits<typename T::raw_type>::lowest())), //
+            vir::stdx::min(value, W(typename T::wide_type(std::numeric_limits<typename T::raw_type>::max()))));
+    } else {
+        return value; // N.B. the narrowing static_simd_cast wraps
+    }
+}
+
+/// out[i] = op(a[i], b[i]) evaluated on the widened lanes, where 'b' is either a second input or a broadcast constant
+template<FixedPointLike T, typename TOperand, typename WideOp, typename ScalarOp>
+void transform(std::span<const T> a, const TOperand& b, std::span<T> out, WideOp&& wideOp, ScalarOp&& scalarOp) noexcept {
+    using V                    = simd_type<T>;
+    using W                    = wide_simd_type<T>;
+    constexpr bool isBroadcast = std::is_same_v<TOperand, T>;
+    const auto     operandSimd = [&b](std::size_t i) {
+        if constexpr (isBroadcast) {
+            return W(typename T::wide_type(b.raw));
+        } else {
+            return vir::stdx::static_simd_cast<W>(V(rawData(b) + i, vir::stdx::element_aligned));
+        }
+    };
+    const auto operand = [&b](std::size_t i) {
+        if constexpr (isBroadcast) {
+            return b;
+        } else {
+            return b[i];
+        }
+    };
+    assert(a.size() >= out.size());
+    const auto*       in    = rawData(a);
+    auto*             dst   = rawData(out);
+    const std::size_t n     = out.size();
+    const std::size_t nSimd = n - n % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        const W lhs = vir::stdx::static_simd_cast<W>(V(in + i, vir::stdx::element_aligned));
+        vir::stdx::static_simd_cast<V>(narrow<T>(wideOp(lhs, operandSimd(i)))).copy_to(dst + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < n; ++i) {
+        out[i] = scalarOp(a[i], operand(i));
+    }
+}
+
+/// 'multiply-high': the rounded upper half of the widened product
+template<FixedPointLike T>
+inline constexpr auto kMultiplyHigh = [](const auto& lhs, const auto& rhs) { return T::roundShift(lhs * rhs); };
+} // namespace detail
+
+template<FixedPointLike T>
+void add(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept {
+    assert(b.size() >= out.size());
+    detail::transform(a, b, out, std::plus<>{}, std::plus<>{});
+}
+
+template<FixedPointLike T>
+void add(std::span<const T> a, T b, std::span<T> out) noexcept {
+    detail::transform(a, b, out, std::plus<>{}, std::plus<>{});
+}
+
+template<FixedPointLike T>
+void subtract(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept {
+    assert(b.size() >= out.size());
+    detail::transform(a, b, out, std::minus<>{}, std::minus<>{});
+}
+
+template<FixedPointLike T>
+void subtract(std::span<const T> a, T b, std::span<T> out) noexcept {
+    detail::transform(a, b, out, std::minus<>{}, std::minus<>{});
+}
+
+template<FixedPointLike T>
+void multiply(std::span<const T> a, std::span<const T> b, std::span<T> out) noexcept {
+    assert(b.size() >= out.size());
+    detail::transform(a, b, out, detail::kMultiplyHigh<T>, std::multiplies<>{});
+}
+
+template<FixedPointLike T>
+void multiply(std::span<const T> a, T b, std::span<T> out) noexcept {
+    detail::transform(a, b, out, detail::kMultiplyHigh<T>, std::multiplies<>{});
+}
+
+/**
+ * @brief sum_i a[i] * b[i] accumulated in 64-bit with a single final rounding and saturation (i.e. like a DSP MAC unit)
+ *
+ * N.B. exact for 16-bit types (>= 33 guard bits); for 32-bit types each product is rounded to the output precision before
+ * accumulation to retain 32 guard bits.
+ */
+template<FixedPointLike T>
+[[nodiscard]] T dot(std::span<const T> a, std::span<const T> b) noexcept {
+    using V              = detail::simd_type<T>;
+    using W              = detail::wide_simd_type<T>;
+    using accumulator_t  = vir::stdx::rebind_simd_t<std::int64_t, V>;
+    constexpr bool exact = sizeof(typename T::raw_type) <= sizeof(std::int16_t);
+    assert(a.size() == b.size());
+
+    const auto*       lhs   = detail::rawData(a);
+    const auto*       rhs   = detail::rawData(b);
+    const std::size_t n     = a.size();
+    const std::size_t nSimd = n - n % V::size();
+    accumulator_t     accumulator(0);
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        const W product = vir::stdx::static_simd_cast<W>(V(lhs + i, vir::stdx::element_aligned)) * vir::stdx::static_simd_cast<W>(V(rhs + i, vir::stdx::element_aligned));
+        if constexpr (exact) {
+            accumulator += vir::stdx::static_simd_cast<accumulator_t>(product);
+        } else {
+            accumulator += vir::stdx::static_simd_cast<accumulator_t>(T::roundShift(product));
+        }
+    }
+    std::int64_t sum = vir::stdx::reduce(accumulator);
+    for (std::size_t i = nSimd; i < n; ++i) {
+        const std::int64_t product = std::int64_t(lhs[i]) * std::int64_t(rhs[i]);
+        sum += exact ? product : T::roundShift(product);
+    }
+    return T::fromRaw(T::narrow(exact ? T::roundShift(sum) : sum));
+}
+
+/**
+ * @brief quantises gains or filter taps for use with fixed-point samples: values[i] ~ mantissas[i] * 2^-shift, returns 'shift'
+ *
+ * Unlike quantising them to the sample type itself, the 32-bit mantissas share one binary exponent chosen for the largest |value|,
+ * i.e. they retain >= 30 significant bits and also represent |value| >= 1 -- notably the identity 1.0 -- exactly (Q1.30 for
+ * |value| <= 1, fewer fractional bits for larger values). Rounds half-up, saturates, NaN -> 0.
+ */
+[[nodiscard]] inline int toMantissas(std::span<const double> values, std::span<std::int32_t> mantissas) noexcept {
+    assert(mantissas.size() >= values.size());
+    double maxAbs = 0.0;
+    for (const double value : values) {
+        maxAbs = std::isfinite(value) ? std::max(maxAbs, std::abs(value)) : maxAbs;
+    }
+    int exponent = 0;
+    static_cast<void>(std::frexp(maxAbs, &exponent)); // maxAbs < 2^exponent
+    const int shift = std::clamp(31 - exponent, 0, 62);
+    std::ranges::transform(values, mantissas.begin(), [shift](double value) {
+        const double scaled = std::floor(std::ldexp(value, shift) + 0.5);
+        return std::isnan(scaled) ? std::int32_t(0) : static_cast<std::int32_t>(std::clamp(scaled, double(std::numeric_limits<std::int32_t>::lowest()), double(std::numeric_limits<std::int32_t>::max())));
+    });
+    return shift;
+}
+
+namespace detail {
+/// rounds a product with 'shift' excess fractional bits (see 'toMantissas(...)') back to T's fractional bits
+template<FixedPointLike T, typename W>
+[[nodiscard]] inline W roundShift(const W& product, int shift) noexcept {
+    if constexpr (T::kRounding == Rounding::Nearest) {
+        return shift > 0 ? (product + W(std::int64_t(1) << (shift - 1))) >> shift : product;
+    } else {
+        return product >> shift;
+    }
+}
+} // namespace detail
+
+/// out[i] = in[i] * gain with a single rounding and saturation, where 'gain' is kept at 32-bit precision (see 'toMantissas(...)')
+template<FixedPointLike T>
+void scale(std::span<const T> in, double gain, std::span<T> out) noexcept {
+    using V = detail::simd_type<T>;
+    using L = vir::stdx::rebind_simd_t<std::int64_t, V>;
+    assert(in.size() >= out.size());
+    std::int32_t      mantissa = 0;
+    const int         shift    = toMantissas(std::span(&gain, 1UZ), std::span(&mantissa, 1UZ));
+    const auto*       src      = detail::rawData(in);
+    auto*             dst      = detail::rawData(out);
+    const std::size_t n        = out.size();
+    const std::size_t nSimd    = n - n % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        const L product = vir::stdx::static_simd_cast<L>(V(src + i, vir::stdx::element_aligned)) * L(std::int64_t(mantissa));
+        vir::stdx::static_simd_cast<V>(detail::narrow<T>(detail::roundShift<T>(product, shift))).copy_to(dst + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < n; ++i) {
+        out[i] = T::fromRaw(T::narrow(detail::roundShift<T>(std::int64_t(src[i]) * std::int64_t(mantissa), shift)));
+    }
+}
+
+/**
+ * @brief sum_i a[i] * (mantissas[i] * 2^-shift) for coefficients quantised by 'toMantissas(...)', accumulated in 64-bit
+ *
+ * N.B. exact for 16-bit types (>= 17 guard bits); for 32-bit types each product is rounded to the output precision before accumulation.
+ */
+template<FixedPointLike T>
+[[nodiscard]] T dot(std::span<const T> a, std::span<const std::int32_t> mantissas, int shift) noexcept {
+    using V              = detail::simd_type<T>;
+    using M              = vir::stdx::rebind_simd_t<std::int32_t, V>;
+    using accumulator_t  = vir::stdx::rebind_simd_t<std::int64_t, V>;
+    constexpr bool exact = sizeof(typename T::raw_type) <= sizeof(std::int16_t);
+    assert(a.size() == mantissas.size());
+
+    const auto*       lhs   = detail::rawData(a);
+    const std::size_t n     = a.size();
+    const std::size_t nSimd = n - n % V::size();
+    accumulator_t     accumulator(0);
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        const accumulator_t product = vir::stdx::static_simd_cast<accumulator_t>(V(lhs + i, vir::stdx::element_aligned)) * vir::stdx::static_simd_cast<accumulator_t>(M(mantissas.data() + i, vir::stdx::element_aligned));
+        if constexpr (exact) {
+            accumulator += product;
+        } else {
+            accumulator += detail::roundShift<T>(product, shift);
+        }
+    }
+    std::int64_t sum = vir::stdx::reduce(accumulator);
+    for (std::size_t i = nSimd; i < n; ++i) {
+        const std::int64_t product = std::int64_t(lhs[i]) * std::int64_t(mantissas[i]);
+        sum += exact ? product : detail::roundShift<T>(product, shift);
+    }
+    return T::fromRaw(T::narrow(exact ? detail::roundShift<T>(sum, shift) : sum));
+}
+
+/// out[i] = T(in[i] * scale), i.e. rounded and saturated according to T's policies (NaN -> 0)
+template<FixedPointLike T, std::floating_point F>
+void fromFloating(std::span<const F> in, std::span<T> out, F scale = F(1)) noexcept {
+    using V                  = vir::stdx::native_simd<F>;
+    using W                  = vir::stdx::rebind_simd_t<typename T::wide_type, V>;
+    constexpr F kRoundOffset = T::kRounding == Rounding::Nearest ? F(0.5) : F(0);
+    assert(in.size() >= out.size());
+
+    const F           rawScale = scale * static_cast<F>(T::kOne);
+    auto*             dst      = detail::rawData(out);
+    const std::size_t n        = out.size();
+    const std::size_t nSimd    = n - n % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        V scaled = V(in.data() + i, vir::stdx::element_aligned) * rawScale + kRoundOffset;
+        vir::stdx::where(scaled != scaled, scaled) = F(0);
+        scaled                                     = vir::stdx::floor(vir::stdx::max(V(T::template floatingLowest<F>()), vir::stdx::min(scaled, V(T::template floatingUpper<F>()))));
+        const W rounded                            = vir::stdx::min(vir::stdx::static_simd_cast<W>(scaled), W(typename T::wide_type(std::numeric_limits<typename T::raw_type>::max())));
+        vir::stdx::static_simd_cast<vir::stdx::rebind_simd_t<typename T::raw_type, V>>(rounded).copy_to(dst + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < n; ++i) {
+        out[i] = T(in[i] * rawScale / static_cast<F>(T::kOne)); // N.B. same rounding of 'in[i] * rawScale' as the SIMD path
+    }
+}
+
+/// out[i] = F(in[i]) * scale
+template<FixedPointLike T, std::floating_point F>
+void toFloating(std::span<const T> in, std::span<F> out, F scale = F(1)) noexcept {
+    using V = vir::stdx::native_simd<F>;
+    assert(in.size() >= out.size());
+
+    const F           rawScale = scale / static_cast<F>(T::kOne);
+    const auto*       src      = detail::rawData(in);
+    const std::size_t n        = out.size();
+    const std::size_t nSimd    = n - n % V::size();
+    for (std::size_t i = 0UZ; i < nSimd; i += V::size()) {
+        (vir::stdx::static_simd_cast<V>(vir::stdx::rebind_simd_t<typename T::raw_type, V>(src + i, vir::stdx::element_aligned)) * rawScale).copy_to(out.data() + i, vir::stdx::element_aligned);
+    }
+    for (std::size_t i = nSimd; i < n; ++i) {
+        out[i] = static_cast<F>(src[i]) * rawScale;
+    }
+}
+
+} // namespace fixed_point
+
+} // namespace gr
+
+#endif // GNURADIO_FIXEDPOINT_HPP
@@ -2,13 +2,17 @@
 #define GNURADIO_UNCERTAINVALUE_HPP
 
 #include <atomic>
+#include <cassert>
 #include <complex>
 #include <concepts>
 #include <cstdint>
 #include <numbers>
 #include <optional>
+#include <span>
 #include <type_traits>
 
+#include <vir/simd.h>
+
 #include <gnuradio-4.0/meta/utils.hpp>
 
 namespace gr {
@@ -26,12 +30,20 @@ namespace gr {
  * This implements only propagation of uncorrelated symmetric errors (i.e. gaussian-type standard deviations).
  * A more rigorous treatment would require the calculation and propagation of the
  * corresponding covariance matrix which is out of scope of this implementation.
+ *
+ * UncertainValue<stdx::simd<T>> is the structure-of-arrays (SoA) 'lane' counterpart of UncertainValue<T>, i.e. holds
+ * simd::size() mean values and uncertainties in two registers. The same operators and gr::math functions propagate the
+ * uncertainties of all lanes at once, and UncertainValue<T> blocks may thus use the SIMD 'processOne(V)' path
+ * (see gr::meta::t_or_simd). loadUncertainValues(...)/storeUncertainValues(...) convert from/to AoS or SoA spans.
  */
 
 template<typename T>
 concept arithmetic_or_complex_like = std::is_arithmetic_v<T> || meta::complex_like<T>;
 
-template<arithmetic_or_complex_like T>
+template<typename T>
+concept arithmetic_complex_or_simd_like = arithmetic_or_complex_like<T> || meta::any_simd<T>;
+
+template<arithmetic_complex_or_simd_like T>
 struct UncertainValue {
     using value_type = T;
 
@@ -77,6 +89,11 @@ auto operator<=>(U lhs, const UncertainValue<T>& rhs) {
 template<typename T>
 concept UncertainValueLike = gr::meta::is_instantiation_of<T, UncertainValue>;
 
+namespace meta {
+template<typename V, typename T>
+inline constexpr bool is_simd_lane_of_v<UncertainValue<V>, UncertainValue<T>> = any_simd<V, T>;
+} // namespace meta
+
 template<typename T>
 requires arithmetic_or_complex_like<meta::fundamental_base_value_type_t<T>>
 [[nodiscard]] inline constexpr auto value(const T& val) noexcept {
@@ -112,6 +129,79 @@ struct UncertainValueValueType<UncertainValue<T>> {
 template<typename T>
 using UncertainValueType_t = detail::UncertainValueValueType<T>::type;
 
+namespace detail {
+template<typename T>
+[[nodiscard]] inline constexpr auto absolute(const T& x) noexcept {
+    if constexpr (meta::any_simd<T>) {
+        return vir::stdx::abs(x);
+    } else {
+        return std::abs(x);
+    }
+}
+
+/// std::hypot(a, b) counterpart that also accepts SIMD lanes (overflow-safe, within a few ULP of std::hypot)
+template<typename T>
+[[nodiscard]] inline constexpr T hypot(const T& a, const T& b) noexcept {
+    if constexpr (meta::any_simd<T>) {
+        const T absA  = vir::stdx::abs(a);
+        const T absB  = vir::stdx::abs(b);
+        const T large = vir::stdx::max(absA, absB);
+        T       ratio = vir::stdx::min(absA, absB) / large;
+        vir::stdx::where(absA == absB, ratio) = T(1); // N.B. covers 0/0 and inf/inf
+        return large * vir::stdx::sqrt(T(1) + ratio * ratio);
+    } else {
+        return std::hypot(a, b);
+    }
+}
+
+template<typename T>
+[[nodiscard]] inline constexpr auto norm(const T& x) noexcept {
+    if constexpr (meta::any_simd<T>) {
+        return x * x;
+    } else {
+        return std::norm(x);
+    }
+}
+} // namespace detail
+
+/**
+ * @brief loads V::size() consecutive UncertainValue<T> starting at 'offset' into one SoA lane
+ *
+ * either from an array-of-structures (i.e. UncertainValue<T>[]) span, or from separate value and uncertainty spans
+ */
+template<meta::any_simd V, typename T>
+requires std::same_as<typename V::value_type, T>
+[[nodiscard]] inline UncertainValue<V> loadUncertainValues(std::span<const UncertainValue<T>> in, std::size_t offset = 0UZ) noexcept {
+    assert(offset + V::size() <= in.size());
+    const UncertainValue<T>* data = in.data() + offset;
+    return {V([data](auto i) { return data[i].value; }), V([data](auto i) { return data[i].uncertainty; })};
+}
+
+template<meta::any_simd V, typename T>
+requires std::same_as<typename V::value_type, T>
+[[nodiscard]] inline UncertainValue<V> loadUncertainValues(std::span<const T> values, std::span<const T> uncertainties, std::size_t offset = 0UZ) noexcept {
+    assert(offset + V::size() <= values.size() && offset + V::size() <= uncertainties.size());
+    return {V(values.data() + offset, vir::stdx::element_aligned), V(uncertainties.data() + offset, vir::stdx::element_aligned)};
+}
+
+/// @brief stores one SoA lane into V::size() consecutive UncertainValue<T> (or separate value and uncertainty spans) starting at 'offset'
+template<meta::any_simd V, typename T>
+requires std::same_as<typename V::value_type, T>
+inline void storeUncertainValues(const UncertainValue<V>& lane, std::span<UncertainValue<T>> out, std::size_t offset = 0UZ) noexcept {
+    assert(offset + V::size() <= out.size());
+    for (std::size_t i = 0UZ; i < V::size(); ++i) {
+        out[offset + i] = {lane.value[i], lane.uncertainty[i]};
+    }
+}
+
+template<meta::any_simd V, typename T>
+requires std::same_as<typename V::value_type, T>
+inline void storeUncertainValues(const UncertainValue<V>& lane, std::span<T> values, std::span<T> uncertainties, std::size_t offset = 0UZ) noexcept {
+    assert(offset + V::size() <= values.size() && offset + V::size() <= uncertainties.size());
+    lane.value.copy_to(values.data() + offset, vir::stdx::element_aligned);
+    lane.uncertainty.copy_to(uncertainties.data() + offset, vir::stdx::element_aligned);
+}
+
 /********************** some basic math operation definitions *********************************/
 
 // FIXME: make operators of UncertainValue hidden friends or members to reduce compile time (simplifies overload
@@ -128,11 +218,11 @@ requires(UncertainValueLike<T> || UncertainValueLike<U>) && std::is_same_v<meta:
             return UncertainValue<ResultType>{lhs.value + rhs.value, newUncertainty};
         } else {
             // both ValueType[T,U] are arithmetic uncertainties
-            return UncertainValue<ResultType>{lhs.value + rhs.value, std::hypot(lhs.uncertainty, rhs.uncertainty)};
+            return UncertainValue<ResultType>{lhs.value + rhs.value, detail::hypot(lhs.uncertainty, rhs.uncertainty)};
         }
-    } else if constexpr (UncertainValueLike<T> && arithmetic_or_complex_like<ValueTypeU>) {
+    } else if constexpr (UncertainValueLike<T> && arithmetic_complex_or_simd_like<ValueTypeU>) {
         return T{lhs.value + rhs, lhs.uncertainty};
-    } else if constexpr (arithmetic_or_complex_like<ValueTypeT> && UncertainValueLike<U>) {
+    } else if constexpr (arithmetic_complex_or_simd_like<ValueTypeT> && UncertainValueLike<U>) {
         return U{lhs + rhs.value, rhs.uncertainty};
     } else {
         static_assert(gr::meta::always_false<T>, "branch should never reach here due to default '+' definition");
@@ -151,7 +241,7 @@ inline constexpr T operator+(const T& val) {
     if constexpr (meta::complex_like<ValueTypeT>) {
         return val;
     } else {
-        return {std::abs(val.value), std::abs(val.uncertainty)};
+        return {detail::absolute(val.value), detail::absolute(val.uncertainty)};
     }
 }
 
@@ -166,11 +256,11 @@ requires(UncertainValueLike<T> || UncertainValueLike<U>) && std::is_same_v<meta:
             return UncertainValue<ResultType>{lhs.value - rhs.value, newUncertainty};
         } else {
             // both ValueType[T,U] are arithmetic uncertainties
-            return UncertainValue<ResultType>{lhs.value - rhs.value, std::hypot(lhs.uncertainty, rhs.uncertainty)};
+            return UncertainValue<ResultType>{lhs.value - rhs.value, detail::hypot(lhs.uncertainty, rhs.uncertainty)};
         }
-    } else if constexpr (UncertainValueLike<T> && arithmetic_or_complex_like<ValueTypeU>) {
+    } else if constexpr (UncertainValueLike<T> && arithmetic_complex_or_simd_like<ValueTypeU>) {
         return T{lhs.value - rhs, lhs.uncertainty};
-    } else if constexpr (arithmetic_or_complex_like<ValueTypeT> && UncertainValueLike<U>) {
+    } else if constexpr (arithmetic_complex_or_simd_like<ValueTypeT> && UncertainValueLike<U>) {
         return U{lhs - rhs.value, rhs.uncertainty};
     } else {
         static_assert(gr::meta::always_false<T>, "branch should never reach here due to default '-' definition");
@@ -199,12 +289,12 @@ requires(UncertainValueLike<T> || UncertainValueLike<U>) && std::is_same_v<meta:
             return UncertainValue<ResultType>{lhs.value * rhs.value, newUncertainty};
         } else {
             // both ValueType[T,U] are arithmetic uncertainties
-            auto combinedUncertainty = std::hypot(lhs.value * rhs.uncertainty, rhs.value * lhs.uncertainty);
+            auto combinedUncertainty = detail::hypot(lhs.value * rhs.uncertainty, rhs.value * lhs.uncertainty);
             return UncertainValue<ResultType>{lhs.value * rhs.value, combinedUncertainty};
         }
-    } else if constexpr (UncertainValueLike<T> && arithmetic_or_complex_like<ValueTypeU>) {
+    } else if constexpr (UncertainValueLike<T> && arithmetic_complex_or_simd_like<ValueTypeU>) {
         return T{lhs.value * rhs, lhs.uncertainty * rhs};
-    } else if constexpr (arithmetic_or_complex_like<ValueTypeT> && UncertainValueLike<U>) {
+    } else if constexpr (arithmetic_complex_or_simd_like<ValueTypeT> && UncertainValueLike<U>) {
         return U{lhs * rhs.value, lhs * rhs.uncertainty};
     } else {
         static_assert(gr::meta::always_false<T>, "branch should never reach here due to default '*' definition");
@@ -238,14 +328,14 @@ requires(UncertainValueLike<T> || UncertainValueLike<U>) && std::is_same_v<meta:
             return UncertainValue<ResultType>{lhs.value / rhs.value, newUncertainty};
         } else {
             // both ValueType[T,U] are arithmetic uncertainties
-            ResultType combinedUncertainty = std::hypot(lhs.uncertainty / rhs.value, rhs.uncertainty * lhs.value / (rhs.value * rhs.value));
+            ResultType combinedUncertainty = detail::hypot(lhs.uncertainty / rhs.value, rhs.uncertainty * lhs.value / (rhs.value * rhs.value));
             return UncertainValue<ResultType>{lhs.value / rhs.value, combinedUncertainty};
         }
-    } else if constexpr (UncertainValueLike<T> && arithmetic_or_complex_like<ValueTypeU>) {
-        return T{lhs.value / rhs, lhs.uncertainty / std::abs(rhs)};
-    } else if constexpr (arithmetic_or_complex_like<ValueTypeT> && UncertainValueLike<U>) {
-        auto rhsMagSquared = std::norm(rhs.value);
-        return U{lhs / rhs.value, rhs.uncertainty * std::abs(lhs) / rhsMagSquared};
+    } else if constexpr (UncertainValueLike<T> && arithmetic_complex_or_simd_like<ValueTypeU>) {
+        return T{lhs.value / rhs, lhs.uncertainty / detail::absolute(rhs)};
+    } else if constexpr (arithmetic_complex_or_simd_like<ValueTypeT> && UncertainValueLike<U>) {
+        auto rhsMagSquared = detail::norm(rhs.value);
+        return U{lhs / rhs.value, rhs.uncertainty * detail::absolute(lhs) / rhsMagSquared};
     } else {
         static_assert(gr::meta::always_false<T>, "branch should never reach here due to default '/' definition");
     }
@@ -264,25 +354,35 @@ namespace gr::math {
 template<gr::UncertainValueLike T, std::floating_point U, typename ValueTypeT = gr::UncertainValueType_t<T>>
 requires std::is_same_v<gr::meta::fundamental_base_value_type_t<ValueTypeT>, U> || std::integral<U>
 [[nodiscard]] inline constexpr T pow(const T& base, U exponent) noexcept {
-    if (base.value == static_cast<meta::fundamental_base_value_type_t<ValueTypeT>>(0)) [[unlikely]] {
-        if (exponent == 0) [[unlikely]] {
-            return T{1, 0};
-        } else {
-            return T{0, 0};
+    if constexpr (gr::meta::any_simd<ValueTypeT>) { // N.B. lane-wise equivalent of the scalar branches below
+        using TValue           = typename ValueTypeT::value_type;
+        const auto isZero      = base.value == ValueTypeT(0);
+        ValueTypeT newValue    = vir::stdx::pow(base.value, ValueTypeT(static_cast<TValue>(exponent)));
+        ValueTypeT uncertainty = vir::stdx::abs(newValue * static_cast<TValue>(exponent) * base.uncertainty / base.value);
+        vir::stdx::where(isZero, newValue)    = ValueTypeT(exponent == 0 ? TValue(1) : TValue(0));
+        vir::stdx::where(isZero, uncertainty) = ValueTypeT(0);
+        return T{newValue, uncertainty};
+    } else {
+        if (base.value == static_cast<meta::fundamental_base_value_type_t<ValueTypeT>>(0)) [[unlikely]] {
+            if (exponent == 0) [[unlikely]] {
+                return T{1, 0};
+            } else {
+                return T{0, 0};
+            }
         }
-    }
 
-    ValueTypeT newValue = std::pow(base.value, exponent);
-    if constexpr (gr::meta::complex_like<ValueTypeT>) {
-        auto val = exponent / base.value * newValue;
-        return T{newValue, std::sqrt(val * std::conj(val)) * base.uncertainty};
-    } else {
-        return T{newValue, std::abs(newValue * exponent * base.uncertainty / base.value)};
+        ValueTypeT newValue = std::pow(base.value, exponent);
+        if constexpr (gr::meta::complex_like<ValueTypeT>) {
+            auto val = exponent / base.value * newValue;
+            return T{newValue, std::sqrt(val * std::conj(val)) * base.uncertainty};
+        } else {
+            return T{newValue, std::abs(newValue * exponent * base.uncertainty / base.value)};
+        }
     }
 }
 
 template<gr::UncertainValueLike T, gr::UncertainValueLike U, typename ValueTypeT = gr::UncertainValueType_t<T>, typename ValueTypeU = gr::UncertainValueType_t<T>>
-requires std::is_same_v<gr::meta::fundamental_base_value_type_t<ValueTypeT>, gr::meta::fundamental_base_value_type_t<ValueTypeU>>
+requires std::is_same_v<gr::meta::fundamental_base_value_type_t<ValueTypeT>, gr::meta::fundamental_base_value_type_t<ValueTypeU>> && (!gr::meta::any_simd<ValueTypeT>)
 [[nodiscard]] inline constexpr T pow(const T& base, const U& exponent) noexcept {
     if (base.value == 0.0) [[unlikely]] {
         if (exponent.value == static_cast<ValueTypeU>(0)) [[unlikely]] {
@@ -303,7 +403,15 @@ requires std::is_same_v<gr::meta::fundamental_base_value_type_t<ValueTypeT>, gr:
 
 template<typename T>
 [[nodiscard]] inline constexpr T sqrt(const T& value) noexcept {
-    if constexpr (gr::UncertainValueLike<T>) {
+    if constexpr (gr::UncertainValueLike<T> && gr::meta::any_simd<gr::UncertainValueType_t<T>>) {
+        using V             = gr::UncertainValueType_t<T>;
+        const V newValue    = vir::stdx::sqrt(value.value);
+        V       uncertainty = vir::stdx::abs(V(typename V::value_type(0.5)) * value.uncertainty / newValue);
+        vir::stdx::where(value.value == V(0), uncertainty) = V(0);
+        return T{newValue, uncertainty};
+    } else if constexpr (gr::meta::any_simd<T>) {
+        return vir::stdx::sqrt(value);
+    } else if constexpr (gr::UncertainValueLike<T>) {
         using ValueType = meta::fundamental_base_value_type_t<T>;
         return gr::math::pow(value, ValueType(0.5));
     } else {
@@ -313,7 +421,11 @@ template<typename T>
 
 template<typename T>
 [[nodiscard]] inline constexpr T sin(const T& x) noexcept {
-    if constexpr (gr::UncertainValueLike<T>) {
+    if constexpr (gr::UncertainValueLike<T> && gr::meta::any_simd<gr::UncertainValueType_t<T>>) {
+        return T{vir::stdx::sin(x.value), vir::stdx::abs(vir::stdx::cos(x.value) * x.uncertainty)};
+    } else if constexpr (gr::meta::any_simd<T>) {
+        return vir::stdx::sin(x);
+    } else if constexpr (gr::UncertainValueLike<T>) {
         return T{std::sin(x.value), std::abs(std::cos(x.value) * x.uncertainty)};
     } else {
         return std::sin(x);
@@ -322,7 +434,11 @@ template<typename T>
 
 template<typename T>
 [[nodiscard]] inline constexpr T cos(const T& x) noexcept {
-    if constexpr (gr::UncertainValueLike<T>) {
+    if constexpr (gr::UncertainValueLike<T> && gr::meta::any_simd<gr::UncertainValueType_t<T>>) {
+        return T{vir::stdx::cos(x.value), vir::stdx::abs(vir::stdx::sin(x.value) * x.uncertainty)};
+    } else if constexpr (gr::meta::any_simd<T>) {
+        return vir::stdx::cos(x);
+    } else if constexpr (gr::UncertainValueLike<T>) {
         return T{std::cos(x.value), std::abs(std::sin(x.value) * x.uncertainty)};
     } else {
         return std::cos(x);
@@ -331,7 +447,10 @@ template<typename T>
 
 template<gr::UncertainValueLike T, typename ValueTypeT = gr::UncertainValueType_t<T>>
 [[nodiscard]] inline constexpr T exp(const T& x) noexcept {
-    if constexpr (gr::meta::complex_like<ValueTypeT>) {
+    if constexpr (gr::meta::any_simd<ValueTypeT>) { // N.B. d/dx e^x = e^x
+        const ValueTypeT newValue = vir::stdx::exp(x.value);
+        return T{newValue, vir::stdx::abs(newValue * x.uncertainty)};
+    } else if constexpr (gr::meta::complex_like<ValueTypeT>) {
         return gr::math::pow(gr::UncertainValue<ValueTypeT>{std::numbers::e_v<typename ValueTypeT::value_type>, static_cast<ValueTypeT>(0)}, x);
     } else {
         return gr::math::pow(gr::UncertainValue<ValueTypeT>{std::numbers::e_v<ValueTypeT>, static_cast<ValueTypeT>(0)}, x);
@@ -8,6 +8,7 @@
 #include <fmt/format.h>
 #include <fmt/std.h>
 #include <gnuradio-4.0/Tag.hpp>
+#include <gnuradio-4.0/meta/FixedPoint.hpp>
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 #include <source_location>
 #include <vector>
@@ -98,6 +99,19 @@ struct fmt::formatter<gr::UncertainValue<T>> {
     }
 };
 
+// fixed-point values are formatted as their (exact) floating-point equivalent
+template<gr::FixedPointLike T>
+struct fmt::formatter<T> {
+    formatter<double> value_formatter;
+
+    constexpr auto parse(format_parse_context& ctx) { return value_formatter.parse(ctx); }
+
+    template<typename FormatContext>
+    auto format(const T& value, FormatContext& ctx) const {
+        return value_formatter.format(static_cast<double>(value), ctx);
+    }
+};
+
 // pmt formatter
 
 namespace gr {
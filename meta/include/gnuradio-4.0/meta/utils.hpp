@@ -465,8 +465,12 @@ namespace stdx = vir::stdx;
 template<typename V, typename T = void>
 concept any_simd = stdx::is_simd_v<V> && (std::same_as<T, void> || std::same_as<T, typename V::value_type>);
 
+/// customisation point: true if V is the SIMD structure-of-arrays counterpart of a composite sample type T (e.g. UncertainValue<simd<float>> of UncertainValue<float>)
 template<typename V, typename T>
-concept t_or_simd = std::same_as<V, T> || any_simd<V, T>;
+inline constexpr bool is_simd_lane_of_v = false;
+
+template<typename V, typename T>
+concept t_or_simd = std::same_as<V, T> || any_simd<V, T> || is_simd_lane_of_v<V, T>;
 
 template<typename T>
 concept complex_like = std::is_same_v<T, std::complex<float>> || std::is_same_v<T, std::complex<double>>;
@@ -0,0 +1,164 @@
+#include <boost/ut.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <vector>
+
+#include <gnuradio-4.0/meta/FixedPoint.hpp>
+#include <gnuradio-4.0/meta/formatter.hpp>
+
+#include <fmt/format.h>
+#include <fmt/ranges.h>
+
+const boost::ut::suite<"FixedPoint"> fixedPointTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    constexpr auto kTypes = std::tuple<Q15, Q31>();
+
+    "conversion and representation"_test = []<typename T>(const T&) {
+        static_assert(sizeof(T) == sizeof(typename T::raw_type));
+        static_assert(FixedPointLike<T> && !FixedPointLike<typename T::raw_type>);
+        constexpr double kEpsilon = 1.0 / static_cast<double>(T::kOne);
+
+        expect(eq(T(0.5).raw, static_cast<typename T::raw_type>(T::kOne / 2)));
+        expect(eq(static_cast<double>(T(-0.375)), -0.375));
+        expect(eq(static_cast<double>(T::lowest()), -1.0));
+        expect(eq(static_cast<double>(T::max()), 1.0 - kEpsilon));
+        expect(eq(static_cast<double>(T::epsilon()), kEpsilon));
+        expect(T::fromRaw(42).raw == 42);
+
+        // saturation (also where 'max' is not representable in float, e.g. 2^31 - 1) and NaN
+        expect(T(1.0) == T::max());
+        expect(T(1.0f) == T::max());
+        expect(T(1e9) == T::max());
+        expect(T(-1.0f) == T::lowest());
+        expect(T(-1e9) == T::lowest());
+        expect(T(std::numeric_limits<double>::quiet_NaN()) == T{});
+
+        // rounding: round-half-up vs. truncation (towards -inf)
+        expect(eq(T(0.4 * kEpsilon).raw, 0));
+        expect(eq(T(0.5 * kEpsilon).raw, 1));
+        expect(eq(T(-0.5 * kEpsilon).raw, 0));
+        expect(eq(T(-0.6 * kEpsilon).raw, -1));
+        using TTruncating = FixedPoint<typename T::raw_type, T::kFractionalBits, fixed_point::Rounding::Truncate>;
+        expect(eq(TTruncating(0.9 * kEpsilon).raw, 0));
+        expect(eq(TTruncating(-0.1 * kEpsilon).raw, -1));
+
+        expect(eq(fmt::format("{}", T(-0.25)), std::string("-0.25")));
+    } | kTypes;
+
+    "saturating arithmetic"_test = []<typename T>(const T&) {
+        expect(T(0.25) + T(0.5) == T(0.75));
+        expect(T(0.75) + T(0.75) == T::max());
+        expect(T(-0.75) - T(0.75) == T::lowest());
+        expect(-T::lowest() == T::max());
+        expect(T(0.5) * T(-0.75) == T(-0.375));
+        expect(T(-1.0) * T(-1.0) == T::max()) << "the only overflowing product";
+        expect(T(-0.25) / T(0.5) == T(-0.5));
+        expect(T(0.5) / T(0.25) == T::max());
+        expect(T(0.5) / T{} == T::max());
+        expect(T(-0.5) / T{} == T::lowest());
+        expect(T(0.25) < T(0.5));
+
+        T value(0.25);
+        value += T(0.5);
+        value *= T(0.5);
+        expect(value == T(0.375));
+
+        // round-half-up on the product: 3 LSB * 0.5 = 1.5 LSB -> 2 LSB, -1.5 LSB -> -1 LSB
+        expect(eq((T::fromRaw(3) * T(0.5)).raw, 2));
+        expect(eq((T::fromRaw(-3) * T(0.5)).raw, -1));
+
+        using TWrapping = FixedPoint<typename T::raw_type, T::kFractionalBits, fixed_point::Rounding::Nearest, fixed_point::Overflow::Wrap>;
+        expect(TWrapping(0.75) + TWrapping(0.75) == TWrapping(-0.5));
+    } | kTypes;
+
+    "non-default Q format"_test = [] {
+        using Q3_12 = FixedPoint<std::int16_t, 12UZ>; // [-8, 8)
+        expect(eq(static_cast<double>(Q3_12(2.5) * Q3_12(-3.0)), -7.5));
+        expect(eq(static_cast<double>(Q3_12(6.0) + Q3_12(6.0)), 8.0 - 1.0 / 4096.0));
+        expect(eq(static_cast<double>(Q3_12(1.0) / Q3_12(4.0)), 0.25));
+    };
+
+    "SIMD kernels vs. scalar operators"_test = []<typename T>(const T&) {
+        for (std::size_t nSamples : {0UZ, 1UZ, 7UZ, 64UZ, 1001UZ}) { // N.B. covers the vectorised part and the scalar remainder
+            std::vector<T> a(nSamples);
+            std::vector<T> b(nSamples);
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                a[i] = T(1.2 * std::sin(0.1 * static_cast<double>(i))); // N.B. includes saturated values
+                b[i] = T(0.9 * std::cos(0.37 * static_cast<double>(i)));
+            }
+
+            std::vector<T> result(nSamples);
+            const auto     check = [&](auto op, std::string_view name) {
+                for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                    expect(result[i] == op(a[i], b[i])) << fmt::format("{}: sample {} of {}: {} vs. {}", name, i, nSamples, result[i], op(a[i], b[i]));
+                }
+            };
+            fixed_point::add<T>(a, b, result);
+            check(std::plus<>{}, "add");
+            fixed_point::subtract<T>(a, b, result);
+            check(std::minus<>{}, "subtract");
+            fixed_point::multiply<T>(a, b, result);
+            check(std::multiplies<>{}, "multiply");
+            fixed_point::multiply<T>(a, T(-0.3), result);
+            check([](T lhs, T) { return lhs * T(-0.3); }, "multiply constant");
+            fixed_point::add<T>(a, T(0.5), result);
+            check([](T lhs, T) { return lhs + T(0.5); }, "add constant");
+
+            result = a;
+            fixed_point::multiply<T>(result, b, result); // in-place
+            check(std::multiplies<>{}, "multiply in-place");
+
+            double reference = 0.0; // N.B. rounding errors of double are far below 1 LSB
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                reference += static_cast<double>(a[i]) * static_cast<double>(b[i]);
+            }
+            const double expected = std::clamp(reference, static_cast<double>(T::lowest()), static_cast<double>(T::max()));
+            const double lsb      = static_cast<double>(T::epsilon());
+            const double accuracy = sizeof(T) == 2UZ ? 0.5 * lsb : (0.5 * static_cast<double>(nSamples) + 0.5) * lsb; // 32-bit: one rounding per product
+            expect(std::abs(static_cast<double>(fixed_point::dot<T>(a, b)) - expected) <= accuracy) << fmt::format("dot product of {} samples", nSamples);
+
+            std::vector<double>       taps(nSamples);
+            std::vector<std::int32_t> mantissas(nSamples);
+            double                    tapReference = 0.0;
+            for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                taps[i] = 2.5 * std::cos(0.37 * static_cast<double>(i)); // N.B. |taps| >= 1
+                tapReference += static_cast<double>(a[i]) * taps[i];
+            }
+            const int    shift       = fixed_point::toMantissas(taps, mantissas);
+            const double tapExpected = std::clamp(tapReference, static_cast<double>(T::lowest()), static_cast<double>(T::max()));
+            expect(std::abs(static_cast<double>(fixed_point::dot<T>(a, mantissas, shift)) - tapExpected) <= accuracy + 1e-6 * static_cast<double>(nSamples)) << fmt::format("wide-coefficient dot product of {} samples", nSamples);
+
+            for (const double gain : {1.0, 1.5, -0.3, 2e-6, 0.0}) { // N.B. 1e-9 tolerance: gain quantisation (>= 30 significant bits)
+                fixed_point::scale<T>(a, gain, result);
+                for (std::size_t i = 0UZ; i < nSamples; ++i) {
+                    const double scaled = std::clamp(static_cast<double>(a[i]) * gain, static_cast<double>(T::lowest()), static_cast<double>(T::max()));
+                    expect(std::abs(static_cast<double>(result[i]) - scaled) <= 0.5 * lsb + 1e-9) << fmt::format("scale by {}: sample {} of {}", gain, i, nSamples);
+                }
+                if (gain == 1.0) {
+                    expect(std::ranges::equal(result, a)) << "gain 1.0 is an exact identity";
+                }
+            }
+        }
+    } | kTypes;
+
+    "floating-point bulk conversion"_test = []<typename T>(const T&) {
+        const std::vector<float> input{0.5f, -0.25f, 0.75f, -1.f, 2.f, -2.f, std::numeric_limits<float>::quiet_NaN(), 0.125f, -0.0625f, 0.f, 0.375f, -0.875f, 1.f, 0.25f, 0.5f, -0.5f, 0.1875f};
+        std::vector<T>           fixed(input.size());
+        fixed_point::fromFloating<T, float>(input, fixed, 0.5f);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            expect(fixed[i] == T(0.5f * input[i])) << fmt::format("sample {}: {} vs. {}", i, fixed[i], 0.5f * input[i]);
+        }
+
+        std::vector<double> output(input.size());
+        fixed_point::toFloating<T, double>(fixed, output, 2.0);
+        for (std::size_t i = 0UZ; i < input.size(); ++i) {
+            const double expected = std::isnan(input[i]) ? 0.0 : 2.0 * std::clamp(0.5 * static_cast<double>(input[i]), -1.0, 1.0);
+            expect(std::abs(output[i] - expected) <= 2.0 * static_cast<double>(T::epsilon())) << fmt::format("sample {}: {} vs. {}", i, output[i], expected);
+        }
+    } | kTypes;
+};
+
+int main() { /* not needed for UT */ }
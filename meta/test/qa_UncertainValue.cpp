@@ -1,6 +1,8 @@
 #include <boost/ut.hpp>
 
 #include <complex>
+#include <span>
+#include <vector>
 
 #include <gnuradio-4.0/meta/UncertainValue.hpp>
 
@@ -804,4 +806,53 @@ const boost::ut::suite uncertainValueExpTests = [] {
     };
 };
 
+const boost::ut::suite uncertainValueSimdTests = [] {
+    using namespace boost::ut;
+    using namespace gr;
+    using test::detail::approx;
+
+    "SoA SIMD lanes vs. scalar UncertainValue"_test = []<typename T>(const T&) {
+        using V = vir::stdx::native_simd<T>;
+        static_assert(meta::t_or_simd<UncertainValue<V>, UncertainValue<T>>, "SIMD lanes are accepted by the 'processOne(V)' SIMD path");
+        static_assert(!meta::t_or_simd<UncertainValue<T>, UncertainValue<V>>);
+
+        std::vector<UncertainValue<T>> lhs(V::size());
+        std::vector<UncertainValue<T>> rhs(V::size());
+        for (std::size_t i = 0UZ; i < V::size(); ++i) {
+            lhs[i] = {T(1) + static_cast<T>(i), T(0.1) * static_cast<T>(i % 3UZ)}; // N.B. includes zero uncertainties
+            rhs[i] = {T(0.5) - static_cast<T>(i), T(0.2)};
+        }
+        const UncertainValue<V> a = loadUncertainValues<V>(std::span<const UncertainValue<T>>(lhs));
+        const UncertainValue<V> b = loadUncertainValues<V>(std::span<const UncertainValue<T>>(rhs));
+
+        std::vector<UncertainValue<T>> result(V::size());
+        const auto                     check = [&](const UncertainValue<V>& lane, auto scalarOp, std::string_view name) {
+            storeUncertainValues(lane, std::span(result));
+            for (std::size_t i = 0UZ; i < V::size(); ++i) {
+                const UncertainValue<T> expected  = scalarOp(lhs[i], rhs[i]);
+                const T                 tolerance = T(1e-5) * std::max(T(1), std::abs(expected.value));
+                expect(approx(result[i].value, expected.value, tolerance)) << fmt::format("{} value lane {}", name, i);
+                expect(approx(result[i].uncertainty, expected.uncertainty, tolerance)) << fmt::format("{} uncertainty lane {}", name, i);
+            }
+        };
+        check(a + b, [](auto x, auto y) { return x + y; }, "a + b");
+        check(a - b, [](auto x, auto y) { return x - y; }, "a - b");
+        check(a * b, [](auto x, auto y) { return x * y; }, "a * b");
+        check(a / b, [](auto x, auto y) { return x / y; }, "a / b");
+        check(T(2) * a - b.value, [](auto x, auto y) { return T(2) * x - y.value; }, "2 * a - value(b)");
+        check(T(3) / b, [](auto, auto y) { return T(3) / y; }, "3 / b");
+        check(math::sqrt(a), [](auto x, auto) { return math::sqrt(x); }, "sqrt(a)");
+        check(math::pow(a, T(3)), [](auto x, auto) { return math::pow(x, T(3)); }, "pow(a, 3)");
+        check(math::sin(b), [](auto, auto y) { return math::sin(y); }, "sin(b)");
+        check(math::cos(b), [](auto, auto y) { return math::cos(y); }, "cos(b)");
+        check(math::exp(b), [](auto, auto y) { return math::exp(y); }, "exp(b)");
+
+        // structure-of-arrays storage round-trip
+        std::vector<T> values(V::size());
+        std::vector<T> uncertainties(V::size());
+        storeUncertainValues(a, std::span(values), std::span(uncertainties));
+        check(loadUncertainValues<V>(std::span<const T>(values), std::span<const T>(uncertainties)), [](auto x, auto) { return x; }, "SoA round-trip");
+    } | std::tuple<float, double>();
+};
+
 int main() { /* tests are statically executed */ }